@@ -0,0 +1,91 @@
+#include "ResourceManager.hpp"
+
+#include <QtCore/QFile>
+#include <QtGui/QPixmap>
+
+namespace sigma::editor
+{
+	std::unordered_map<StyleSheetType, QString> ResourceManager::m_style_sheets =
+	{
+		{StyleSheetType::dark, k_stylesheet_dark}
+	};
+
+	std::unordered_map<IconType, QString> ResourceManager::m_icons =
+	{
+		{IconType::window_close, k_icon_window_close},
+		{IconType::window_maximize, k_icon_window_maximize},
+		{IconType::window_minimize, k_icon_window_minimize},
+		{IconType::window_restore, k_icon_window_restore}
+	};
+
+	std::unordered_map<AssetId, QString> ResourceManager::m_paths{};
+	std::mutex ResourceManager::m_paths_mutex{};
+	ResourceCache<EditorResource> ResourceManager::m_cache{ &ResourceManager::load, k_byte_budget };
+
+	QString ResourceManager::get_style_sheet(const StyleSheetType type)
+	{
+		ResourceHandle handle{};
+		const auto* resource = acquire(m_style_sheets.at(type), handle);
+		auto style_sheet = resource != nullptr ? std::get<QString>(*resource) : QString{};
+		m_cache.release(handle);
+		return style_sheet;
+	}
+
+	QIcon ResourceManager::get_icon(const IconType type)
+	{
+		ResourceHandle handle{};
+		const auto* resource = acquire(m_icons.at(type), handle);
+		auto icon = resource != nullptr ? QIcon{ QPixmap::fromImage(std::get<QImage>(*resource)) } : QIcon{};
+		m_cache.release(handle);
+		return icon;
+	}
+
+	ResourceCacheStatistics ResourceManager::get_statistics()
+	{
+		return m_cache.get_statistics();
+	}
+
+	const EditorResource* ResourceManager::acquire(const QString& path, ResourceHandle& handle)
+	{
+		const auto utf8_path = path.toUtf8();
+		const auto id = make_asset_id({ utf8_path.constData(), static_cast<std::size_t>(utf8_path.size()) });
+		{
+			std::lock_guard lock{ m_paths_mutex };
+			m_paths.try_emplace(id, path);
+		}
+
+		handle = m_cache.acquire(id);
+		return m_cache.get(handle);
+	}
+
+	bool ResourceManager::load(const AssetId id, EditorResource& resource, std::size_t& byte_size)
+	{
+		QString path{};
+		{
+			std::lock_guard lock{ m_paths_mutex };
+			path = m_paths.at(id);
+		}
+
+		if (path.endsWith(".qss"))
+		{
+			QFile file{ path };
+			if (!file.open(QFile::ReadOnly))
+			{
+				return false;
+			}
+			const auto style_sheet = QString{ file.readAll() };
+			byte_size = static_cast<std::size_t>(style_sheet.size()) * sizeof(QChar);
+			resource = style_sheet;
+			return true;
+		}
+
+		QImage image{};
+		if (!image.load(path))
+		{
+			return false;
+		}
+		byte_size = static_cast<std::size_t>(image.sizeInBytes());
+		resource = image;
+		return true;
+	}
+}
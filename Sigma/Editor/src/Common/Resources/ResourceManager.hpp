@@ -0,0 +1,56 @@
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+#include <variant>
+
+#include <QtCore/QString>
+#include <QtGui/QIcon>
+#include <QtGui/QImage>
+
+#include "Sigma/Engine/Assets/ResourceCache.hpp"
+
+#include "constants.hpp"
+
+namespace sigma::editor
+{
+	enum class StyleSheetType
+	{
+		dark
+	};
+
+	enum class IconType
+	{
+		window_close,
+		window_maximize,
+		window_minimize,
+		window_restore
+	};
+
+	// Icons are cached as QImage, which owns plain memory, and become a pixmap only on use. The cache is a static
+	// that outlives QApplication, so it must not hold QPixmaps.
+	using EditorResource = std::variant<QString, QImage>;
+
+	// Stylesheets and icons go through one engine resource cache keyed by the hashed resource path, so repeated
+	// requests are served from memory and both count against the same byte budget
+	class ResourceManager
+	{
+	public:
+		static constexpr std::size_t k_byte_budget = 64 * 1024 * 1024;
+
+		static QString get_style_sheet(StyleSheetType type);
+		static QIcon get_icon(IconType type);
+
+		static ResourceCacheStatistics get_statistics();
+	private:
+		static const EditorResource* acquire(const QString& path, ResourceHandle& handle);
+		static bool load(AssetId id, EditorResource& resource, std::size_t& byte_size);
+
+		static std::unordered_map<StyleSheetType, QString> m_style_sheets;
+		static std::unordered_map<IconType, QString> m_icons;
+		// Paths seen so far by their id, the cache loader only receives the id
+		static std::unordered_map<AssetId, QString> m_paths;
+		static std::mutex m_paths_mutex;
+		static ResourceCache<EditorResource> m_cache;
+	};
+}
@@ -4,4 +4,10 @@ namespace sigma::editor
 {
 	// Stylesheets
 	constexpr auto k_stylesheet_dark = ":/StyleSheets/Dark.qss";
+
+	// Icons
+	constexpr auto k_icon_window_close = ":/Icons/window_close_32.png";
+	constexpr auto k_icon_window_maximize = ":/Icons/window_maximize_32.png";
+	constexpr auto k_icon_window_minimize = ":/Icons/window_minimize_32.png";
+	constexpr auto k_icon_window_restore = ":/Icons/window_restore_32.png";
 }
\ No newline at end of file
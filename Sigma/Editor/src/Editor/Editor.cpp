@@ -1,6 +1,6 @@
 #include "Editor.hpp"
 
-#include "Common/Resources/StyleSheetManager.hpp"
+#include "Common/Resources/ResourceManager.hpp"
 
 namespace sigma::editor
 {
@@ -9,6 +9,47 @@ namespace sigma::editor
 	{
 		m_ui.setupUi(this);
 
-		setStyleSheet(StyleSheetManager::get_style_sheet(StyleSheetType::dark));
+		setStyleSheet(ResourceManager::get_style_sheet(StyleSheetType::dark));
+
+		m_ui.treeView_inspector->setModel(&m_inspector_model);
+
+		connect(&m_frame_timer, &QTimer::timeout, this, &Editor::render_frame);
+		m_frame_timer.start(16);
+	}
+
+	void Editor::render_frame()
+	{
+		const auto width = static_cast<std::size_t>(std::max(m_ui.widget_engine->width(), 1));
+		const auto height = static_cast<std::size_t>(std::max(m_ui.widget_engine->height(), 1));
+		if (width != m_render_target.get_width() || height != m_render_target.get_height())
+		{
+			m_render_target.resize(width, height);
+		}
+
+		{
+			const ProfileScope scope{ m_profiler, "Transform update" };
+			m_world.update(m_job_system);
+		}
+		{
+			const ProfileScope scope{ m_profiler, "Inspector refresh" };
+			m_inspector_model.refresh();
+		}
+		{
+			const ProfileScope scope{ m_profiler, "Rasterization" };
+			m_rasterizer.begin_frame();
+			m_rasterizer.render(m_render_target, m_job_system);
+		}
+		{
+			const ProfileScope scope{ m_profiler, "Present" };
+			m_ui.widget_engine->present(m_render_target);
+		}
+
+		const auto render_target_bytes = m_render_target.get_stride() * m_render_target.get_padded_height() * (sizeof(UInt32) + sizeof(Float));
+		const auto world_bytes = m_world.get_nodes().capacity() * (sizeof(TransformNode) + 2 * sizeof(Matrix4x4) + sizeof(TransformTicks));
+		m_profiler.record_memory("Render target", render_target_bytes);
+		m_profiler.record_memory("Transform pools", world_bytes);
+
+		m_profiler.end_frame(m_job_system);
+		m_ui.widget_performance->consume(m_profiler);
 	}
 }
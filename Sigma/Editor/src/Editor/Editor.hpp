@@ -3,6 +3,14 @@
 #include <QtCore>
 #include <QtWidgets>
 
+#include "Sigma/Engine/Jobs/JobSystem.hpp"
+#include "Sigma/Engine/Profiling/Profiler.hpp"
+#include "Sigma/Engine/Rendering/RenderTarget.hpp"
+#include "Sigma/Engine/Rendering/SoftwareRasterizer.hpp"
+#include "Sigma/Engine/Scene/TransformHierarchy.hpp"
+
+#include "Editor/Models/EntityInspectorModel.hpp"
+
 #include "ui_Editor.h"
 
 namespace sigma::editor
@@ -13,6 +21,15 @@ namespace sigma::editor
 	public:
 		explicit Editor(QWidget* parent = nullptr);
 	private:
+		void render_frame();
+
 		Ui::EditorWindow m_ui{};
+		QTimer m_frame_timer{};
+		Profiler m_profiler{};
+		JobSystem m_job_system{};
+		SoftwareRasterizer m_rasterizer{};
+		RenderTarget m_render_target{};
+		TransformHierarchy m_world{};
+		EntityInspectorModel m_inspector_model{ m_world };
 	};
 }
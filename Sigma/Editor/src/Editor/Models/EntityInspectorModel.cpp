@@ -0,0 +1,176 @@
+#include "EntityInspectorModel.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace sigma::editor
+{
+	namespace
+	{
+		QString format_position(const Matrix4x4& matrix)
+		{
+			return QStringLiteral("%1, %2, %3")
+				.arg(static_cast<double>(matrix._41), 0, 'f', 3)
+				.arg(static_cast<double>(matrix._42), 0, 'f', 3)
+				.arg(static_cast<double>(matrix._43), 0, 'f', 3);
+		}
+	}
+
+	EntityInspectorModel::EntityInspectorModel(const TransformHierarchy& hierarchy, QObject* parent)
+		: QAbstractItemModel(parent)
+		, m_hierarchy{ hierarchy }
+	{
+	}
+
+	void EntityInspectorModel::refresh()
+	{
+		const auto entity_count = get_entity_count();
+		if (entity_count < m_fetched_rows)
+		{
+			beginRemoveRows({}, entity_count, m_fetched_rows - 1);
+			m_fetched_rows = entity_count;
+			endRemoveRows();
+		}
+		// Small worlds are shown in full right away, larger ones grow as the view scrolls
+		if (m_fetched_rows < std::min(entity_count, k_fetch_batch_size))
+		{
+			fetchMore({});
+		}
+
+		// A new dense order moves every row, so the whole visible range is relaid out rather than diffed
+		if (m_hierarchy.get_structure_tick() != m_structure_tick)
+		{
+			emit layoutAboutToBeChanged();
+			m_structure_tick = m_hierarchy.get_structure_tick();
+			emit layoutChanged();
+		}
+		else if (m_fetched_rows > 0)
+		{
+			const auto* ticks = m_hierarchy.get_ticks().data();
+			auto first_changed = m_fetched_rows;
+			auto last_changed = -1;
+			for (int row = 0; row < m_fetched_rows; ++row)
+			{
+				const auto& tick = ticks[row];
+				if (std::max(tick.local_changed, tick.world_changed) >= m_refreshed_tick)
+				{
+					first_changed = std::min(first_changed, row);
+					last_changed = row;
+				}
+			}
+
+			if (last_changed >= 0)
+			{
+				emit dataChanged(index(first_changed, 0), index(last_changed, column_count - 1), { Qt::DisplayRole });
+			}
+		}
+
+		m_refreshed_tick = m_hierarchy.get_tick();
+	}
+
+	QModelIndex EntityInspectorModel::index(const int row, const int column, const QModelIndex& parent) const
+	{
+		if (parent.isValid() || row < 0 || row >= m_fetched_rows || column < 0 || column >= column_count)
+		{
+			return {};
+		}
+		return createIndex(row, column);
+	}
+
+	QModelIndex EntityInspectorModel::parent(const QModelIndex&) const
+	{
+		return {};
+	}
+
+	int EntityInspectorModel::rowCount(const QModelIndex& parent) const
+	{
+		return parent.isValid() ? 0 : m_fetched_rows;
+	}
+
+	int EntityInspectorModel::columnCount(const QModelIndex& parent) const
+	{
+		return parent.isValid() ? 0 : column_count;
+	}
+
+	QVariant EntityInspectorModel::data(const QModelIndex& index, const int role) const
+	{
+		if (!index.isValid() || role != Qt::DisplayRole || index.row() >= get_entity_count())
+		{
+			return {};
+		}
+
+		const auto row = static_cast<std::size_t>(index.row());
+		const auto& node = m_hierarchy.get_nodes().data()[row];
+		switch (index.column())
+		{
+		case column_entity:
+			return QString::number(node.entity);
+		case column_parent:
+			return node.parent == k_null_entity ? QString{} : QString::number(node.parent);
+		case column_depth:
+			return QString::number(node.depth);
+		case column_local_position:
+			return format_position(m_hierarchy.get_local(node.entity));
+		case column_world_position:
+			return format_position(m_hierarchy.get_world_pool().data()[row]);
+		case column_changed:
+			return QString::number(m_hierarchy.get_ticks().data()[row].world_changed);
+		default:
+			return {};
+		}
+	}
+
+	QVariant EntityInspectorModel::headerData(const int section, const Qt::Orientation orientation, const int role) const
+	{
+		if (orientation != Qt::Horizontal || role != Qt::DisplayRole)
+		{
+			return {};
+		}
+
+		switch (section)
+		{
+		case column_entity:
+			return tr("Entity");
+		case column_parent:
+			return tr("Parent");
+		case column_depth:
+			return tr("Depth");
+		case column_local_position:
+			return tr("Local Position");
+		case column_world_position:
+			return tr("World Position");
+		case column_changed:
+			return tr("Changed");
+		default:
+			return {};
+		}
+	}
+
+	bool EntityInspectorModel::canFetchMore(const QModelIndex& parent) const
+	{
+		return !parent.isValid() && m_fetched_rows < get_entity_count();
+	}
+
+	void EntityInspectorModel::fetchMore(const QModelIndex& parent)
+	{
+		if (parent.isValid())
+		{
+			return;
+		}
+
+		const auto fetched_rows = std::min(get_entity_count(), m_fetched_rows + k_fetch_batch_size);
+		if (fetched_rows == m_fetched_rows)
+		{
+			return;
+		}
+
+		beginInsertRows({}, m_fetched_rows, fetched_rows - 1);
+		m_fetched_rows = fetched_rows;
+		endInsertRows();
+	}
+
+	int EntityInspectorModel::get_entity_count() const noexcept
+	{
+		return static_cast<int>(std::min<std::size_t>(m_hierarchy.size(), static_cast<std::size_t>(std::numeric_limits<int>::max())));
+	}
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <QtCore/QAbstractItemModel>
+
+#include "Sigma/Engine/Scene/TransformHierarchy.hpp"
+
+namespace sigma::editor
+{
+	// Flat model with one row per entity in the dense order of the hierarchy pools and one column per component
+	// field. Rows read the dense arrays on demand, nothing is copied per entity. Rows are exposed in batches as the
+	// view scrolls, and refresh() turns the tick changes since the previous call into a single dataChanged range
+	// instead of resetting the model.
+	class EntityInspectorModel final : public QAbstractItemModel
+	{
+		Q_OBJECT
+	public:
+		enum Column
+		{
+			column_entity,
+			column_parent,
+			column_depth,
+			column_local_position,
+			column_world_position,
+			column_changed,
+			column_count
+		};
+
+		static constexpr int k_fetch_batch_size = 65536;
+
+		explicit EntityInspectorModel(const TransformHierarchy& hierarchy, QObject* parent = nullptr);
+
+		// Call after the hierarchy has been updated
+		void refresh();
+
+		[[nodiscard]] QModelIndex index(int row, int column, const QModelIndex& parent = {}) const override;
+		[[nodiscard]] QModelIndex parent(const QModelIndex& child) const override;
+		[[nodiscard]] int rowCount(const QModelIndex& parent = {}) const override;
+		[[nodiscard]] int columnCount(const QModelIndex& parent = {}) const override;
+		[[nodiscard]] QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+		[[nodiscard]] QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+		[[nodiscard]] bool canFetchMore(const QModelIndex& parent) const override;
+		void fetchMore(const QModelIndex& parent) override;
+	private:
+		[[nodiscard]] int get_entity_count() const noexcept;
+
+		const TransformHierarchy& m_hierarchy;
+		int m_fetched_rows{};
+		UInt64 m_refreshed_tick{};
+		UInt64 m_structure_tick{};
+	};
+}
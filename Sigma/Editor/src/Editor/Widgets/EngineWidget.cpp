@@ -3,16 +3,37 @@
 namespace sigma::editor
 {
 	EngineWidget::EngineWidget(QWidget* parent)
-		: QWidget(parent){}
-
-	QPaintEngine* EngineWidget::paintEngine() const
+		: QWidget(parent)
 	{
-		// TODO: This need to be overwritten if context is DirectX otherwise need to be here for OpenGL
-		return nullptr;
+		setAttribute(Qt::WA_OpaquePaintEvent);
 	}
 
 	WId EngineWidget::get_window_handle() const noexcept
 	{
 		return winId();
 	}
+
+	void EngineWidget::present(const RenderTarget& target)
+	{
+		const QImage view{
+			reinterpret_cast<const uchar*>(target.get_color_data()),
+			static_cast<int>(target.get_width()),
+			static_cast<int>(target.get_height()),
+			static_cast<int>(target.get_stride() * sizeof(UInt32)),
+			QImage::Format_RGB32
+		};
+		m_frame = view.copy();
+		update();
+	}
+
+	void EngineWidget::paintEvent(QPaintEvent*)
+	{
+		QPainter painter{ this };
+		if (m_frame.isNull())
+		{
+			painter.fillRect(rect(), Qt::black);
+			return;
+		}
+		painter.drawImage(rect(), m_frame);
+	}
 }
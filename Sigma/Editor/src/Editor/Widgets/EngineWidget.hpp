@@ -2,6 +2,8 @@
 
 #include <QtWidgets>
 
+#include "Sigma/Engine/Rendering/RenderTarget.hpp"
+
 namespace sigma::editor
 {
 	class EngineWidget final: public QWidget
@@ -10,8 +12,13 @@ namespace sigma::editor
 	public:
 		explicit EngineWidget(QWidget* parent);
 
-		[[nodsicard]] WId get_window_handle() const noexcept;
+		[[nodiscard]] WId get_window_handle() const noexcept;
+
+		// Copies the visible part of the target so rendering can carry on into it while the widget repaints
+		void present(const RenderTarget& target);
 	protected:
-		QPaintEngine* paintEngine() const override;
+		void paintEvent(QPaintEvent* event) override;
+	private:
+		QImage m_frame{};
 	};
 }
@@ -0,0 +1,168 @@
+#include "PerformanceWidget.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace sigma::editor
+{
+	namespace
+	{
+		constexpr int k_graph_height = 120;
+		constexpr int k_row_height = 16;
+		constexpr int k_margin = 6;
+		constexpr double k_graph_range_ms = 50.0;
+		constexpr double k_nanoseconds_per_millisecond = 1'000'000.0;
+		constexpr double k_bytes_per_megabyte = 1024.0 * 1024.0;
+
+		double smooth(const double previous, const double sample, const double weight) noexcept
+		{
+			return previous + (sample - previous) * weight;
+		}
+	}
+
+	PerformanceWidget::PerformanceWidget(QWidget* parent)
+		: QWidget(parent)
+	{
+		setAttribute(Qt::WA_OpaquePaintEvent);
+		setMinimumHeight(k_graph_height + 4 * k_margin);
+		m_graph_points.reserve(static_cast<int>(k_history_size));
+	}
+
+	void PerformanceWidget::consume(Profiler& profiler)
+	{
+		ProfileSample sample{};
+		while (profiler.try_pop(sample))
+		{
+			const auto milliseconds = static_cast<double>(sample.value) / k_nanoseconds_per_millisecond;
+			switch (sample.type)
+			{
+			case ProfileSampleType::frame:
+				m_last_frame_time = milliseconds;
+				m_frame_times[m_history_head] = milliseconds;
+				m_history_head = (m_history_head + 1) % k_history_size;
+				m_history_count = std::min(m_history_count + 1, k_history_size);
+				break;
+			case ProfileSampleType::scope:
+			{
+				auto& scope = find_or_add(m_scopes, sample.name);
+				scope.value = smooth(scope.value, milliseconds, k_smoothing);
+				scope.peak = std::max(scope.peak * (1.0 - k_smoothing), milliseconds);
+				break;
+			}
+			case ProfileSampleType::memory:
+			{
+				auto& memory = find_or_add(m_memory, sample.name);
+				memory.value = static_cast<double>(sample.value) / k_bytes_per_megabyte;
+				memory.peak = std::max(memory.peak, memory.value);
+				break;
+			}
+			case ProfileSampleType::worker:
+				// Workers follow the frame sample of the same interval
+				if (sample.thread >= m_worker_utilization.size())
+				{
+					m_worker_utilization.resize(sample.thread + 1, 0.0);
+				}
+				if (m_last_frame_time > 0.0)
+				{
+					const auto utilization = std::min(milliseconds / m_last_frame_time, 1.0);
+					auto& smoothed = m_worker_utilization[sample.thread];
+					smoothed = smooth(smoothed, utilization, k_smoothing);
+				}
+				break;
+			}
+		}
+
+		m_dropped_count = profiler.get_dropped_count();
+		update();
+	}
+
+	void PerformanceWidget::paintEvent(QPaintEvent*)
+	{
+		QPainter painter{ this };
+		painter.fillRect(rect(), QColor{ 0x1e, 0x1e, 0x1e });
+		painter.setPen(QColor{ 0xf0, 0xf0, 0xf0 });
+
+		const QRect graph_area{ k_margin, k_margin, width() - 2 * k_margin, k_graph_height };
+		paint_graph(painter, graph_area);
+
+		auto top = graph_area.bottom() + k_margin + k_row_height;
+		painter.setPen(QColor{ 0xf0, 0xf0, 0xf0 });
+		painter.drawText(k_margin, top, QStringLiteral("Frame %1 ms, dropped samples %2")
+			.arg(m_last_frame_time, 0, 'f', 2)
+			.arg(m_dropped_count));
+		top += k_row_height;
+
+		top = paint_rows(painter, top, tr("Scopes"), m_scopes, "ms");
+		top = paint_rows(painter, top, tr("Memory"), m_memory, "MB");
+
+		painter.drawText(k_margin, top, tr("Workers"));
+		top += k_row_height;
+		const auto bar_width = std::max(width() - 2 * k_margin - 80, 0);
+		for (std::size_t worker = 0; worker < m_worker_utilization.size(); ++worker)
+		{
+			const auto utilization = m_worker_utilization[worker];
+			painter.drawText(k_margin, top, QStringLiteral("#%1").arg(worker));
+			painter.fillRect(k_margin + 40, top - k_row_height + 4, static_cast<int>(bar_width * utilization), k_row_height - 4, QColor{ 0x3d, 0x8e, 0xe0 });
+			painter.drawText(k_margin + 40 + bar_width + 4, top, QStringLiteral("%1%").arg(utilization * 100.0, 0, 'f', 0));
+			top += k_row_height;
+		}
+	}
+
+	PerformanceWidget::NamedValue& PerformanceWidget::find_or_add(std::vector<NamedValue>& values, const char* name)
+	{
+		// Names are usually literals, so pointer equality settles nearly every lookup
+		const auto found = std::find_if(values.begin(), values.end(), [name](const NamedValue& value)
+		{
+			return value.name == name || std::strcmp(value.name, name) == 0;
+		});
+		if (found != values.end())
+		{
+			return *found;
+		}
+		return values.emplace_back(NamedValue{ name, 0.0, 0.0 });
+	}
+
+	void PerformanceWidget::paint_graph(QPainter& painter, const QRect& area)
+	{
+		painter.fillRect(area, QColor{ 0x14, 0x14, 0x14 });
+
+		const auto to_y = [&](const double milliseconds)
+		{
+			return area.bottom() - std::min(milliseconds / k_graph_range_ms, 1.0) * area.height();
+		};
+
+		// 60 and 30 fps budgets
+		painter.setPen(QColor{ 0x40, 0x80, 0x40 });
+		painter.drawLine(QPointF(area.left(), to_y(1000.0 / 60.0)), QPointF(area.right(), to_y(1000.0 / 60.0)));
+		painter.setPen(QColor{ 0x80, 0x40, 0x40 });
+		painter.drawLine(QPointF(area.left(), to_y(1000.0 / 30.0)), QPointF(area.right(), to_y(1000.0 / 30.0)));
+
+		m_graph_points.clear();
+		const auto step = static_cast<double>(area.width()) / static_cast<double>(k_history_size - 1);
+		const auto first = (m_history_head + k_history_size - m_history_count) % k_history_size;
+		for (std::size_t sample = 0; sample < m_history_count; ++sample)
+		{
+			const auto x = area.right() - static_cast<double>(m_history_count - 1 - sample) * step;
+			m_graph_points.append(QPointF(x, to_y(m_frame_times[(first + sample) % k_history_size])));
+		}
+
+		painter.setPen(QColor{ 0xf0, 0xc0, 0x40 });
+		painter.drawPolyline(m_graph_points.constData(), m_graph_points.size());
+	}
+
+	int PerformanceWidget::paint_rows(QPainter& painter, int top, const QString& title, const std::vector<NamedValue>& values, const char* unit)
+	{
+		painter.drawText(k_margin, top, title);
+		top += k_row_height;
+		for (const auto& value : values)
+		{
+			painter.drawText(k_margin + 12, top, QStringLiteral("%1: %2 %4 (peak %3 %4)")
+				.arg(QString::fromUtf8(value.name))
+				.arg(value.value, 0, 'f', 2)
+				.arg(value.peak, 0, 'f', 2)
+				.arg(QString::fromUtf8(unit)));
+			top += k_row_height;
+		}
+		return top + k_row_height / 2;
+	}
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include <QtWidgets>
+
+#include "Sigma/Engine/Profiling/Profiler.hpp"
+
+namespace sigma::editor
+{
+	// Frame-time graph plus per-scope timings, memory and worker utilization. Samples are folded into fixed arrays
+	// as they are drained and painted straight from those, so no Qt object is created per sample.
+	class PerformanceWidget final : public QWidget
+	{
+		Q_OBJECT
+	public:
+		static constexpr std::size_t k_history_size = 240;
+		// Weight of the newest sample in the smoothed values
+		static constexpr double k_smoothing = 0.1;
+
+		explicit PerformanceWidget(QWidget* parent);
+
+		// Drains every pending sample of the profiler, must be called from the GUI thread
+		void consume(Profiler& profiler);
+	protected:
+		void paintEvent(QPaintEvent* event) override;
+	private:
+		struct NamedValue
+		{
+			const char* name{};
+			double value{};
+			double peak{};
+		};
+
+		static NamedValue& find_or_add(std::vector<NamedValue>& values, const char* name);
+
+		void paint_graph(QPainter& painter, const QRect& area);
+		int paint_rows(QPainter& painter, int top, const QString& title, const std::vector<NamedValue>& values, const char* unit);
+
+		std::array<double, k_history_size> m_frame_times{};
+		std::size_t m_history_head{};
+		std::size_t m_history_count{};
+		std::vector<NamedValue> m_scopes{};
+		std::vector<NamedValue> m_memory{};
+		std::vector<double> m_worker_utilization{};
+		double m_last_frame_time{};
+		UInt64 m_dropped_count{};
+		QVector<QPointF> m_graph_points{};
+	};
+}
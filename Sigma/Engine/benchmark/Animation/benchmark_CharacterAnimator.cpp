@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include <Sigma/Engine/Animation/CharacterAnimator.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	constexpr std::size_t k_bone_count = 64;
+	constexpr std::size_t k_frame_count = 60;
+	constexpr std::size_t k_character_count = 4096;
+
+	const Skeleton& get_skeleton()
+	{
+		static const auto skeleton = []()
+		{
+			std::vector<Int32> parents(k_bone_count);
+			std::vector<Matrix4x4> inverse_bind(k_bone_count);
+			for (std::size_t bone = 0; bone < k_bone_count; ++bone)
+			{
+				parents[bone] = static_cast<Int32>(bone) - 1;
+				DirectX::XMStoreFloat4x4(&inverse_bind[bone], DirectX::XMMatrixTranslation(-static_cast<Float>(bone), 0.0f, 0.0f));
+			}
+			return Skeleton{ std::move(parents), std::move(inverse_bind) };
+		}();
+		return skeleton;
+	}
+
+	AnimationClip make_clip(const Float speed)
+	{
+		std::vector<BoneTransform> frames{};
+		for (std::size_t frame = 0; frame < k_frame_count; ++frame)
+		{
+			for (std::size_t bone = 0; bone < k_bone_count; ++bone)
+			{
+				const auto angle = std::sin(static_cast<Float>(frame) * speed + static_cast<Float>(bone)) * 0.25f;
+				frames.push_back({ { std::sin(angle), 0.0f, 0.0f, std::cos(angle) }, { 1.0f, 0.0f, 0.0f } });
+			}
+		}
+		return AnimationClip{ k_bone_count, 30.0f, frames };
+	}
+
+	JobSystem& get_job_system()
+	{
+		static JobSystem job_system{};
+		return job_system;
+	}
+}
+
+static void character_animation_update(benchmark::State& state)
+{
+	const auto walk = make_clip(0.1f);
+	const auto run = make_clip(0.2f);
+	CharacterAnimator animator{};
+	for (std::size_t character = 0; character < k_character_count; ++character)
+	{
+		animator.add({ &get_skeleton(), &walk, static_cast<Float>(character) * 0.01f, &run, 0.0f, 0.5f });
+	}
+
+	for (auto _ : state)
+	{
+		for (std::size_t character = 0; character < k_character_count; ++character)
+		{
+			auto& animation = animator.get_animation(character);
+			animation.time += 1.0f / 60.0f;
+			animation.blend_time += 1.0f / 60.0f;
+		}
+		animator.update(get_job_system());
+		benchmark::DoNotOptimize(animator.get_palette(0).data());
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(k_character_count * k_bone_count));
+}
+BENCHMARK(character_animation_update)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void pose_blend(benchmark::State& state)
+{
+	Pose from{ k_bone_count };
+	Pose to{ k_bone_count };
+	Pose result{ k_bone_count };
+	for (auto _ : state)
+	{
+		Pose::blend(from, to, 0.3f, result);
+		benchmark::DoNotOptimize(result.get_stream(Pose::rotation_x));
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(k_bone_count));
+}
+BENCHMARK(pose_blend);
\ No newline at end of file
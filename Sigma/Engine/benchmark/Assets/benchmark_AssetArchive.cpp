@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <fstream>
+#include <string>
+
+#include <Sigma/Engine/Assets/AssetStreamer.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	constexpr std::size_t k_asset_count = 2000;
+	constexpr std::size_t k_asset_size = 2048;
+
+	// Many small assets, written both as loose files and as one archive
+	struct AssetSet
+	{
+		std::filesystem::path directory{};
+		std::filesystem::path archive{};
+
+		AssetSet()
+		{
+			directory = std::filesystem::temp_directory_path() / "sigma_benchmark_assets";
+			archive = std::filesystem::temp_directory_path() / "sigma_benchmark_assets.sgar";
+			std::filesystem::create_directories(directory);
+
+			AssetArchiveWriter writer{};
+			std::string content(k_asset_size, '\0');
+			for (std::size_t index = 0; index < k_asset_count; ++index)
+			{
+				for (std::size_t offset = 0; offset < content.size(); ++offset)
+				{
+					content[offset] = static_cast<char>('a' + (index + offset / 7) % 26);
+				}
+				const auto name = std::to_string(index) + ".bin";
+				std::ofstream{ directory / name, std::ios::binary }.write(content.data(), static_cast<std::streamsize>(content.size()));
+				static_cast<void>(writer.add(make_asset_id(name), std::as_bytes(std::span{ content.data(), content.size() }), Compression::lz4));
+			}
+			static_cast<void>(writer.write(archive));
+		}
+	};
+
+	const AssetSet& get_asset_set()
+	{
+		static const AssetSet asset_set{};
+		return asset_set;
+	}
+}
+
+static void asset_loose_files(benchmark::State& state)
+{
+	const auto& asset_set = get_asset_set();
+	std::vector<char> buffer(k_asset_size);
+	for (auto _ : state)
+	{
+		for (std::size_t index = 0; index < k_asset_count; ++index)
+		{
+			std::ifstream file{ asset_set.directory / (std::to_string(index) + ".bin"), std::ios::binary };
+			file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+			benchmark::DoNotOptimize(buffer.data());
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<Int64>(k_asset_count));
+}
+BENCHMARK(asset_loose_files)->Unit(benchmark::kMillisecond);
+
+static void asset_archive_streamed(benchmark::State& state)
+{
+	const auto& asset_set = get_asset_set();
+	AssetArchive archive{};
+	static_cast<void>(archive.open(asset_set.archive));
+	JobSystem job_system{};
+	AssetStreamer streamer{ archive, job_system };
+
+	std::vector<AssetId> ids(k_asset_count);
+	for (std::size_t index = 0; index < k_asset_count; ++index)
+	{
+		ids[index] = make_asset_id(std::to_string(index) + ".bin");
+	}
+
+	std::atomic<std::size_t> loaded_bytes{};
+	for (auto _ : state)
+	{
+		for (const auto id : ids)
+		{
+			streamer.request(id, 0, [&](AssetId, AssetStatus, const AssetData data) { loaded_bytes += data.get_bytes().size(); });
+		}
+		streamer.wait_idle();
+	}
+	benchmark::DoNotOptimize(loaded_bytes.load());
+	state.SetItemsProcessed(state.iterations() * static_cast<Int64>(k_asset_count));
+}
+BENCHMARK(asset_archive_streamed)->Unit(benchmark::kMillisecond);
\ No newline at end of file
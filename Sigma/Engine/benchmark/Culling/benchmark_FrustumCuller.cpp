@@ -0,0 +1,129 @@
+#include <benchmark/benchmark.h>
+
+#include <numeric>
+#include <random>
+
+#include <Sigma/Engine/Culling/FrustumCuller.hpp>
+#include <Sigma/Engine/Culling/OcclusionBuffer.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	constexpr auto k_world_extent = 1'000.0f;
+	constexpr auto k_object_count = std::size_t{ 1'000'000 };
+
+	Matrix4x4 make_view_projection()
+	{
+		const auto view = DirectX::XMMatrixLookAtLH(DirectX::XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f), DirectX::XMVectorSet(0.0f, 0.0f, 1.0f, 1.0f), DirectX::XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f));
+		const auto projection = DirectX::XMMatrixPerspectiveFovLH(DirectX::XM_PIDIV2, 16.0f / 9.0f, 0.1f, k_world_extent);
+
+		Matrix4x4 result{};
+		DirectX::XMStoreFloat4x4(&result, DirectX::XMMatrixMultiply(view, projection));
+		return result;
+	}
+
+	const CullingBounds& get_bounds()
+	{
+		static const auto bounds = []()
+		{
+			std::mt19937 generator{ 3 };
+			std::uniform_real_distribution<float> position{ -k_world_extent, k_world_extent };
+			std::uniform_real_distribution<float> half_extent{ 0.25f, 2.0f };
+
+			CullingBounds result{ k_object_count };
+			for (std::size_t entity = 0; entity < k_object_count; ++entity)
+			{
+				const Vector3 center{ position(generator), position(generator), position(generator) };
+				result.set(entity, expand({ center, center }, half_extent(generator)));
+			}
+			return result;
+		}();
+		return bounds;
+	}
+
+	JobSystem& get_job_system()
+	{
+		static JobSystem job_system{};
+		return job_system;
+	}
+
+	void run_frustum_cull(benchmark::State& state, const CullingVolume volume)
+	{
+		const auto& bounds = get_bounds();
+		const auto frustum = make_frustum(make_view_projection());
+		FrustumCuller culler{};
+		std::vector<UInt32> visible{};
+
+		for (auto _ : state)
+		{
+			culler.cull(bounds, frustum, volume, visible, get_job_system());
+			benchmark::DoNotOptimize(visible.data());
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(bounds.size()));
+	}
+
+	void run_frustum_cull_single_thread(benchmark::State& state, const CullingVolume volume)
+	{
+		const auto& bounds = get_bounds();
+		const auto frustum = make_frustum(make_view_projection());
+		std::vector<UInt32> visible(bounds.size());
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(FrustumCuller::cull(bounds.get_streams(), frustum, volume, 0, bounds.size(), visible.data()));
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(bounds.size()));
+	}
+}
+
+static void frustum_cull_spheres(benchmark::State& state)
+{
+	run_frustum_cull(state, CullingVolume::sphere);
+}
+BENCHMARK(frustum_cull_spheres)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void frustum_cull_boxes(benchmark::State& state)
+{
+	run_frustum_cull(state, CullingVolume::box);
+}
+BENCHMARK(frustum_cull_boxes)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void frustum_cull_spheres_single_thread(benchmark::State& state)
+{
+	run_frustum_cull_single_thread(state, CullingVolume::sphere);
+}
+BENCHMARK(frustum_cull_spheres_single_thread)->Unit(benchmark::kMillisecond);
+
+static void frustum_cull_boxes_single_thread(benchmark::State& state)
+{
+	run_frustum_cull_single_thread(state, CullingVolume::box);
+}
+BENCHMARK(frustum_cull_boxes_single_thread)->Unit(benchmark::kMillisecond);
+
+static void occlusion_cull(benchmark::State& state)
+{
+	const auto& bounds = get_bounds();
+	const auto view_projection = make_view_projection();
+	FrustumCuller culler{};
+	std::vector<UInt32> frustum_visible{};
+	culler.cull(bounds, make_frustum(view_projection), CullingVolume::box, frustum_visible, get_job_system());
+
+	OcclusionBuffer buffer{ 256, 144 };
+	std::vector<UInt32> visible{};
+	for (auto _ : state)
+	{
+		buffer.clear(view_projection);
+		for (auto z = 20.0f; z < 200.0f; z += 30.0f)
+		{
+			buffer.add_occluder(Aabb{ { -z * 0.5f, -20.0f, z }, { z * 0.25f, 20.0f, z + 4.0f } });
+		}
+		buffer.finalize();
+
+		visible = frustum_visible;
+		buffer.cull(bounds, visible, get_job_system());
+		benchmark::DoNotOptimize(visible.data());
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(frustum_visible.size()));
+}
+BENCHMARK(occlusion_cull)->Unit(benchmark::kMillisecond)->UseRealTime();
\ No newline at end of file
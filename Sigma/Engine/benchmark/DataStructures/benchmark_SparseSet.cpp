@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+
+#include <numeric>
+#include <vector>
+
+#include <Sigma/Engine/DataStructures/Iterators/random_access_iterator.hpp>
+#include <Sigma/Engine/DataStructures/SparseSet.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	struct Particle
+	{
+		Float position{};
+		Float velocity{};
+	};
+
+	SparseSet<Float> make_values(const std::size_t count)
+	{
+		SparseSet<Float> set{ count };
+		for (std::size_t index = 0; index < count; ++index)
+		{
+			set.emplace(index, static_cast<Float>(index % 7));
+		}
+		return set;
+	}
+
+	SparseSet<Particle> make_particles(const std::size_t count)
+	{
+		SparseSet<Particle> set{ count };
+		for (std::size_t index = 0; index < count; ++index)
+		{
+			set.emplace(index, Particle{ 0.0f, static_cast<Float>(index % 5) });
+		}
+		return set;
+	}
+}
+
+// Counting keeps the reduction in integers, so it can be vectorized without fast-math
+static void sparse_set_count_contiguous_iterator(benchmark::State& state)
+{
+	auto set = make_values(static_cast<std::size_t>(state.range(0)));
+	for (auto _ : state)
+	{
+		Int32 count = 0;
+		for (const auto value : set)
+		{
+			count += value > 3.0f ? 1 : 0;
+		}
+		benchmark::DoNotOptimize(count);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(sparse_set_count_contiguous_iterator)->Arg(4'096)->Arg(1'000'000)->Unit(benchmark::kMicrosecond);
+
+// Container-and-offset iterators index the vector on every access, the baseline the contiguous iterators replace
+static void sparse_set_count_indexed_iterator(benchmark::State& state)
+{
+	auto set = make_values(static_cast<std::size_t>(state.range(0)));
+	std::vector<Float> dense(set.begin(), set.end());
+	using Iterator = ConstRandomAccessIterator<std::vector<Float>, Float, std::size_t>;
+	for (auto _ : state)
+	{
+		Int32 count = 0;
+		for (auto iterator = Iterator{ dense, 0 }, end = Iterator{ dense, dense.size() }; iterator != end; ++iterator)
+		{
+			count += *iterator > 3.0f ? 1 : 0;
+		}
+		benchmark::DoNotOptimize(count);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(sparse_set_count_indexed_iterator)->Arg(4'096)->Arg(1'000'000)->Unit(benchmark::kMicrosecond);
+
+static void sparse_set_integrate_span(benchmark::State& state)
+{
+	auto set = make_particles(static_cast<std::size_t>(state.range(0)));
+	for (auto _ : state)
+	{
+		for (auto& particle : set.get_elements())
+		{
+			particle.position += particle.velocity * 0.016f;
+		}
+		benchmark::DoNotOptimize(set.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(sparse_set_integrate_span)->Arg(4'096)->Arg(1'000'000)->Unit(benchmark::kMicrosecond);
\ No newline at end of file
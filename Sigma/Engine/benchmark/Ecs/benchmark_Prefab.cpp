@@ -0,0 +1,113 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <memory>
+#include <string>
+
+#include <Sigma/Engine/Ecs/World.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	struct Transform { Matrix4x4 world{}; };
+	struct Velocity { Float x{}; Float y{}; Float z{}; };
+	struct Agent { Float speed{}; Float radius{}; UInt32 state{}; };
+	struct Attachment
+	{
+		static constexpr auto get_entity_references() noexcept
+		{
+			return std::array{ &Attachment::parent };
+		}
+
+		Entity parent{ k_null_entity };
+		UInt32 bone{};
+	};
+	struct Name { std::string value{}; };
+
+	using CrowdWorld = World<Transform, Velocity, Agent, Attachment, Name>;
+	using CrowdPrefab = Prefab<Transform, Velocity, Agent, Attachment, Name>;
+
+	constexpr std::size_t k_crowd_size = 10000;
+
+	// One agent with two attached props
+	CrowdPrefab make_agent()
+	{
+		CrowdPrefab prefab{};
+		const auto body = prefab.create();
+		prefab.emplace<Transform>(body);
+		prefab.emplace<Velocity>(body, 1.0f, 0.0f, 0.0f);
+		prefab.emplace<Agent>(body, 1.5f, 0.4f, 0u);
+		prefab.emplace<Name>(body, "crowd_agent");
+		for (UInt32 bone = 0; bone < 2; ++bone)
+		{
+			const auto prop = prefab.create();
+			prefab.emplace<Transform>(prop);
+			prefab.emplace<Attachment>(prop, body, bone);
+		}
+		return prefab;
+	}
+
+	JobSystem& get_job_system()
+	{
+		static JobSystem job_system{};
+		return job_system;
+	}
+}
+
+// Spawning a crowd of agents the usual way, one entity and one component at a time
+static void spawn_crowd_per_entity(benchmark::State& state)
+{
+	const auto prefab = make_agent();
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		auto world = std::make_unique<CrowdWorld>(k_crowd_size * prefab.size());
+		state.ResumeTiming();
+
+		for (std::size_t copy = 0; copy < k_crowd_size; ++copy)
+		{
+			const auto body = world->create();
+			world->emplace<Transform>(body);
+			world->emplace<Velocity>(body, 1.0f, 0.0f, 0.0f);
+			world->emplace<Agent>(body, 1.5f, 0.4f, 0u);
+			world->emplace<Name>(body, "crowd_agent");
+			for (UInt32 bone = 0; bone < 2; ++bone)
+			{
+				const auto prop = world->create();
+				world->emplace<Transform>(prop);
+				world->emplace<Attachment>(prop, body, bone);
+			}
+		}
+		benchmark::DoNotOptimize(world->size());
+
+		state.PauseTiming();
+		world.reset();
+		state.ResumeTiming();
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(k_crowd_size * prefab.size()));
+}
+
+BENCHMARK(spawn_crowd_per_entity)->Unit(benchmark::kMillisecond);
+
+static void spawn_crowd_instantiate(benchmark::State& state)
+{
+	const auto prefab = make_agent();
+	std::vector<Entity> entities{};
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		auto world = std::make_unique<CrowdWorld>(k_crowd_size * prefab.size());
+		state.ResumeTiming();
+
+		world->instantiate(prefab, k_crowd_size, entities, get_job_system());
+		benchmark::DoNotOptimize(world->size());
+
+		state.PauseTiming();
+		world.reset();
+		state.ResumeTiming();
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(k_crowd_size * prefab.size()));
+}
+
+BENCHMARK(spawn_crowd_instantiate)->Unit(benchmark::kMillisecond);
\ No newline at end of file
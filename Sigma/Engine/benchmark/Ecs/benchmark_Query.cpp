@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+
+#include <Sigma/Engine/Ecs/Query.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	struct Position { Float x{}; Float y{}; Float z{}; };
+	struct Velocity { Float x{}; Float y{}; Float z{}; };
+	struct Frozen {};
+	struct Mass { Float value{ 1.0f }; };
+
+	using BenchmarkWorld = World<Position, Velocity, Frozen, Mass>;
+
+	// Every entity moves, every second one has a mass and every eighth one is frozen
+	void populate(BenchmarkWorld& world, const std::size_t count)
+	{
+		for (std::size_t index = 0; index < count; ++index)
+		{
+			const auto entity = world.create();
+			world.emplace<Position>(entity);
+			world.emplace<Velocity>(entity, 1.0f, 2.0f, 3.0f);
+			if (index % 2 == 0)
+			{
+				world.emplace<Mass>(entity, 2.0f);
+			}
+			if (index % 8 == 0)
+			{
+				world.emplace<Frozen>(entity);
+			}
+		}
+	}
+}
+
+static void query_hand_written(benchmark::State& state)
+{
+	const auto count = static_cast<std::size_t>(state.range(0));
+	BenchmarkWorld world{ count };
+	populate(world, count);
+
+	const auto& masses = world.get_pool<Mass>();
+	const auto& frozen = world.get_pool<Frozen>();
+	for (auto _ : state)
+	{
+		const auto& entities = masses.get_indices();
+		for (std::size_t position = 0; position < entities.size(); ++position)
+		{
+			const auto entity = entities[position];
+			if (frozen.has_element(entity))
+			{
+				continue;
+			}
+			const auto* const velocity = world.try_get<Velocity>(entity);
+			auto* const target = world.try_get<Position>(entity);
+			if (velocity == nullptr || target == nullptr)
+			{
+				continue;
+			}
+			const auto scale = masses.data()[position].value * 0.016f;
+			target->x += velocity->x * scale;
+			target->y += velocity->y * scale;
+			target->z += velocity->z * scale;
+		}
+		benchmark::DoNotOptimize(world.get_pool<Position>().data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(query_hand_written)->Arg(10'000)->Arg(100'000)->Arg(1'000'000)->Unit(benchmark::kMicrosecond);
+
+static void query_include_exclude(benchmark::State& state)
+{
+	const auto count = static_cast<std::size_t>(state.range(0));
+	BenchmarkWorld world{ count };
+	populate(world, count);
+
+	for (auto _ : state)
+	{
+		Query<Include<Position, const Velocity, const Mass>, Exclude<Frozen>> query{ world };
+		query.each([](Entity, Position& position, const Velocity& velocity, const Mass& mass)
+		{
+			const auto scale = mass.value * 0.016f;
+			position.x += velocity.x * scale;
+			position.y += velocity.y * scale;
+			position.z += velocity.z * scale;
+		});
+		benchmark::DoNotOptimize(world.get_pool<Position>().data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(query_include_exclude)->Arg(10'000)->Arg(100'000)->Arg(1'000'000)->Unit(benchmark::kMicrosecond);
\ No newline at end of file
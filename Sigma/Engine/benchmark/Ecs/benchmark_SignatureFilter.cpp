@@ -0,0 +1,113 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <Sigma/Engine/Ecs/Query.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	template <std::size_t Index>
+	struct Field
+	{
+		Float value{};
+	};
+
+	template <typename Sequence>
+	struct FieldSet;
+
+	template <std::size_t... Indices>
+	struct FieldSet<std::index_sequence<Indices...>>
+	{
+		using world_type = World<Field<Indices>...>;
+		using query_type = Query<Include<const Field<Indices>...>>;
+	};
+
+	constexpr std::size_t k_field_count = 24;
+	constexpr std::size_t k_query_field_count = 20;
+
+	using BenchmarkWorld = FieldSet<std::make_index_sequence<k_field_count>>::world_type;
+	using BroadQuery = FieldSet<std::make_index_sequence<k_query_field_count>>::query_type;
+
+	// Every entity has all fields but one, which is one of the queried fields for a quarter of them
+	void populate(BenchmarkWorld& world, const std::size_t count)
+	{
+		for (std::size_t index = 0; index < count; ++index)
+		{
+			const auto entity = world.create();
+			const auto missing = index % 4 == 0 ? index % k_query_field_count : k_field_count - 1;
+			for_each_type(BenchmarkWorld::component_types::list_type{}, [&]<typename Component>(std::type_identity<Component>)
+			{
+				if (BenchmarkWorld::component_types::template id<Component> != missing)
+				{
+					world.emplace<Component>(entity, 1.0f);
+				}
+			});
+		}
+	}
+
+	template <bool UseSignatures>
+	void run_broad_query(benchmark::State& state)
+	{
+		const auto count = static_cast<std::size_t>(state.range(0));
+		BenchmarkWorld world{ count, UseSignatures };
+		populate(world, count);
+
+		for (auto _ : state)
+		{
+			Float sum = 0.0f;
+			BroadQuery query{ world };
+			query.each([&](Entity, const auto&... fields) { sum += (fields.value + ...); });
+			benchmark::DoNotOptimize(sum);
+		}
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+}
+
+static void signature_filter(benchmark::State& state)
+{
+	constexpr std::size_t k_entity_count = 1'000'000;
+	const auto word_count = static_cast<std::size_t>(state.range(0));
+
+	std::mt19937_64 generator{ 3 };
+	std::vector<UInt64> signatures(k_entity_count * word_count);
+	for (auto& signature : signatures)
+	{
+		signature = generator() | generator() | generator();
+	}
+
+	// Twenty included components spread over every word, two excluded
+	UInt64 include[4]{};
+	UInt64 exclude[4]{};
+	for (std::size_t bit = 0; bit < 20; ++bit)
+	{
+		const auto component = bit * 13 % (word_count * 64);
+		include[component / 64] |= UInt64{ 1 } << (component % 64);
+	}
+	exclude[0] |= UInt64{ 1 } << 63;
+	exclude[word_count - 1] |= UInt64{ 1 } << 62;
+
+	std::vector<Entity> matches(k_entity_count);
+	for (auto _ : state)
+	{
+		const auto count = filter_signatures(signatures.data(), word_count, include, exclude, 0, k_entity_count, matches.data());
+		benchmark::DoNotOptimize(count);
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(k_entity_count));
+}
+BENCHMARK(signature_filter)->Arg(1)->Arg(2)->Arg(4)->Unit(benchmark::kMicrosecond);
+
+static void query_broad_pool_probes(benchmark::State& state)
+{
+	run_broad_query<false>(state);
+}
+BENCHMARK(query_broad_pool_probes)->Arg(100'000)->Unit(benchmark::kMicrosecond);
+
+static void query_broad_signature_scan(benchmark::State& state)
+{
+	run_broad_query<true>(state);
+}
+BENCHMARK(query_broad_signature_scan)->Arg(100'000)->Unit(benchmark::kMicrosecond);
\ No newline at end of file
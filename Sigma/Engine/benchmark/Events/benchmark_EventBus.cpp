@@ -0,0 +1,85 @@
+#include <benchmark/benchmark.h>
+
+#include <Sigma/Engine/Events/EventBus.hpp>
+#include <Sigma/Engine/Jobs/JobSystem.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	struct Collision
+	{
+		Entity first{};
+		Entity second{};
+		Float impulse{};
+	};
+
+	struct Spawn
+	{
+		Entity entity{};
+	};
+
+	using Bus = EventBus<Collision, Spawn>;
+
+	struct ImpulseSum
+	{
+		void on_collisions(const std::span<const Collision> events) noexcept
+		{
+			for (const auto& event : events)
+			{
+				total += event.impulse;
+			}
+		}
+
+		Float total{};
+	};
+
+	JobSystem& get_job_system()
+	{
+		static JobSystem job_system{};
+		return job_system;
+	}
+}
+
+// One frame of collision events: workers publish their share in parallel, then the phase drains them in one batch
+static void publish_and_dispatch(benchmark::State& state)
+{
+	const auto event_count = static_cast<std::size_t>(state.range(0));
+	Bus bus{ event_count };
+	ImpulseSum sum{};
+	bus.subscribe<Collision, &ImpulseSum::on_collisions>(sum);
+
+	for (auto _ : state)
+	{
+		get_job_system().parallel_for(0, event_count, 16384, [&](const std::size_t begin, const std::size_t end)
+		{
+			for (auto index = begin; index < end; ++index)
+			{
+				std::ignore = bus.publish(Collision{ index, index + 1, 1.0f });
+			}
+		});
+		benchmark::DoNotOptimize(bus.dispatch<Collision>());
+	}
+	benchmark::DoNotOptimize(sum.total);
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(publish_and_dispatch)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+static void publish_single_thread(benchmark::State& state)
+{
+	constexpr std::size_t k_batch = 65536;
+	Bus bus{ k_batch };
+	Entity entity = 0;
+	for (auto _ : state)
+	{
+		for (std::size_t index = 0; index < k_batch; ++index)
+		{
+			std::ignore = bus.publish(Spawn{ ++entity });
+		}
+		benchmark::DoNotOptimize(bus.dispatch<Spawn>());
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(k_batch));
+}
+
+BENCHMARK(publish_single_thread)->Unit(benchmark::kMicrosecond);
\ No newline at end of file
@@ -0,0 +1,46 @@
+#include <benchmark/benchmark.h>
+
+#include <Sigma/Engine/Logging/Logger.hpp>
+
+using namespace sigma;
+
+// Cost on the calling thread only: the record is copied into the thread's ring and formatted elsewhere
+static void log_record(benchmark::State& state)
+{
+	Logger logger{ 1 << 24 };
+	if (!logger.open(std::filesystem::temp_directory_path() / "sigma_benchmark_logger.log"))
+	{
+		state.SkipWithError("Could not open the log file");
+		return;
+	}
+
+	UInt32 frame = 0;
+	for (auto _ : state)
+	{
+		logger.log<"frame {} took {} ms on {}">(LogLevel::info, ++frame, 16.6f, "main");
+		// Keeps the ring from filling up, otherwise most iterations would only count a drop
+		if (frame % 65536 == 0)
+		{
+			state.PauseTiming();
+			logger.flush();
+			state.ResumeTiming();
+		}
+	}
+	logger.close();
+	state.counters["dropped"] = static_cast<double>(logger.get_dropped_count());
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(log_record);
+
+static void log_filtered(benchmark::State& state)
+{
+	Logger logger{};
+	logger.set_level(LogLevel::warning);
+	for (auto _ : state)
+	{
+		logger.log<"filtered {}">(LogLevel::debug, 1);
+	}
+}
+
+BENCHMARK(log_filtered);
\ No newline at end of file
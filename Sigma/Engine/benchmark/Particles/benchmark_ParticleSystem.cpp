@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+
+#include <Sigma/Engine/Particles/ParticleSystem.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	constexpr auto k_time_step = 1.0f / 60.0f;
+	constexpr auto k_emitter_count = std::size_t{ 64 };
+
+	JobSystem& get_job_system()
+	{
+		static JobSystem job_system{};
+		return job_system;
+	}
+}
+
+// Headless scene at steady state: emitters replace about as many particles per frame as die, so every frame
+// integrates the whole population, spawns new batches and compacts the dead ones away
+static void particle_scene(benchmark::State& state)
+{
+	const auto particle_count = static_cast<std::size_t>(state.range(0));
+	constexpr auto k_lifetime = 2.0f;
+	const auto spawn_per_emitter = static_cast<std::size_t>(static_cast<Float>(particle_count) * k_time_step / k_lifetime) / k_emitter_count + 1;
+
+	ParticleSystem particles{ particle_count * 2 };
+	UInt32 seed = 0;
+	const auto emit = [&]()
+	{
+		for (std::size_t emitter = 0; emitter < k_emitter_count; ++emitter)
+		{
+			const auto offset = static_cast<Float>(emitter) * 4.0f;
+			particles.emit({ { offset, 0.0f, 0.0f }, 0.5f, { 0.0f, 6.0f, 0.0f }, 2.0f, k_lifetime, 0.5f }, spawn_per_emitter, ++seed, get_job_system());
+		}
+	};
+	for (auto frame = 0; frame < 150; ++frame)
+	{
+		emit();
+		particles.update(k_time_step, { 0.0f, -9.81f, 0.0f }, get_job_system());
+	}
+
+	for (auto _ : state)
+	{
+		emit();
+		particles.update(k_time_step, { 0.0f, -9.81f, 0.0f }, get_job_system());
+		benchmark::DoNotOptimize(particles.get_streams().position_x);
+	}
+	state.counters["particles"] = static_cast<double>(particles.size());
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(particles.size()));
+}
+BENCHMARK(particle_scene)->Arg(100'000)->Arg(1'000'000)->Unit(benchmark::kMillisecond)->UseRealTime();
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include <Sigma/Engine/Physics/SweepAndPrune.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	constexpr auto k_body_count = std::size_t{ 100'000 };
+	constexpr auto k_world_extent = 400.0f;
+	constexpr auto k_time_step = 1.0f / 60.0f;
+
+	RigidBodies make_bodies()
+	{
+		std::mt19937 generator{ 11 };
+		std::uniform_real_distribution<float> position{ -k_world_extent, k_world_extent };
+		std::uniform_real_distribution<float> velocity{ -2.0f, 2.0f };
+		std::uniform_real_distribution<float> half_extent{ 0.25f, 1.5f };
+
+		RigidBodies bodies{ k_body_count };
+		for (Entity entity = 0; entity < k_body_count; ++entity)
+		{
+			const auto extent = half_extent(generator);
+			bodies.add(entity, {
+				{ position(generator), position(generator), position(generator) },
+				{ velocity(generator), velocity(generator), velocity(generator) },
+				1.0f, { extent, extent, extent } });
+		}
+		return bodies;
+	}
+
+	JobSystem& get_job_system()
+	{
+		static JobSystem job_system{};
+		return job_system;
+	}
+}
+
+static void rigid_body_integrate(benchmark::State& state)
+{
+	auto bodies = make_bodies();
+	for (auto _ : state)
+	{
+		bodies.integrate(k_time_step, { 0.0f, 0.0f, 0.0f }, get_job_system());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(bodies.size()));
+}
+BENCHMARK(rigid_body_integrate)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+static void rigid_body_integrate_single_thread(benchmark::State& state)
+{
+	auto bodies = make_bodies();
+	for (auto _ : state)
+	{
+		RigidBodies::integrate(bodies.get_streams(), k_time_step, { 0.0f, 0.0f, 0.0f }, 0, bodies.size());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(bodies.size()));
+}
+BENCHMARK(rigid_body_integrate_single_thread)->Unit(benchmark::kMicrosecond);
+
+// Integration plus broadphase with coherent motion, the order is repaired incrementally every frame
+static void rigid_body_step(benchmark::State& state)
+{
+	auto bodies = make_bodies();
+	SweepAndPrune broadphase{};
+	std::vector<ContactPair> pairs{};
+	broadphase.update(bodies, pairs, get_job_system());
+
+	for (auto _ : state)
+	{
+		bodies.integrate(k_time_step, { 0.0f, 0.0f, 0.0f }, get_job_system());
+		broadphase.update(bodies, pairs, get_job_system());
+		benchmark::DoNotOptimize(pairs.data());
+	}
+	state.counters["pairs"] = static_cast<double>(pairs.size());
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(bodies.size()));
+}
+BENCHMARK(rigid_body_step)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void sweep_and_prune_full_sort(benchmark::State& state)
+{
+	auto bodies = make_bodies();
+	SweepAndPrune broadphase{};
+	std::vector<ContactPair> pairs{};
+
+	for (auto _ : state)
+	{
+		// A new broadphase has no previous order to repair
+		broadphase = SweepAndPrune{};
+		broadphase.update(bodies, pairs, get_job_system());
+		benchmark::DoNotOptimize(pairs.data());
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(bodies.size()));
+}
+BENCHMARK(sweep_and_prune_full_sort)->Unit(benchmark::kMillisecond)->UseRealTime();
\ No newline at end of file
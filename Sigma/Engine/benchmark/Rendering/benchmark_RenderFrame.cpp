@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+
+#include <Sigma/Engine/Rendering/RenderFrame.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	std::vector<UInt64> make_keys(const std::size_t count)
+	{
+		std::mt19937 generator{ 17 };
+		std::uniform_int_distribution<UInt32> layer{ 0, 3 };
+		std::uniform_real_distribution<float> depth{ 0.0f, 1.0f };
+		std::uniform_int_distribution<UInt32> material{ 0, 255 };
+
+		std::vector<UInt64> keys(count);
+		for (auto& key : keys)
+		{
+			key = make_render_key(0, static_cast<UInt8>(layer(generator)), depth(generator), material(generator));
+		}
+		return keys;
+	}
+}
+
+static void render_frame_build_and_radix_sort(benchmark::State& state)
+{
+	const auto keys = make_keys(static_cast<std::size_t>(state.range(0)));
+	RenderFrame frame{};
+	for (auto _ : state)
+	{
+		frame.clear();
+		for (const auto key : keys)
+		{
+			frame.push(key, DrawMeshCommand{});
+		}
+		frame.sort();
+		benchmark::DoNotOptimize(frame.get_commands().data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(render_frame_build_and_radix_sort)->Arg(10'000)->Arg(100'000)->Arg(1'000'000)->Unit(benchmark::kMicrosecond);
+
+static void render_frame_build_and_std_sort(benchmark::State& state)
+{
+	const auto keys = make_keys(static_cast<std::size_t>(state.range(0)));
+	RenderFrame frame{};
+	std::vector<RenderCommand> commands{};
+	for (auto _ : state)
+	{
+		frame.clear();
+		for (const auto key : keys)
+		{
+			frame.push(key, DrawMeshCommand{});
+		}
+		commands = frame.get_commands();
+		std::stable_sort(commands.begin(), commands.end(), [](const RenderCommand& left, const RenderCommand& right) { return left.key < right.key; });
+		benchmark::DoNotOptimize(commands.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(render_frame_build_and_std_sort)->Arg(10'000)->Arg(100'000)->Arg(1'000'000)->Unit(benchmark::kMicrosecond);
\ No newline at end of file
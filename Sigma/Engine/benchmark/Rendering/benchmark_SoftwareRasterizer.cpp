@@ -0,0 +1,72 @@
+#include <benchmark/benchmark.h>
+
+#include <Sigma/Engine/Rendering/SoftwareRasterizer.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	const std::vector<RasterVertex> k_cube_vertices{
+		{ { -0.5f, -0.5f, -0.5f }, { 1.0f, 0.0f, 0.0f } }, { { -0.5f, -0.5f, 0.5f }, { 0.0f, 1.0f, 0.0f } },
+		{ { -0.5f, 0.5f, -0.5f }, { 0.0f, 0.0f, 1.0f } }, { { -0.5f, 0.5f, 0.5f }, { 1.0f, 1.0f, 0.0f } },
+		{ { 0.5f, -0.5f, -0.5f }, { 1.0f, 0.0f, 1.0f } }, { { 0.5f, -0.5f, 0.5f }, { 0.0f, 1.0f, 1.0f } },
+		{ { 0.5f, 0.5f, -0.5f }, { 1.0f, 1.0f, 1.0f } }, { { 0.5f, 0.5f, 0.5f }, { 0.2f, 0.2f, 0.2f } }
+	};
+
+	const std::vector<UInt32> k_cube_indices{
+		0, 2, 6, 0, 6, 4,
+		5, 7, 3, 5, 3, 1,
+		1, 3, 2, 1, 2, 0,
+		4, 6, 7, 4, 7, 5,
+		2, 3, 7, 2, 7, 6,
+		1, 0, 4, 1, 4, 5
+	};
+
+	// A grid of cubes filling the view, submitted as one draw per cube
+	void render_cubes(benchmark::State& state, const std::size_t width, const std::size_t height)
+	{
+		const auto grid_size = static_cast<int>(state.range(0));
+		const auto view = DirectX::XMMatrixLookAtLH(DirectX::XMVectorSet(0.0f, 20.0f, -40.0f, 1.0f), DirectX::XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f), DirectX::XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f));
+		const auto projection = DirectX::XMMatrixPerspectiveFovLH(DirectX::XM_PIDIV2 * 0.75f, static_cast<float>(width) / static_cast<float>(height), 0.1f, 500.0f);
+		const auto view_projection = DirectX::XMMatrixMultiply(view, projection);
+
+		std::vector<Matrix4x4> transforms{};
+		for (auto z = 0; z < grid_size; ++z)
+		{
+			for (auto x = 0; x < grid_size; ++x)
+			{
+				const auto spacing = 60.0f / static_cast<float>(grid_size);
+				const auto world = DirectX::XMMatrixTranslation((static_cast<float>(x) - static_cast<float>(grid_size) * 0.5f) * spacing, 0.0f, static_cast<float>(z) * spacing);
+				auto& transform = transforms.emplace_back();
+				DirectX::XMStoreFloat4x4(&transform, DirectX::XMMatrixMultiply(world, view_projection));
+			}
+		}
+
+		RenderTarget target{ width, height };
+		JobSystem job_system{};
+		SoftwareRasterizer rasterizer{};
+		for (auto _ : state)
+		{
+			rasterizer.begin_frame();
+			for (const auto& transform : transforms)
+			{
+				rasterizer.draw(k_cube_vertices, k_cube_indices, transform);
+			}
+			rasterizer.render(target, job_system);
+			benchmark::DoNotOptimize(target.get_color_data());
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(transforms.size() * k_cube_indices.size() / 3));
+	}
+}
+
+static void software_rasterizer_720p(benchmark::State& state)
+{
+	render_cubes(state, 1280, 720);
+}
+BENCHMARK(software_rasterizer_720p)->Arg(32)->Arg(128)->Arg(256)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void software_rasterizer_1080p(benchmark::State& state)
+{
+	render_cubes(state, 1920, 1080);
+}
+BENCHMARK(software_rasterizer_1080p)->Arg(32)->Arg(128)->Unit(benchmark::kMillisecond)->UseRealTime();
\ No newline at end of file
@@ -0,0 +1,210 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include <Sigma/Engine/Spatial/DynamicBvh.hpp>
+#include <Sigma/Engine/Spatial/LooseGrid.hpp>
+#include <Sigma/Engine/Spatial/SpatialIndex.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	constexpr auto k_world_extent = 1'000.0f;
+	constexpr auto k_batch_size = std::size_t{ 10'000 };
+
+	template <typename Structure>
+	SpatialIndex<Structure> make_index(std::size_t capacity);
+
+	template <>
+	SpatialIndex<LooseGrid> make_index<LooseGrid>(const std::size_t capacity)
+	{
+		return SpatialIndex<LooseGrid>(capacity, 16.0f);
+	}
+
+	template <>
+	SpatialIndex<DynamicBvh> make_index<DynamicBvh>(const std::size_t capacity)
+	{
+		const auto limit = k_world_extent + 16.0f;
+		return SpatialIndex<DynamicBvh>(capacity, Aabb{ { -limit, -limit, -limit }, { limit, limit, limit } }, 0.25f);
+	}
+
+	std::vector<Aabb> make_boxes(const std::size_t count, const unsigned seed)
+	{
+		std::mt19937 generator{ seed };
+		std::uniform_real_distribution<float> position{ -k_world_extent, k_world_extent };
+		std::uniform_real_distribution<float> half_extent{ 0.25f, 2.0f };
+
+		std::vector<Aabb> boxes(count);
+		for (auto& box : boxes)
+		{
+			const Vector3 center{ position(generator), position(generator), position(generator) };
+			box = expand({ center, center }, half_extent(generator));
+		}
+		return boxes;
+	}
+
+	template <typename Structure>
+	void fill(SpatialIndex<Structure>& index, const std::vector<Aabb>& boxes)
+	{
+		for (std::size_t entity = 0; entity < boxes.size(); ++entity)
+		{
+			index.get_structure().insert(entity, boxes[entity]);
+		}
+	}
+
+	template <typename Structure>
+	SpatialIndex<Structure>& get_populated_index(const std::size_t count)
+	{
+		static auto index = [&]()
+		{
+			auto populated = make_index<Structure>(count);
+			fill(populated, make_boxes(count, 1));
+			return populated;
+		}();
+		return index;
+	}
+
+	JobSystem& get_job_system()
+	{
+		static JobSystem job_system{};
+		return job_system;
+	}
+}
+
+template <typename Structure>
+void BM_SpatialIndex_build(benchmark::State& state)
+{
+	const auto count = static_cast<std::size_t>(state.range(0));
+	const auto boxes = make_boxes(count, 1);
+
+	for (auto _ : state)
+	{
+		auto index = make_index<Structure>(count);
+		fill(index, boxes);
+		benchmark::DoNotOptimize(index);
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+
+template <typename Structure>
+void BM_SpatialIndex_update(benchmark::State& state)
+{
+	const auto count = static_cast<std::size_t>(state.range(0));
+	auto& index = get_populated_index<Structure>(count);
+	auto boxes = make_boxes(count, 1);
+
+	// One percent of the objects move a little every frame
+	std::mt19937 generator{ 7 };
+	std::uniform_int_distribution<std::size_t> pick{ 0, count - 1 };
+	std::uniform_real_distribution<float> step{ -0.5f, 0.5f };
+
+	for (auto _ : state)
+	{
+		for (std::size_t moved = 0; moved < count / 100; ++moved)
+		{
+			const auto entity = pick(generator);
+			const auto offset = step(generator);
+			auto& box = boxes[entity];
+			box = { { box.min.x + offset, box.min.y, box.min.z }, { box.max.x + offset, box.max.y, box.max.z } };
+			index.get_structure().update(entity, box);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>((count / 100)));
+}
+
+template <typename Structure>
+void BM_SpatialIndex_query_aabb(benchmark::State& state)
+{
+	const auto& index = get_populated_index<Structure>(static_cast<std::size_t>(state.range(0)));
+	auto queries = make_boxes(k_batch_size, 2);
+	for (auto& query : queries)
+	{
+		query = expand(query, 8.0f);
+	}
+
+	std::vector<std::vector<Entity>> results{};
+	for (auto _ : state)
+	{
+		index.query(queries, results, get_job_system());
+		benchmark::DoNotOptimize(results.data());
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(k_batch_size));
+}
+
+template <typename Structure>
+void BM_SpatialIndex_query_sphere(benchmark::State& state)
+{
+	const auto& index = get_populated_index<Structure>(static_cast<std::size_t>(state.range(0)));
+	std::vector<Sphere> queries{};
+	for (const auto& box : make_boxes(k_batch_size, 3))
+	{
+		queries.push_back({ get_center(box), 10.0f });
+	}
+
+	std::vector<std::vector<Entity>> results{};
+	for (auto _ : state)
+	{
+		index.query(queries, results, get_job_system());
+		benchmark::DoNotOptimize(results.data());
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(k_batch_size));
+}
+
+template <typename Structure>
+void BM_SpatialIndex_raycast(benchmark::State& state)
+{
+	const auto& index = get_populated_index<Structure>(static_cast<std::size_t>(state.range(0)));
+	std::mt19937 generator{ 4 };
+	std::normal_distribution<float> direction{};
+
+	std::vector<Ray> rays{};
+	for (const auto& box : make_boxes(k_batch_size, 4))
+	{
+		const auto x = direction(generator);
+		const auto y = direction(generator);
+		const auto z = direction(generator);
+		const auto length = std::sqrt(x * x + y * y + z * z);
+		rays.push_back({ get_center(box), { x / length, y / length, z / length }, 200.0f });
+	}
+
+	std::vector<RayHit> hits{};
+	for (auto _ : state)
+	{
+		index.raycast(rays, hits, get_job_system());
+		benchmark::DoNotOptimize(hits.data());
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(k_batch_size));
+}
+
+template <typename Structure>
+void BM_SpatialIndex_query_nearest(benchmark::State& state)
+{
+	const auto& index = get_populated_index<Structure>(static_cast<std::size_t>(state.range(0)));
+	std::vector<Vector3> points{};
+	for (const auto& box : make_boxes(k_batch_size, 5))
+	{
+		points.push_back(get_center(box));
+	}
+
+	std::vector<std::vector<Entity>> results{};
+	for (auto _ : state)
+	{
+		index.query_nearest(points, 8, results, get_job_system());
+		benchmark::DoNotOptimize(results.data());
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(k_batch_size));
+}
+
+BENCHMARK_TEMPLATE(BM_SpatialIndex_build, LooseGrid)->Arg(1'000'000)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_TEMPLATE(BM_SpatialIndex_build, DynamicBvh)->Arg(1'000'000)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_TEMPLATE(BM_SpatialIndex_update, LooseGrid)->Arg(1'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SpatialIndex_update, DynamicBvh)->Arg(1'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SpatialIndex_query_aabb, LooseGrid)->Arg(1'000'000)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SpatialIndex_query_aabb, DynamicBvh)->Arg(1'000'000)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SpatialIndex_query_sphere, LooseGrid)->Arg(1'000'000)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SpatialIndex_query_sphere, DynamicBvh)->Arg(1'000'000)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SpatialIndex_raycast, LooseGrid)->Arg(1'000'000)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SpatialIndex_raycast, DynamicBvh)->Arg(1'000'000)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SpatialIndex_query_nearest, LooseGrid)->Arg(1'000'000)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SpatialIndex_query_nearest, DynamicBvh)->Arg(1'000'000)->Unit(benchmark::kMicrosecond)->UseRealTime();
\ No newline at end of file
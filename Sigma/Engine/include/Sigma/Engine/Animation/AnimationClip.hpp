@@ -0,0 +1,47 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "Sigma/Engine/Animation/Pose.hpp"
+
+namespace sigma
+{
+	// Smallest-three encoding in 48 bits: the largest component of a unit quaternion is dropped and rebuilt from the
+	// other three, which lie in [-1/sqrt(2), 1/sqrt(2)] and keep 15 bits each. The top bits of the first two words
+	// hold the index of the dropped component.
+	struct QuantizedRotation
+	{
+		UInt16 components[3]{};
+	};
+
+	[[nodiscard]] QuantizedRotation quantize_rotation(const Vector4& rotation) noexcept;
+	[[nodiscard]] Vector4 dequantize_rotation(const QuantizedRotation& rotation) noexcept;
+
+	// Uniformly sampled clip. Rotations are stored quantized, translations and scales as floats, all frame major so
+	// sampling reads two contiguous runs of keys.
+	class AnimationClip
+	{
+	public:
+		using size_type = std::size_t;
+
+		// frames holds bone_count transforms per frame, one frame per 1 / sample_rate seconds
+		AnimationClip(size_type bone_count, Float sample_rate, std::span<const BoneTransform> frames);
+
+		[[nodiscard]] size_type get_bone_count() const noexcept;
+		[[nodiscard]] size_type get_frame_count() const noexcept;
+		[[nodiscard]] Float get_duration() const noexcept;
+
+		// Time wraps around the duration. The two neighbouring frames are decoded into result and scratch and blended
+		// in place, so result holds the pose at that time.
+		void sample(Float time, Pose& result, Pose& scratch) const;
+		void decode_frame(size_type frame, Pose& result) const;
+	private:
+		size_type m_bone_count{};
+		size_type m_frame_count{};
+		Float m_sample_rate{};
+		std::vector<QuantizedRotation> m_rotations{};
+		std::vector<Vector3> m_translations{};
+		std::vector<Vector3> m_scales{};
+	};
+}
\ No newline at end of file
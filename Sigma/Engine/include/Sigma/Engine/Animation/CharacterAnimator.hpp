@@ -0,0 +1,62 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "Sigma/Engine/Animation/AnimationClip.hpp"
+#include "Sigma/Engine/Animation/Skeleton.hpp"
+#include "Sigma/Engine/Jobs/JobSystem.hpp"
+
+namespace sigma
+{
+	struct CharacterAnimation
+	{
+		const Skeleton* skeleton{};
+		const AnimationClip* clip{};
+		Float time{};
+		// Blended over clip by blend_weight when set, e.g. walk into run
+		const AnimationClip* blend_clip{};
+		Float blend_time{};
+		Float blend_weight{};
+		// Skinned on the CPU every update when not empty
+		std::span<const SkinnedVertex> mesh{};
+	};
+
+	// Evaluates the pose and skinning palette of every character, spreading the characters over the workers. Each
+	// chunk of characters samples into its own scratch poses, so workers share nothing but the read-only clips.
+	class CharacterAnimator
+	{
+	public:
+		using size_type = std::size_t;
+
+		static constexpr size_type k_update_grain_size = 16;
+
+		// The palette and skinned vertex ranges are laid out when a character is added
+		size_type add(const CharacterAnimation& animation);
+		[[nodiscard]] size_type size() const noexcept;
+		[[nodiscard]] CharacterAnimation& get_animation(size_type character) noexcept;
+
+		void update(JobSystem& job_system);
+
+		[[nodiscard]] std::span<const Matrix3x4> get_palette(size_type character) const noexcept;
+		[[nodiscard]] std::span<const Vector3> get_skinned_positions(size_type character) const noexcept;
+		[[nodiscard]] std::span<const Vector3> get_skinned_normals(size_type character) const noexcept;
+	private:
+		struct Scratch
+		{
+			Pose pose{};
+			Pose blend_pose{};
+			Pose sample_pose{};
+			std::vector<Matrix4x4> model{};
+		};
+
+		void update_character(size_type character, Scratch& scratch);
+
+		std::vector<CharacterAnimation> m_animations{};
+		std::vector<size_type> m_palette_offsets{ 0 };
+		std::vector<size_type> m_vertex_offsets{ 0 };
+		std::vector<Matrix3x4> m_palettes{};
+		std::vector<Vector3> m_positions{};
+		std::vector<Vector3> m_normals{};
+	};
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "Sigma/Engine/common/types.hpp"
+
+namespace sigma
+{
+	struct BoneTransform
+	{
+		Vector4 rotation{ 0.0f, 0.0f, 0.0f, 1.0f };
+		Vector3 translation{ 0.0f, 0.0f, 0.0f };
+		Vector3 scale{ 1.0f, 1.0f, 1.0f };
+	};
+
+	// Local bone transforms as one float stream per component, so blending handles several bones per instruction
+	class Pose
+	{
+	public:
+		using size_type = std::size_t;
+
+		enum Stream : size_type
+		{
+			rotation_x,
+			rotation_y,
+			rotation_z,
+			rotation_w,
+			translation_x,
+			translation_y,
+			translation_z,
+			scale_x,
+			scale_y,
+			scale_z,
+			stream_count
+		};
+
+		Pose() = default;
+		explicit Pose(size_type bone_count);
+
+		// New bones start at the identity
+		void resize(size_type bone_count);
+		[[nodiscard]] size_type size() const noexcept;
+
+		void set_bone(size_type bone, const BoneTransform& transform) noexcept;
+		[[nodiscard]] BoneTransform get_bone(size_type bone) const noexcept;
+
+		[[nodiscard]] Float* get_stream(Stream stream) noexcept;
+		[[nodiscard]] const Float* get_stream(Stream stream) const noexcept;
+
+		// Normalized lerp of the rotations along the shorter arc and lerp of translations and scales. The result may be
+		// one of the inputs.
+		static void blend(const Pose& from, const Pose& to, Float weight, Pose& result);
+	private:
+		std::array<std::vector<Float>, stream_count> m_streams{};
+	};
+}
\ No newline at end of file
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "Sigma/Engine/Animation/Pose.hpp"
+
+namespace sigma
+{
+	struct SkinnedVertex
+	{
+		Vector3 position{};
+		Vector3 normal{};
+		UInt8 bones[4]{};
+		Float weights[4]{};
+	};
+
+	// Bone hierarchy with every parent listed before its children, so one forward pass builds the model transforms
+	class Skeleton
+	{
+	public:
+		using size_type = std::size_t;
+
+		static constexpr Int32 k_no_parent = -1;
+
+		Skeleton(std::vector<Int32> parents, std::vector<Matrix4x4> inverse_bind);
+
+		[[nodiscard]] size_type get_bone_count() const noexcept;
+		[[nodiscard]] Int32 get_parent(size_type bone) const noexcept;
+
+		// Writes one transposed 3x4 matrix per bone, the inverse bind transform followed by the model transform of the
+		// pose, in the layout shaders read bone palettes in. model needs room for one matrix per bone.
+		void build_palette(const Pose& pose, std::span<Matrix4x4> model, std::span<Matrix3x4> palette) const noexcept;
+	private:
+		std::vector<Int32> m_parents{};
+		std::vector<Matrix4x4> m_inverse_bind{};
+	};
+
+	// Linear blend skinning on the CPU, for meshes that are ray cast or have no GPU skinning path
+	void skin_vertices(std::span<const SkinnedVertex> vertices, std::span<const Matrix3x4> palette, std::span<Vector3> positions, std::span<Vector3> normals) noexcept;
+}
\ No newline at end of file
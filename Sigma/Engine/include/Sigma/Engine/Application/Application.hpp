@@ -0,0 +1,70 @@
+#pragma once
+
+#include <atomic>
+
+#include "Sigma/Engine/Application/FramePacer.hpp"
+
+namespace sigma
+{
+	struct ApplicationSettings
+	{
+		// Length of one simulation step in seconds
+		Double fixed_timestep{ 1.0 / 60.0 };
+		// Longest frame the simulation tries to catch up with; anything beyond is dropped
+		Double max_frame_time{ 0.25 };
+		UInt32 max_steps_per_frame{ 8 };
+		// Frames per second when rendering, zero renders as fast as possible
+		Double target_frame_rate{ 60.0 };
+		// Never calls on_render and paces the loop on the simulation steps instead
+		Bool headless{ false };
+		// Runs one simulation step per iteration back to back without looking at the clock
+		Bool uncapped{ false };
+	};
+
+	// Fixed timestep simulation with variable rate rendering. Each frame runs as many fixed steps as the elapsed
+	// time allows and renders with the fraction of a step left over, so the renderer can interpolate between the
+	// previous and the current simulation state.
+	class Application
+	{
+	public:
+		using clock = FramePacer::clock;
+
+		explicit Application(const ApplicationSettings& settings = {});
+		virtual ~Application() = default;
+
+		Application(const Application&) = delete;
+		Application& operator=(const Application&) = delete;
+		Application(Application&&) = delete;
+		Application& operator=(Application&&) = delete;
+
+		void run();
+		// Can be called from any thread, the loop stops after the current step without rendering it, or after the current frame
+		void request_exit() noexcept;
+
+		[[nodiscard]] const ApplicationSettings& get_settings() const noexcept;
+		[[nodiscard]] UInt64 get_frame_count() const noexcept;
+		[[nodiscard]] UInt64 get_step_count() const noexcept;
+		[[nodiscard]] UInt64 get_dropped_step_count() const noexcept;
+		[[nodiscard]] Double get_simulation_time() const noexcept;
+	protected:
+		virtual void on_start() {}
+		virtual void on_simulate(Double timestep) = 0;
+		virtual void on_render([[maybe_unused]] Double interpolation) {}
+		virtual void on_stop() {}
+
+		// The capped loop reads the time and waits for the next frame only through these
+		[[nodiscard]] virtual clock::time_point get_time() const;
+		virtual void wait_until(clock::time_point deadline);
+	private:
+		void run_capped();
+		void run_uncapped();
+		void simulate();
+
+		ApplicationSettings m_settings;
+		FramePacer m_pacer{};
+		std::atomic<bool> m_exit_requested{};
+		UInt64 m_frame_count{};
+		UInt64 m_step_count{};
+		UInt64 m_dropped_step_count{};
+	};
+}
\ No newline at end of file
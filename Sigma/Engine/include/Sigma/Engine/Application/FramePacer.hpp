@@ -0,0 +1,28 @@
+#pragma once
+
+#include <chrono>
+
+#include "Sigma/Engine/common/types.hpp"
+
+namespace sigma
+{
+	// Waits for a deadline by sleeping in short slices while the remaining time is larger than the expected
+	// oversleep of one slice, then spinning for the rest. The oversleep estimate (mean plus one standard deviation)
+	// is learned from the slices actually slept, so the spin phase stays short on schedulers with coarse timers.
+	class FramePacer
+	{
+	public:
+		using clock = std::chrono::steady_clock;
+
+		static constexpr std::chrono::microseconds k_sleep_slice{ 1000 };
+
+		void wait_until(clock::time_point deadline);
+
+		[[nodiscard]] Double get_sleep_estimate() const noexcept;
+	private:
+		Double m_estimate{ 0.005 };
+		Double m_mean{ 0.005 };
+		Double m_m2{};
+		UInt64 m_count{ 1 };
+	};
+}
\ No newline at end of file
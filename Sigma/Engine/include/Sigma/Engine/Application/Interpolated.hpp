@@ -0,0 +1,85 @@
+#pragma once
+
+#include "Sigma/Engine/common/types.hpp"
+
+namespace sigma
+{
+	[[nodiscard]] inline Float interpolate(const Float previous, const Float current, const Double alpha) noexcept
+	{
+		return previous + (current - previous) * static_cast<Float>(alpha);
+	}
+
+	[[nodiscard]] inline Vector3 interpolate(const Vector3& previous, const Vector3& current, const Double alpha) noexcept
+	{
+		return { interpolate(previous.x, current.x, alpha), interpolate(previous.y, current.y, alpha), interpolate(previous.z, current.z, alpha) };
+	}
+
+	[[nodiscard]] inline Vector4 interpolate(const Vector4& previous, const Vector4& current, const Double alpha) noexcept
+	{
+		return {
+			interpolate(previous.x, current.x, alpha), interpolate(previous.y, current.y, alpha),
+			interpolate(previous.z, current.z, alpha), interpolate(previous.w, current.w, alpha)
+		};
+	}
+
+	// Simulated value together with its value one step earlier; the renderer samples between the two with the
+	// interpolation factor handed to Application::on_render
+	template <typename T>
+	class Interpolated
+	{
+	public:
+		Interpolated() = default;
+		explicit Interpolated(const T& value);
+
+		// Call once per simulation step
+		void set(const T& value);
+		// Moves to a value without blending from the old one, e.g. after a teleport
+		void reset(const T& value);
+
+		[[nodiscard]] const T& get_previous() const noexcept;
+		[[nodiscard]] const T& get_current() const noexcept;
+		[[nodiscard]] T get(Double alpha) const noexcept;
+	private:
+		T m_previous{};
+		T m_current{};
+	};
+
+
+	template <typename T>
+	Interpolated<T>::Interpolated(const T& value)
+		: m_previous{ value }, m_current{ value }
+	{
+	}
+
+	template <typename T>
+	void Interpolated<T>::set(const T& value)
+	{
+		m_previous = m_current;
+		m_current = value;
+	}
+
+	template <typename T>
+	void Interpolated<T>::reset(const T& value)
+	{
+		m_previous = value;
+		m_current = value;
+	}
+
+	template <typename T>
+	const T& Interpolated<T>::get_previous() const noexcept
+	{
+		return m_previous;
+	}
+
+	template <typename T>
+	const T& Interpolated<T>::get_current() const noexcept
+	{
+		return m_current;
+	}
+
+	template <typename T>
+	T Interpolated<T>::get(const Double alpha) const noexcept
+	{
+		return interpolate(m_previous, m_current, alpha);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "Sigma/Engine/Assets/AssetId.hpp"
+#include "Sigma/Engine/Assets/Compression.hpp"
+#include "Sigma/Engine/Assets/MappedFile.hpp"
+
+namespace sigma
+{
+	// On-disk layout, little endian: the header, the table of contents sorted by id, then the stored bytes of every
+	// entry starting on a multiple of the archive alignment.
+	struct ArchiveHeader
+	{
+		static constexpr UInt32 k_magic = 0x52414753; // "SGAR"
+		static constexpr UInt32 k_version = 1;
+
+		UInt32 magic{ k_magic };
+		UInt32 version{ k_version };
+		UInt32 entry_count{};
+		UInt32 alignment{};
+		UInt64 file_size{};
+	};
+
+	struct ArchiveEntry
+	{
+		AssetId id{};
+		UInt64 offset{};
+		UInt64 stored_size{};
+		UInt64 size{};
+		Compression compression{};
+		UInt32 reserved{};
+	};
+
+	enum class AssetStatus
+	{
+		loaded,
+		not_found,
+		unsupported_compression,
+		corrupt
+	};
+
+	// Bytes of a loaded asset. Uncompressed entries are a view straight into the archive mapping and stay valid as
+	// long as the archive is open; decompressed entries own their buffer.
+	class AssetData
+	{
+	public:
+		AssetData() = default;
+
+		[[nodiscard]] static AssetData make_view(std::span<const std::byte> bytes) noexcept;
+		[[nodiscard]] static AssetData make_owned(std::unique_ptr<std::byte[]> buffer, std::size_t size) noexcept;
+
+		[[nodiscard]] std::span<const std::byte> get_bytes() const noexcept;
+		[[nodiscard]] bool is_zero_copy() const noexcept;
+	private:
+		std::unique_ptr<std::byte[]> m_buffer{};
+		std::span<const std::byte> m_bytes{};
+	};
+
+	class AssetArchive
+	{
+	public:
+		using size_type = std::size_t;
+
+		[[nodiscard]] bool open(const std::filesystem::path& path);
+		void close() noexcept;
+		[[nodiscard]] bool is_open() const noexcept;
+
+		[[nodiscard]] const ArchiveEntry* find(AssetId id) const noexcept;
+		[[nodiscard]] const std::vector<ArchiveEntry>& get_entries() const noexcept;
+		[[nodiscard]] std::span<const std::byte> get_stored_bytes(const ArchiveEntry& entry) const noexcept;
+
+		// Synchronous load on the calling thread
+		[[nodiscard]] AssetStatus load(AssetId id, AssetData& data) const;
+		[[nodiscard]] AssetStatus load(const ArchiveEntry& entry, AssetData& data) const;
+	private:
+		MappedFile m_file{};
+		std::vector<ArchiveEntry> m_entries{};
+	};
+
+	class AssetArchiveWriter
+	{
+	public:
+		using size_type = std::size_t;
+
+		static constexpr size_type k_default_alignment = 64;
+
+		explicit AssetArchiveWriter(size_type alignment = k_default_alignment);
+
+		// Entries that do not shrink when compressed are stored uncompressed so they can be handed out zero-copy.
+		// Returns false if the codec is not available.
+		[[nodiscard]] bool add(AssetId id, std::span<const std::byte> bytes, Compression compression = Compression::none);
+		// Fails on I/O errors and when two entries share an id
+		[[nodiscard]] bool write(const std::filesystem::path& path) const;
+
+		[[nodiscard]] size_type size() const noexcept;
+	private:
+		struct PendingEntry
+		{
+			ArchiveEntry entry{};
+			std::vector<std::byte> bytes{};
+		};
+
+		size_type m_alignment{};
+		std::vector<PendingEntry> m_entries{};
+	};
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <string_view>
+
+#include "Sigma/Engine/common/types.hpp"
+
+namespace sigma
+{
+	using AssetId = UInt64;
+
+	// 64-bit FNV-1a of the asset path. Both separators hash the same so ids do not depend on the platform that
+	// produced the path.
+	[[nodiscard]] constexpr AssetId make_asset_id(const std::string_view path) noexcept
+	{
+		constexpr UInt64 k_offset_basis = 14695981039346656037ull;
+		constexpr UInt64 k_prime = 1099511628211ull;
+
+		auto hash = k_offset_basis;
+		for (const auto character : path)
+		{
+			hash ^= static_cast<UInt8>(character == '\\' ? '/' : character);
+			hash *= k_prime;
+		}
+		return hash;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Sigma/Engine/Assets/AssetArchive.hpp"
+#include "Sigma/Engine/Jobs/JobSystem.hpp"
+
+namespace sigma
+{
+	// Background loading from an archive. I/O threads take requests highest priority first (FIFO within a priority)
+	// and fault the stored pages in; uncompressed assets are then handed to the callback zero-copy from the I/O
+	// thread, compressed ones are decompressed on the job system and handed over from the worker.
+	// The archive and the job system have to outlive the streamer.
+	class AssetStreamer
+	{
+	public:
+		using size_type = std::size_t;
+		using callback_type = std::function<void(AssetId, AssetStatus, AssetData)>;
+
+		static constexpr size_type k_default_io_thread_count = 2;
+
+		AssetStreamer(const AssetArchive& archive, JobSystem& job_system, size_type io_thread_count = k_default_io_thread_count);
+		// Requests that have not been picked up yet are dropped without calling their callback
+		~AssetStreamer();
+
+		AssetStreamer(const AssetStreamer&) = delete;
+		AssetStreamer& operator=(const AssetStreamer&) = delete;
+		AssetStreamer(AssetStreamer&&) = delete;
+		AssetStreamer& operator=(AssetStreamer&&) = delete;
+
+		void request(AssetId id, UInt32 priority, callback_type callback);
+
+		// Blocks until every request made so far has called its callback
+		void wait_idle();
+
+		[[nodiscard]] size_type get_pending_count() const;
+	private:
+		struct Request
+		{
+			AssetId id{};
+			UInt32 priority{};
+			UInt64 sequence{};
+			callback_type callback{};
+		};
+
+		struct RequestOrder
+		{
+			[[nodiscard]] bool operator()(const Request& a, const Request& b) const noexcept;
+		};
+
+		void io_loop(const std::stop_token& stop_token);
+		void complete_request();
+
+		const AssetArchive& m_archive;
+		JobSystem& m_job_system;
+		// Binary heap ordered by RequestOrder, a plain vector so the top request can be moved out before the pop
+		std::vector<Request> m_requests{};
+		UInt64 m_next_sequence{};
+		// Requests taken by an I/O thread whose callback has not returned yet
+		size_type m_in_flight{};
+		mutable std::mutex m_mutex{};
+		std::condition_variable_any m_request_condition{};
+		std::condition_variable m_idle_condition{};
+		std::vector<std::jthread> m_io_threads{};
+	};
+}
\ No newline at end of file
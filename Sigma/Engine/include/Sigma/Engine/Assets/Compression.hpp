@@ -0,0 +1,27 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "Sigma/Engine/common/types.hpp"
+
+namespace sigma
+{
+	enum class Compression : UInt32
+	{
+		none,
+		lz4,
+		zstd
+	};
+
+	// LZ4 is always available (block format, built in); zstd only when the engine was built against libzstd
+	[[nodiscard]] bool is_compression_supported(Compression compression) noexcept;
+
+	// Replaces the content of destination with the compressed bytes, returns false if the codec is not available
+	[[nodiscard]] bool compress(Compression compression, std::span<const std::byte> source, std::vector<std::byte>& destination);
+	// Upper bound on the uncompressed size of source, checked against an entry's size before its buffer is allocated.
+	// LZ4 expands a byte by at most 255, zstd frames carry their content size; zero for frames without one.
+	[[nodiscard]] std::size_t get_max_decompressed_size(Compression compression, std::span<const std::byte> source) noexcept;
+	// Destination has to be exactly the uncompressed size; returns false on malformed input or a size mismatch
+	[[nodiscard]] bool decompress(Compression compression, std::span<const std::byte> source, std::span<std::byte> destination) noexcept;
+}
\ No newline at end of file
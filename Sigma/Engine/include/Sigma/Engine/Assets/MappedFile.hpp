@@ -0,0 +1,40 @@
+#pragma once
+
+#include <filesystem>
+#include <span>
+
+#include "Sigma/Engine/common/types.hpp"
+
+namespace sigma
+{
+	// Read-only memory mapping of a whole file. Pages are faulted in on first access, prefetch() lets an I/O thread
+	// take that cost instead of the thread that later reads the bytes.
+	class MappedFile
+	{
+	public:
+		using size_type = std::size_t;
+
+		MappedFile() = default;
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+		MappedFile(MappedFile&& other) noexcept;
+		MappedFile& operator=(MappedFile&& other) noexcept;
+
+		[[nodiscard]] bool open(const std::filesystem::path& path);
+		void close() noexcept;
+
+		[[nodiscard]] bool is_open() const noexcept;
+		[[nodiscard]] std::span<const std::byte> get_data() const noexcept;
+
+		// Hints the range to the kernel and then touches one byte per page so it is resident when this returns
+		static void prefetch(std::span<const std::byte> range) noexcept;
+	private:
+		const std::byte* m_data{};
+		size_type m_size{};
+#if defined(_WIN32)
+		void* m_mapping{};
+#endif
+	};
+}
\ No newline at end of file
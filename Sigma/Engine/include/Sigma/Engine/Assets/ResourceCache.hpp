@@ -0,0 +1,391 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "Sigma/Engine/Assets/AssetId.hpp"
+
+namespace sigma
+{
+	// Slot index plus the generation of the slot at the time the handle was issued. A handle whose resource has been
+	// evicted keeps failing lookups even after its slot is reused.
+	struct ResourceHandle
+	{
+		static constexpr UInt32 k_invalid_index = std::numeric_limits<UInt32>::max();
+
+		UInt32 index{ k_invalid_index };
+		UInt32 generation{};
+
+		[[nodiscard]] constexpr bool is_valid() const noexcept { return index != k_invalid_index; }
+		[[nodiscard]] constexpr bool operator==(const ResourceHandle&) const noexcept = default;
+	};
+
+	struct ResourceCacheStatistics
+	{
+		UInt64 hits{};
+		UInt64 misses{};
+		UInt64 evictions{};
+		std::size_t resident_bytes{};
+		std::size_t resident_count{};
+	};
+
+	// Shared, reference counted resources keyed by hashed path ids. Concurrent acquires of a resource that is still
+	// loading wait for that load instead of starting another one. Resources nobody references stay cached and are
+	// evicted least recently released first once the resident bytes exceed the budget.
+	// Pointers returned by get() stay valid until the handle is released.
+	template <typename Resource>
+	class ResourceCache
+	{
+	public:
+		using size_type = std::size_t;
+		using resource_type = Resource;
+		// Fills the resource and its size in bytes, returns false if it could not be loaded. Called without the
+		// cache lock held, so loaders may block on I/O and different resources load in parallel. Must not throw.
+		using loader_type = std::function<bool(AssetId id, Resource& resource, size_type& byte_size)>;
+
+		ResourceCache(loader_type loader, size_type byte_budget);
+
+		ResourceCache(const ResourceCache&) = delete;
+		ResourceCache& operator=(const ResourceCache&) = delete;
+		ResourceCache(ResourceCache&&) = delete;
+		ResourceCache& operator=(ResourceCache&&) = delete;
+
+		// Returns an invalid handle if the loader failed
+		[[nodiscard]] ResourceHandle acquire(AssetId id);
+		[[nodiscard]] ResourceHandle acquire(std::string_view path);
+		// Adds a reference to a handle that is still valid
+		[[nodiscard]] bool retain(ResourceHandle handle);
+		void release(ResourceHandle handle);
+
+		[[nodiscard]] const Resource* get(ResourceHandle handle) const;
+		[[nodiscard]] bool is_valid(ResourceHandle handle) const;
+		[[nodiscard]] bool is_resident(AssetId id) const;
+
+		[[nodiscard]] size_type get_byte_budget() const;
+		void set_byte_budget(size_type byte_budget);
+		// Evicts every unreferenced resource
+		void clear_unused();
+
+		[[nodiscard]] ResourceCacheStatistics get_statistics() const;
+	private:
+		static constexpr UInt32 k_null_slot = std::numeric_limits<UInt32>::max();
+
+		enum class SlotState
+		{
+			free,
+			loading,
+			ready
+		};
+
+		struct Slot
+		{
+			std::optional<Resource> resource{};
+			AssetId id{};
+			size_type byte_size{};
+			UInt32 generation{};
+			UInt32 reference_count{};
+			SlotState state{ SlotState::free };
+			// Links in the LRU list of unreferenced resources, or the free list for free slots
+			UInt32 previous{ k_null_slot };
+			UInt32 next{ k_null_slot };
+		};
+
+		[[nodiscard]] Slot* find_slot(ResourceHandle handle);
+		[[nodiscard]] const Slot* find_slot(ResourceHandle handle) const;
+		[[nodiscard]] UInt32 allocate_slot();
+		void free_slot(UInt32 index);
+		void link_lru(UInt32 index);
+		void unlink_lru(UInt32 index);
+		void evict_over_budget(size_type byte_budget);
+		void evict(UInt32 index);
+
+		loader_type m_loader;
+		size_type m_byte_budget{};
+		// Deque so slots, and the resources inside them, never move when the cache grows
+		std::deque<Slot> m_slots{};
+		std::unordered_map<AssetId, UInt32> m_lookup{};
+		UInt32 m_free_head{ k_null_slot };
+		// Most recently released at the head, evicted from the tail
+		UInt32 m_lru_head{ k_null_slot };
+		UInt32 m_lru_tail{ k_null_slot };
+		ResourceCacheStatistics m_statistics{};
+		mutable std::mutex m_mutex{};
+		std::condition_variable m_load_condition{};
+	};
+
+
+	template <typename Resource>
+	ResourceCache<Resource>::ResourceCache(loader_type loader, const size_type byte_budget)
+		: m_loader{ std::move(loader) }, m_byte_budget{ byte_budget }
+	{
+	}
+
+	template <typename Resource>
+	ResourceHandle ResourceCache<Resource>::acquire(const AssetId id)
+	{
+		std::unique_lock lock{ m_mutex };
+		auto found = m_lookup.find(id);
+		if (found != m_lookup.end())
+		{
+			++m_statistics.hits;
+			m_load_condition.wait(lock, [&]()
+			{
+				found = m_lookup.find(id);
+				return found == m_lookup.end() || m_slots[found->second].state == SlotState::ready;
+			});
+			// The load this acquire waited for failed
+			if (found == m_lookup.end())
+			{
+				return {};
+			}
+
+			const auto index = found->second;
+			auto& slot = m_slots[index];
+			if (slot.reference_count++ == 0)
+			{
+				unlink_lru(index);
+			}
+			return { index, slot.generation };
+		}
+
+		++m_statistics.misses;
+		const auto index = allocate_slot();
+		m_slots[index].id = id;
+		m_slots[index].state = SlotState::loading;
+		m_slots[index].reference_count = 1;
+		m_lookup.emplace(id, index);
+		lock.unlock();
+
+		Resource resource{};
+		size_type byte_size{};
+		const auto loaded = m_loader(id, resource, byte_size);
+
+		lock.lock();
+		auto& slot = m_slots[index];
+		ResourceHandle handle{};
+		if (loaded)
+		{
+			slot.resource.emplace(std::move(resource));
+			slot.byte_size = byte_size;
+			slot.state = SlotState::ready;
+			m_statistics.resident_bytes += byte_size;
+			++m_statistics.resident_count;
+			handle = { index, slot.generation };
+		}
+		else
+		{
+			m_lookup.erase(id);
+			free_slot(index);
+		}
+		evict_over_budget(m_byte_budget);
+		m_load_condition.notify_all();
+		return handle;
+	}
+
+	template <typename Resource>
+	ResourceHandle ResourceCache<Resource>::acquire(const std::string_view path)
+	{
+		return acquire(make_asset_id(path));
+	}
+
+	template <typename Resource>
+	bool ResourceCache<Resource>::retain(const ResourceHandle handle)
+	{
+		std::lock_guard lock{ m_mutex };
+		auto* slot = find_slot(handle);
+		if (slot == nullptr)
+		{
+			return false;
+		}
+		if (slot->reference_count++ == 0)
+		{
+			unlink_lru(handle.index);
+		}
+		return true;
+	}
+
+	template <typename Resource>
+	void ResourceCache<Resource>::release(const ResourceHandle handle)
+	{
+		std::lock_guard lock{ m_mutex };
+		auto* slot = find_slot(handle);
+		if (slot == nullptr || slot->reference_count == 0)
+		{
+			return;
+		}
+		if (--slot->reference_count == 0)
+		{
+			link_lru(handle.index);
+			evict_over_budget(m_byte_budget);
+		}
+	}
+
+	template <typename Resource>
+	const Resource* ResourceCache<Resource>::get(const ResourceHandle handle) const
+	{
+		std::lock_guard lock{ m_mutex };
+		const auto* slot = find_slot(handle);
+		return slot != nullptr ? &*slot->resource : nullptr;
+	}
+
+	template <typename Resource>
+	bool ResourceCache<Resource>::is_valid(const ResourceHandle handle) const
+	{
+		std::lock_guard lock{ m_mutex };
+		return find_slot(handle) != nullptr;
+	}
+
+	template <typename Resource>
+	bool ResourceCache<Resource>::is_resident(const AssetId id) const
+	{
+		std::lock_guard lock{ m_mutex };
+		const auto found = m_lookup.find(id);
+		return found != m_lookup.end() && m_slots[found->second].state == SlotState::ready;
+	}
+
+	template <typename Resource>
+	typename ResourceCache<Resource>::size_type ResourceCache<Resource>::get_byte_budget() const
+	{
+		std::lock_guard lock{ m_mutex };
+		return m_byte_budget;
+	}
+
+	template <typename Resource>
+	void ResourceCache<Resource>::set_byte_budget(const size_type byte_budget)
+	{
+		std::lock_guard lock{ m_mutex };
+		m_byte_budget = byte_budget;
+		evict_over_budget(m_byte_budget);
+	}
+
+	template <typename Resource>
+	void ResourceCache<Resource>::clear_unused()
+	{
+		std::lock_guard lock{ m_mutex };
+		while (m_lru_tail != k_null_slot)
+		{
+			evict(m_lru_tail);
+		}
+	}
+
+	template <typename Resource>
+	ResourceCacheStatistics ResourceCache<Resource>::get_statistics() const
+	{
+		std::lock_guard lock{ m_mutex };
+		return m_statistics;
+	}
+
+	template <typename Resource>
+	typename ResourceCache<Resource>::Slot* ResourceCache<Resource>::find_slot(const ResourceHandle handle)
+	{
+		if (handle.index >= m_slots.size())
+		{
+			return nullptr;
+		}
+		auto& slot = m_slots[handle.index];
+		return slot.state == SlotState::ready && slot.generation == handle.generation ? &slot : nullptr;
+	}
+
+	template <typename Resource>
+	const typename ResourceCache<Resource>::Slot* ResourceCache<Resource>::find_slot(const ResourceHandle handle) const
+	{
+		return const_cast<ResourceCache*>(this)->find_slot(handle);
+	}
+
+	template <typename Resource>
+	UInt32 ResourceCache<Resource>::allocate_slot()
+	{
+		if (m_free_head == k_null_slot)
+		{
+			m_slots.emplace_back();
+			return static_cast<UInt32>(m_slots.size() - 1);
+		}
+
+		const auto index = m_free_head;
+		m_free_head = m_slots[index].next;
+		m_slots[index].next = k_null_slot;
+		return index;
+	}
+
+	template <typename Resource>
+	void ResourceCache<Resource>::free_slot(const UInt32 index)
+	{
+		auto& slot = m_slots[index];
+		slot.resource.reset();
+		slot.byte_size = 0;
+		slot.reference_count = 0;
+		slot.state = SlotState::free;
+		++slot.generation;
+		slot.previous = k_null_slot;
+		slot.next = m_free_head;
+		m_free_head = index;
+	}
+
+	template <typename Resource>
+	void ResourceCache<Resource>::link_lru(const UInt32 index)
+	{
+		auto& slot = m_slots[index];
+		slot.previous = k_null_slot;
+		slot.next = m_lru_head;
+		if (m_lru_head != k_null_slot)
+		{
+			m_slots[m_lru_head].previous = index;
+		}
+		m_lru_head = index;
+		if (m_lru_tail == k_null_slot)
+		{
+			m_lru_tail = index;
+		}
+	}
+
+	template <typename Resource>
+	void ResourceCache<Resource>::unlink_lru(const UInt32 index)
+	{
+		auto& slot = m_slots[index];
+		if (slot.previous != k_null_slot)
+		{
+			m_slots[slot.previous].next = slot.next;
+		}
+		else
+		{
+			m_lru_head = slot.next;
+		}
+		if (slot.next != k_null_slot)
+		{
+			m_slots[slot.next].previous = slot.previous;
+		}
+		else
+		{
+			m_lru_tail = slot.previous;
+		}
+		slot.previous = k_null_slot;
+		slot.next = k_null_slot;
+	}
+
+	template <typename Resource>
+	void ResourceCache<Resource>::evict_over_budget(const size_type byte_budget)
+	{
+		while (m_statistics.resident_bytes > byte_budget && m_lru_tail != k_null_slot)
+		{
+			evict(m_lru_tail);
+		}
+	}
+
+	template <typename Resource>
+	void ResourceCache<Resource>::evict(const UInt32 index)
+	{
+		auto& slot = m_slots[index];
+		unlink_lru(index);
+		m_statistics.resident_bytes -= slot.byte_size;
+		--m_statistics.resident_count;
+		++m_statistics.evictions;
+		m_lookup.erase(slot.id);
+		free_slot(index);
+	}
+}
\ No newline at end of file
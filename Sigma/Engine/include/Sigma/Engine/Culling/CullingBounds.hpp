@@ -0,0 +1,54 @@
+#pragma once
+
+#include <vector>
+
+#include "Sigma/Engine/DataStructures/SparseSet.hpp"
+#include "Sigma/Engine/Spatial/Bounds.hpp"
+
+namespace sigma
+{
+	struct BoundsStreams
+	{
+		const Float* center_x{};
+		const Float* center_y{};
+		const Float* center_z{};
+		const Float* radius{};
+		const Float* extent_x{};
+		const Float* extent_y{};
+		const Float* extent_z{};
+		std::size_t size{};
+	};
+
+	// World bounds of cullable entities as one float stream per component. Every entity carries a box (center and
+	// half extents) and the sphere enclosing it, so the culler can pick either test over the same streams.
+	class CullingBounds
+	{
+	public:
+		using size_type = std::size_t;
+
+		CullingBounds() = default;
+		explicit CullingBounds(size_type capacity);
+
+		void set(Entity entity, const Aabb& bounds);
+		void set(Entity entity, const Sphere& sphere);
+		void erase(Entity entity);
+
+		[[nodiscard]] size_type size() const noexcept;
+		[[nodiscard]] bool contains(Entity entity) const noexcept;
+		[[nodiscard]] Entity get_entity(size_type index) const noexcept;
+		[[nodiscard]] const std::vector<Entity>& get_entities() const noexcept;
+		[[nodiscard]] BoundsStreams get_streams() const noexcept;
+	private:
+		void set(Entity entity, const Vector3& center, const Vector3& extents, Float radius);
+
+		SparseSet<UInt32> m_slots{};
+		std::vector<Entity> m_entities{};
+		std::vector<Float> m_center_x{};
+		std::vector<Float> m_center_y{};
+		std::vector<Float> m_center_z{};
+		std::vector<Float> m_radius{};
+		std::vector<Float> m_extent_x{};
+		std::vector<Float> m_extent_y{};
+		std::vector<Float> m_extent_z{};
+	};
+}
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+
+#include "Sigma/Engine/common/types.hpp"
+
+namespace sigma
+{
+	// Planes point inwards: a point p is inside when dot(normal, p) + w >= 0 for all of them
+	struct Frustum
+	{
+		std::array<Vector4, 6> planes{};
+	};
+
+	// Gribb-Hartmann extraction for DirectX style row-vector matrices with a [0, 1] clip depth range
+	[[nodiscard]] inline Frustum make_frustum(const Matrix4x4& view_projection) noexcept
+	{
+		const auto& m = view_projection;
+		const auto normalize = [](const Float x, const Float y, const Float z, const Float w)
+		{
+			const auto inverse_length = 1.0f / std::sqrt(x * x + y * y + z * z);
+			return Vector4{ x * inverse_length, y * inverse_length, z * inverse_length, w * inverse_length };
+		};
+
+		return { {
+			normalize(m._14 + m._11, m._24 + m._21, m._34 + m._31, m._44 + m._41),
+			normalize(m._14 - m._11, m._24 - m._21, m._34 - m._31, m._44 - m._41),
+			normalize(m._14 + m._12, m._24 + m._22, m._34 + m._32, m._44 + m._42),
+			normalize(m._14 - m._12, m._24 - m._22, m._34 - m._32, m._44 - m._42),
+			normalize(m._13, m._23, m._33, m._43),
+			normalize(m._14 - m._13, m._24 - m._23, m._34 - m._33, m._44 - m._43)
+		} };
+	}
+}
\ No newline at end of file
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <vector>
+
+#include "Sigma/Engine/Culling/CullingBounds.hpp"
+#include "Sigma/Engine/Culling/Frustum.hpp"
+#include "Sigma/Engine/Jobs/JobSystem.hpp"
+
+namespace sigma
+{
+	enum class CullingVolume
+	{
+		sphere,
+		box
+	};
+
+	// Tests the bounds streams against the frustum several objects at a time and writes the dense indices of the
+	// visible ones into a compact list, in ascending order.
+	class FrustumCuller
+	{
+	public:
+		using size_type = std::size_t;
+
+		static constexpr size_type k_chunk_size = 4096;
+
+		void cull(const CullingBounds& bounds, const Frustum& frustum, CullingVolume volume, std::vector<UInt32>& visible, JobSystem& job_system);
+
+		// Writes the visible indices of [begin, end) to output, which needs room for end - begin entries
+		[[nodiscard]] static size_type cull(const BoundsStreams& streams, const Frustum& frustum, CullingVolume volume, size_type begin, size_type end, UInt32* output) noexcept;
+	private:
+		std::vector<UInt32> m_scratch{};
+		std::vector<size_type> m_chunk_offsets{};
+	};
+}
\ No newline at end of file
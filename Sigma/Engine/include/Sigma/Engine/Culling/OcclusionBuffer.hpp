@@ -0,0 +1,58 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "Sigma/Engine/Culling/CullingBounds.hpp"
+#include "Sigma/Engine/Jobs/JobSystem.hpp"
+
+namespace sigma
+{
+	// Low resolution depth buffer of the large occluders in view. Occludee boxes are tested against it through their
+	// projected screen rectangle and nearest depth, first per tile against the farthest depth in the tile.
+	class OcclusionBuffer
+	{
+	public:
+		using size_type = std::size_t;
+
+		static constexpr size_type k_tile_size = 8;
+		static constexpr size_type k_cull_grain_size = 1024;
+
+		OcclusionBuffer(size_type width, size_type height);
+
+		void clear(const Matrix4x4& view_projection);
+		void add_occluder(std::span<const Vector3> vertices, std::span<const UInt32> indices);
+		void add_occluder(const Aabb& bounds);
+		// Has to be called after the last occluder and before any test
+		void finalize();
+
+		[[nodiscard]] bool is_visible(const Aabb& bounds) const noexcept;
+		// Removes the occluded entries from a list of dense indices into bounds, keeping the order of the others
+		void cull(const CullingBounds& bounds, std::vector<UInt32>& visible, JobSystem& job_system);
+
+		[[nodiscard]] size_type get_width() const noexcept;
+		[[nodiscard]] size_type get_height() const noexcept;
+		[[nodiscard]] Float get_depth(size_type x, size_type y) const noexcept;
+	private:
+		struct ScreenVertex
+		{
+			Float x{};
+			Float y{};
+			Float z{};
+			Float w{};
+		};
+
+		[[nodiscard]] ScreenVertex project(const Vector3& point) const noexcept;
+		void rasterize(const ScreenVertex& a, const ScreenVertex& b, const ScreenVertex& c) noexcept;
+
+		size_type m_width;
+		size_type m_height;
+		size_type m_tile_columns;
+		size_type m_tile_rows;
+		Matrix4x4 m_view_projection{};
+		std::vector<Float> m_depth{};
+		std::vector<Float> m_tile_max_depth{};
+		std::vector<size_type> m_chunk_counts{};
+		bool m_finalized{};
+	};
+}
\ No newline at end of file
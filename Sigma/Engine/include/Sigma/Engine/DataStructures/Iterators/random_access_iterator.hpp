@@ -1,17 +1,22 @@
 # pragma once
 
+#include <cassert>
 #include <iterator>
+#include <type_traits>
 
 namespace sigma
 {
 	// TODO: Add concept for minimum requirement of the container
+	// Indexes the container on every access. SparseSet iterates over its dense storage with contiguous iterators
+	// instead, which the compiler can vectorize.
 	template <typename ContainerType, typename ElementType, typename SizeType>
 	class RandomAccessIterator
 	{
 	public:
 		using container_type = ContainerType;
 		using value_type = ElementType;
-		using difference_type = SizeType;
+		using size_type = SizeType;
+		using difference_type = std::make_signed_t<SizeType>;
 		using reference = ElementType&;
 		using pointer = ElementType*;
 		using iterator_category = std::random_access_iterator_tag;
@@ -21,8 +26,8 @@ namespace sigma
 		explicit RandomAccessIterator(container_type& container)
 			: m_container{ &(container) } {}
 		
-		RandomAccessIterator(container_type& container, difference_type offset)
-			: m_container{ &container }, m_offset{ offset } {};
+		RandomAccessIterator(container_type& container, size_type offset)
+			: m_container{ &container }, m_offset{ static_cast<difference_type>(offset) } {};
 
 		RandomAccessIterator& operator+=(const difference_type value) noexcept
 		{
@@ -38,12 +43,19 @@ namespace sigma
 
 		RandomAccessIterator operator+(const difference_type value) const noexcept
 		{
-			return { *m_container, m_offset + value };
+			auto result = *this;
+			return result += value;
+		}
+
+		friend RandomAccessIterator operator+(const difference_type value, const RandomAccessIterator& iterator) noexcept
+		{
+			return iterator + value;
 		}
 		
 		RandomAccessIterator operator-(const difference_type value) const noexcept
 		{
-			return { *m_container, m_offset - value };
+			auto result = *this;
+			return result -= value;
 		}
 
 		RandomAccessIterator& operator++() noexcept
@@ -60,12 +72,16 @@ namespace sigma
 		
 		RandomAccessIterator operator++(int) noexcept
 		{
-			return { *m_container, m_offset + 1 };
+			auto previous = *this;
+			++m_offset;
+			return previous;
 		}
 		
 		RandomAccessIterator operator--(int) noexcept
 		{
-			return { *m_container, m_offset - 1 };
+			auto previous = *this;
+			--m_offset;
+			return previous;
 		}
 
 		difference_type operator+(const RandomAccessIterator& other) const noexcept
@@ -112,8 +128,8 @@ namespace sigma
 
 		pointer operator->() const noexcept
 		{
-			assert(m_offset < m_container->size());
-			return &((*m_container)[m_offset]);
+			assert(m_offset >= 0 && static_cast<size_type>(m_offset) < m_container->size());
+			return &((*m_container)[static_cast<size_type>(m_offset)]);
 		}
 
 		reference operator*() const noexcept
@@ -121,6 +137,11 @@ namespace sigma
 			return *operator->();
 		}
 
+		reference operator[](const difference_type value) const noexcept
+		{
+			return *(*this + value);
+		}
+
 	private:
 		container_type* m_container{};
 		difference_type m_offset{};
@@ -131,8 +152,9 @@ namespace sigma
 	{
 	public:
 		using container_type = ContainerType;
-		using value_type = const ElementType;
-		using difference_type = SizeType;
+		using value_type = ElementType;
+		using size_type = SizeType;
+		using difference_type = std::make_signed_t<SizeType>;
 		using reference = const ElementType&;
 		using pointer = const ElementType*;
 		using iterator_category = std::random_access_iterator_tag;
@@ -142,8 +164,8 @@ namespace sigma
 		explicit ConstRandomAccessIterator(const container_type& container)
 			: m_container{ &(container) } {}
 
-		ConstRandomAccessIterator(const container_type& container, difference_type offset)
-			: m_container{ &container }, m_offset{ offset } {};
+		ConstRandomAccessIterator(const container_type& container, size_type offset)
+			: m_container{ &container }, m_offset{ static_cast<difference_type>(offset) } {};
 
 		ConstRandomAccessIterator& operator+=(const difference_type value) noexcept
 		{
@@ -159,12 +181,19 @@ namespace sigma
 
 		ConstRandomAccessIterator operator+(const difference_type value) const noexcept
 		{
-			return { *m_container, m_offset + value };
+			auto result = *this;
+			return result += value;
+		}
+
+		friend ConstRandomAccessIterator operator+(const difference_type value, const ConstRandomAccessIterator& iterator) noexcept
+		{
+			return iterator + value;
 		}
 
 		ConstRandomAccessIterator operator-(const difference_type value) const noexcept
 		{
-			return { *m_container, m_offset - value };
+			auto result = *this;
+			return result -= value;
 		}
 
 		ConstRandomAccessIterator& operator++() noexcept
@@ -181,12 +210,16 @@ namespace sigma
 
 		ConstRandomAccessIterator operator++(int) noexcept
 		{
-			return { *m_container, m_offset + 1 };
+			auto previous = *this;
+			++m_offset;
+			return previous;
 		}
 
 		ConstRandomAccessIterator operator--(int) noexcept
 		{
-			return { *m_container, m_offset - 1 };
+			auto previous = *this;
+			--m_offset;
+			return previous;
 		}
 
 		difference_type operator+(const ConstRandomAccessIterator& other) const noexcept
@@ -233,8 +266,8 @@ namespace sigma
 
 		pointer operator->() const noexcept
 		{
-			assert(m_offset < m_container->size());
-			return &((*m_container)[m_offset]);
+			assert(m_offset >= 0 && static_cast<size_type>(m_offset) < m_container->size());
+			return &((*m_container)[static_cast<size_type>(m_offset)]);
 		}
 
 		reference operator*() const noexcept
@@ -242,6 +275,11 @@ namespace sigma
 			return *operator->();
 		}
 
+		reference operator[](const difference_type value) const noexcept
+		{
+			return *(*this + value);
+		}
+
 	private:
 		const container_type* m_container{};
 		difference_type m_offset{};
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <type_traits>
+
+#include "Sigma/Engine/common/types.hpp"
+
+namespace sigma
+{
+	// Bounded lock-free queue for many producers and one consumer. Every cell carries a sequence number that tells
+	// producers and the consumer whose turn it is, so neither side ever waits on the other: a full queue fails the
+	// push and an empty one fails the pop.
+	template <typename T>
+	class MpscRingBuffer
+	{
+	public:
+		using element_type = T;
+		using size_type = std::size_t;
+
+		static_assert(std::is_trivially_copyable_v<T>, "Elements are copied in and out of shared cells");
+
+		// Capacity is rounded up to a power of two
+		explicit MpscRingBuffer(size_type capacity);
+
+		[[nodiscard]] bool try_push(const element_type& element) noexcept;
+		// Only one thread may pop
+		[[nodiscard]] bool try_pop(element_type& element) noexcept;
+
+		[[nodiscard]] size_type capacity() const noexcept;
+	private:
+		struct Cell
+		{
+			std::atomic<size_type> sequence{};
+			element_type element{};
+		};
+
+		std::unique_ptr<Cell[]> m_cells{};
+		size_type m_mask{};
+		alignas(64) std::atomic<size_type> m_push_position{};
+		alignas(64) size_type m_pop_position{};
+	};
+
+
+	template <typename T>
+	MpscRingBuffer<T>::MpscRingBuffer(const size_type capacity)
+		: m_cells{ std::make_unique<Cell[]>(std::bit_ceil(std::max<size_type>(capacity, 2))) }
+		, m_mask{ std::bit_ceil(std::max<size_type>(capacity, 2)) - 1 }
+	{
+		for (size_type index = 0; index <= m_mask; ++index)
+		{
+			m_cells[index].sequence.store(index, std::memory_order_relaxed);
+		}
+	}
+
+	template <typename T>
+	bool MpscRingBuffer<T>::try_push(const element_type& element) noexcept
+	{
+		auto position = m_push_position.load(std::memory_order_relaxed);
+		while (true)
+		{
+			auto& cell = m_cells[position & m_mask];
+			const auto sequence = cell.sequence.load(std::memory_order_acquire);
+			const auto difference = static_cast<std::make_signed_t<size_type>>(sequence - position);
+			if (difference == 0)
+			{
+				if (m_push_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					cell.element = element;
+					cell.sequence.store(position + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (difference < 0)
+			{
+				return false;
+			}
+			else
+			{
+				position = m_push_position.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	template <typename T>
+	bool MpscRingBuffer<T>::try_pop(element_type& element) noexcept
+	{
+		auto& cell = m_cells[m_pop_position & m_mask];
+		if (cell.sequence.load(std::memory_order_acquire) != m_pop_position + 1)
+		{
+			return false;
+		}
+
+		element = cell.element;
+		cell.sequence.store(m_pop_position + m_mask + 1, std::memory_order_release);
+		++m_pop_position;
+		return true;
+	}
+
+	template <typename T>
+	typename MpscRingBuffer<T>::size_type MpscRingBuffer<T>::capacity() const noexcept
+	{
+		return m_mask + 1;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "Sigma/Engine/DataStructures/SparseSet.hpp"
+#include "Sigma/Engine/Jobs/JobSystem.hpp"
+
+namespace sigma
+{
+	// SparseSet that many threads insert into at once. Each thread stages its inserts in its own shard, a pair of
+	// append-only columns on separate cache lines, so inserting takes no lock and touches no shared memory. merge()
+	// then splices every shard into the dense array of the set in one pass: a prefix sum over the shard sizes gives
+	// each staged element its final position, the dense array grows once, and workers move the elements and repoint
+	// the sparse slots of disjoint ranges in parallel. Staged elements are not visible in the set until the merge.
+	template <typename T>
+	class ShardedSparseSet
+	{
+	public:
+		using element_type = T;
+		using size_type = std::size_t;
+
+		static_assert(!std::is_empty_v<T>, "Tag components are inserted directly, they have no elements to stage");
+
+		class alignas(64) Shard
+		{
+		public:
+			// The index must not be in the set or staged in any shard during the same frame, as for spawned entities
+			template <typename... Args>
+			void emplace(size_type index, Args&&... args);
+
+			[[nodiscard]] size_type size() const noexcept;
+		private:
+			friend class ShardedSparseSet;
+
+			std::vector<size_type> m_indices{};
+			std::vector<element_type> m_elements{};
+			size_type m_max_index{};
+		};
+
+		// Typically one shard per worker plus one for the thread that runs parallel_for
+		ShardedSparseSet(size_type shard_count, size_type capacity);
+
+		[[nodiscard]] Shard& get_shard(size_type shard) noexcept;
+		[[nodiscard]] size_type get_shard_count() const noexcept;
+		[[nodiscard]] size_type get_staged_count() const noexcept;
+
+		// Moves every staged element into the set and empties the shards, which keep their memory for the next frame
+		void merge(JobSystem& jobs, size_type grain_size = 4096);
+
+		[[nodiscard]] SparseSet<element_type>& get_set() noexcept;
+		[[nodiscard]] const SparseSet<element_type>& get_set() const noexcept;
+	private:
+		SparseSet<element_type> m_set;
+		std::unique_ptr<Shard[]> m_shards;
+		size_type m_shard_count{};
+		// Position in the merged run where each shard starts, with the total at the end
+		std::vector<size_type> m_offsets{};
+	};
+
+
+	template <typename T>
+	template <typename... Args>
+	void ShardedSparseSet<T>::Shard::emplace(const size_type index, Args&&... args)
+	{
+		m_indices.push_back(index);
+		m_elements.emplace_back(std::forward<Args>(args)...);
+		m_max_index = std::max(m_max_index, index);
+	}
+
+	template <typename T>
+	typename ShardedSparseSet<T>::size_type ShardedSparseSet<T>::Shard::size() const noexcept
+	{
+		return m_indices.size();
+	}
+
+	template <typename T>
+	ShardedSparseSet<T>::ShardedSparseSet(const size_type shard_count, const size_type capacity)
+		: m_set{ capacity }, m_shards{ std::make_unique<Shard[]>(shard_count) }, m_shard_count{ shard_count },
+		m_offsets(shard_count + 1)
+	{
+		assert(shard_count > 0);
+	}
+
+	template <typename T>
+	typename ShardedSparseSet<T>::Shard& ShardedSparseSet<T>::get_shard(const size_type shard) noexcept
+	{
+		assert(shard < m_shard_count);
+		return m_shards[shard];
+	}
+
+	template <typename T>
+	typename ShardedSparseSet<T>::size_type ShardedSparseSet<T>::get_shard_count() const noexcept
+	{
+		return m_shard_count;
+	}
+
+	template <typename T>
+	typename ShardedSparseSet<T>::size_type ShardedSparseSet<T>::get_staged_count() const noexcept
+	{
+		size_type count{};
+		for (size_type shard = 0; shard < m_shard_count; ++shard)
+		{
+			count += m_shards[shard].size();
+		}
+		return count;
+	}
+
+	template <typename T>
+	void ShardedSparseSet<T>::merge(JobSystem& jobs, const size_type grain_size)
+	{
+		size_type max_index{};
+		for (size_type shard = 0; shard < m_shard_count; ++shard)
+		{
+			m_offsets[shard + 1] = m_offsets[shard] + m_shards[shard].size();
+			max_index = std::max(max_index, m_shards[shard].m_max_index);
+		}
+		const auto total = m_offsets.back();
+		if (total == 0)
+		{
+			return;
+		}
+
+		const auto base = m_set.extend(total, max_index);
+		jobs.parallel_for(0, total, grain_size, [&](const size_type begin, const size_type end)
+		{
+			// A chunk may span several shards, each contributes the part of its run that falls inside the chunk
+			auto shard = static_cast<size_type>(std::upper_bound(m_offsets.begin(), m_offsets.end(), begin) - m_offsets.begin()) - 1;
+			for (auto position = begin; position < end; ++shard)
+			{
+				auto& source = m_shards[shard];
+				const auto first = position - m_offsets[shard];
+				const auto last = std::min(end, m_offsets[shard + 1]) - m_offsets[shard];
+				std::move(source.m_elements.begin() + static_cast<std::ptrdiff_t>(first),
+					source.m_elements.begin() + static_cast<std::ptrdiff_t>(last), m_set.data() + base + position);
+				m_set.link(base + position, std::span{ source.m_indices }.subspan(first, last - first));
+				position += last - first;
+			}
+		});
+
+		for (size_type shard = 0; shard < m_shard_count; ++shard)
+		{
+			m_shards[shard].m_indices.clear();
+			m_shards[shard].m_elements.clear();
+			m_shards[shard].m_max_index = 0;
+		}
+	}
+
+	template <typename T>
+	SparseSet<typename ShardedSparseSet<T>::element_type>& ShardedSparseSet<T>::get_set() noexcept
+	{
+		return m_set;
+	}
+
+	template <typename T>
+	const SparseSet<typename ShardedSparseSet<T>::element_type>& ShardedSparseSet<T>::get_set() const noexcept
+	{
+		return m_set;
+	}
+}
\ No newline at end of file
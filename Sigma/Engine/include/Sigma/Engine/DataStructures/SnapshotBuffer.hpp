@@ -0,0 +1,291 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Sigma/Engine/common/types.hpp"
+
+namespace sigma
+{
+	// Single writer, many readers. The writer edits a table of fixed-size pages and publishes it as an immutable
+	// snapshot with one atomic store. Pages are shared between the writer and every snapshot that still references
+	// them, and the writer copies a page only when it modifies one that a snapshot holds, so publishing costs the
+	// page table and each frame copies only the pages it changed. Readers pin a snapshot slot with a counter and
+	// never block the writer or each other.
+	template <typename T>
+	class SnapshotBuffer
+	{
+	public:
+		using element_type = T;
+		using size_type = std::size_t;
+
+		static constexpr size_type k_page_size = 1024;
+		static constexpr size_type k_default_slot_count = 3;
+
+		class View;
+
+		// slot_count snapshots can be published or held at once, three gives triple buffering with a single reader
+		explicit SnapshotBuffer(size_type slot_count = k_default_slot_count);
+
+		SnapshotBuffer(const SnapshotBuffer&) = delete;
+		SnapshotBuffer& operator=(const SnapshotBuffer&) = delete;
+		SnapshotBuffer(SnapshotBuffer&&) = delete;
+		SnapshotBuffer& operator=(SnapshotBuffer&&) = delete;
+
+		// Writer side
+		void resize(size_type size);
+		[[nodiscard]] size_type size() const noexcept;
+		[[nodiscard]] const element_type& operator[](size_type index) const noexcept;
+		// Copies the page of the element first if a snapshot shares it
+		[[nodiscard]] element_type& write(size_type index);
+		// Resizes to the source and copies only the pages whose bytes changed, e.g. the dense array of a pool
+		void assign(std::span<const element_type> source);
+		// Returns false, keeping the previous snapshot current, when readers still hold every other slot
+		bool publish(UInt64 frame);
+		[[nodiscard]] size_type get_copied_page_count() const noexcept;
+
+		// Reader side, safe from any thread. The view is empty until the first publish.
+		[[nodiscard]] View acquire() const noexcept;
+	private:
+		using page_type = std::array<element_type, k_page_size>;
+
+		static constexpr UInt32 k_no_slot = static_cast<UInt32>(-1);
+
+		struct alignas(64) Slot
+		{
+			std::vector<std::shared_ptr<const page_type>> pages{};
+			size_type size{};
+			UInt64 frame{};
+			mutable std::atomic<UInt32> readers{};
+		};
+
+		[[nodiscard]] page_type& get_writable_page(size_type page);
+
+		std::vector<std::shared_ptr<page_type>> m_pages{};
+		size_type m_size{};
+		size_type m_copied_page_count{};
+		std::unique_ptr<Slot[]> m_slots;
+		size_type m_slot_count{};
+		std::atomic<UInt32> m_current{ k_no_slot };
+	};
+
+	// Immutable snapshot of one published frame, valid until the view is destroyed
+	template <typename T>
+	class SnapshotBuffer<T>::View
+	{
+	public:
+		View() = default;
+		~View();
+
+		View(const View&) = delete;
+		View& operator=(const View&) = delete;
+		View(View&& other) noexcept;
+		View& operator=(View&& other) noexcept;
+
+		[[nodiscard]] bool is_valid() const noexcept;
+		[[nodiscard]] size_type size() const noexcept;
+		[[nodiscard]] UInt64 get_frame() const noexcept;
+		[[nodiscard]] const element_type& operator[](size_type index) const noexcept;
+	private:
+		friend class SnapshotBuffer;
+
+		explicit View(const Slot* slot) noexcept;
+
+		const Slot* m_slot{};
+	};
+
+
+	template <typename T>
+	SnapshotBuffer<T>::SnapshotBuffer(const size_type slot_count)
+		: m_slots{ std::make_unique<Slot[]>(slot_count) }, m_slot_count{ slot_count }
+	{
+		assert(slot_count >= 2);
+	}
+
+	template <typename T>
+	void SnapshotBuffer<T>::resize(const size_type size)
+	{
+		m_pages.resize((size + k_page_size - 1) / k_page_size);
+		for (auto& page : m_pages)
+		{
+			if (!page)
+			{
+				page = std::make_shared<page_type>();
+			}
+		}
+		m_size = size;
+	}
+
+	template <typename T>
+	typename SnapshotBuffer<T>::size_type SnapshotBuffer<T>::size() const noexcept
+	{
+		return m_size;
+	}
+
+	template <typename T>
+	const typename SnapshotBuffer<T>::element_type& SnapshotBuffer<T>::operator[](const size_type index) const noexcept
+	{
+		assert(index < m_size);
+		return (*m_pages[index / k_page_size])[index % k_page_size];
+	}
+
+	template <typename T>
+	typename SnapshotBuffer<T>::element_type& SnapshotBuffer<T>::write(const size_type index)
+	{
+		assert(index < m_size);
+		return get_writable_page(index / k_page_size)[index % k_page_size];
+	}
+
+	template <typename T>
+	void SnapshotBuffer<T>::assign(std::span<const element_type> source)
+	{
+		static_assert(std::is_trivially_copyable_v<element_type>, "Pages are compared and copied as bytes");
+
+		resize(source.size());
+		for (size_type page = 0; page < m_pages.size(); ++page)
+		{
+			const auto begin = page * k_page_size;
+			const auto count = std::min(k_page_size, source.size() - begin);
+			const auto bytes = count * sizeof(element_type);
+			if (std::memcmp(m_pages[page]->data(), source.data() + begin, bytes) != 0)
+			{
+				std::memcpy(get_writable_page(page).data(), source.data() + begin, bytes);
+			}
+		}
+	}
+
+	template <typename T>
+	bool SnapshotBuffer<T>::publish(const UInt64 frame)
+	{
+		const auto current = m_current.load(std::memory_order_relaxed);
+		auto target = k_no_slot;
+		for (UInt32 slot = 0; slot < m_slot_count; ++slot)
+		{
+			// A reader that pinned this slot after it stopped being current backs out without reading it
+			if (slot != current && m_slots[slot].readers.load() == 0)
+			{
+				target = slot;
+				break;
+			}
+		}
+		if (target == k_no_slot)
+		{
+			return false;
+		}
+
+		auto& snapshot = m_slots[target];
+		snapshot.pages.assign(m_pages.begin(), m_pages.end());
+		snapshot.size = m_size;
+		snapshot.frame = frame;
+		m_current.store(target);
+		return true;
+	}
+
+	template <typename T>
+	typename SnapshotBuffer<T>::size_type SnapshotBuffer<T>::get_copied_page_count() const noexcept
+	{
+		return m_copied_page_count;
+	}
+
+	template <typename T>
+	typename SnapshotBuffer<T>::View SnapshotBuffer<T>::acquire() const noexcept
+	{
+		while (true)
+		{
+			const auto slot = m_current.load();
+			if (slot == k_no_slot)
+			{
+				return {};
+			}
+
+			// Pin first, then confirm the slot is still current, the writer only reuses slots nobody has pinned
+			m_slots[slot].readers.fetch_add(1);
+			if (m_current.load() == slot)
+			{
+				return View{ &m_slots[slot] };
+			}
+			m_slots[slot].readers.fetch_sub(1, std::memory_order_release);
+		}
+	}
+
+	template <typename T>
+	typename SnapshotBuffer<T>::page_type& SnapshotBuffer<T>::get_writable_page(const size_type page)
+	{
+		// Only the writer changes reference counts, readers pin slots, so a count of one means no snapshot has it
+		auto& pointer = m_pages[page];
+		if (pointer.use_count() > 1)
+		{
+			pointer = std::make_shared<page_type>(*pointer);
+			++m_copied_page_count;
+		}
+		return *pointer;
+	}
+
+	template <typename T>
+	SnapshotBuffer<T>::View::View(const Slot* slot) noexcept
+		: m_slot{ slot }
+	{
+	}
+
+	template <typename T>
+	SnapshotBuffer<T>::View::~View()
+	{
+		if (m_slot != nullptr)
+		{
+			m_slot->readers.fetch_sub(1, std::memory_order_release);
+		}
+	}
+
+	template <typename T>
+	SnapshotBuffer<T>::View::View(View&& other) noexcept
+		: m_slot{ std::exchange(other.m_slot, nullptr) }
+	{
+	}
+
+	template <typename T>
+	typename SnapshotBuffer<T>::View& SnapshotBuffer<T>::View::operator=(View&& other) noexcept
+	{
+		if (this != &other)
+		{
+			if (m_slot != nullptr)
+			{
+				m_slot->readers.fetch_sub(1, std::memory_order_release);
+			}
+			m_slot = std::exchange(other.m_slot, nullptr);
+		}
+		return *this;
+	}
+
+	template <typename T>
+	bool SnapshotBuffer<T>::View::is_valid() const noexcept
+	{
+		return m_slot != nullptr;
+	}
+
+	template <typename T>
+	typename SnapshotBuffer<T>::size_type SnapshotBuffer<T>::View::size() const noexcept
+	{
+		return m_slot != nullptr ? m_slot->size : 0;
+	}
+
+	template <typename T>
+	UInt64 SnapshotBuffer<T>::View::get_frame() const noexcept
+	{
+		return m_slot != nullptr ? m_slot->frame : 0;
+	}
+
+	template <typename T>
+	const typename SnapshotBuffer<T>::element_type& SnapshotBuffer<T>::View::operator[](const size_type index) const noexcept
+	{
+		assert(index < size());
+		return (*m_slot->pages[index / k_page_size])[index % k_page_size];
+	}
+}
\ No newline at end of file
@@ -1,22 +1,28 @@
 #pragma once
 
 #include <cassert>
+#include <limits>
+#include <type_traits>
 #include <vector>
 #include <algorithm>
+#include <numeric>
+#include <span>
 
+#include "Sigma/Engine/common/types.hpp"
 #include "Sigma/Engine/Utilities/vector_utils.hpp"
-#include "Sigma/Engine/DataStructures/Iterators/random_access_iterator.hpp"
 
 namespace sigma
 {
+	// Iterators walk the dense storage directly and model std::contiguous_iterator, so the set works with ranges
+	// algorithms and execution policies, and loops over it vectorize like loops over an array.
 	template <typename T>
 	class SparseSet
 	{
 	public:
 		using element_type = T;
 		using size_type = std::size_t;
-		using iterator_type = RandomAccessIterator<std::vector<element_type>, element_type, size_type>;
-		using const_iterator_type = ConstRandomAccessIterator<std::vector<element_type>, element_type, size_type>;
+		using iterator_type = typename std::span<element_type>::iterator;
+		using const_iterator_type = typename std::span<const element_type>::iterator;
 
 		SparseSet() = default;
 		explicit SparseSet(size_type capacity);
@@ -24,10 +30,24 @@ namespace sigma
 		template <typename... Args>
 		void emplace(size_type index, Args&& ...args);
 		void add_reference(size_type index, size_type reference_index) noexcept;
+		// Bulk insertion for parallel producers in two steps. extend() appends count default-constructed elements
+		// and sizes the sparse array for indices up to max_index, returning the first new dense position. The caller
+		// fills the elements through data(), then link() assigns a run of new positions to their indices. Disjoint
+		// runs may be filled and linked concurrently. The indices must not already be in the set.
+		[[nodiscard]] size_type extend(size_type count, size_type max_index);
+		void link(size_type dense_begin, std::span<const size_type> indices) noexcept;
 
 		void erase(size_type index) noexcept;
+		// Erases every index at once: the survivors are packed in their dense order and the sparse array is walked
+		// a fixed number of times, instead of once per erased index. Indices not in the set are ignored.
+		void erase(std::span<const size_type> indices);
 
 		void reserve(size_type capacity);
+
+		template <typename Compare>
+		void sort(Compare compare);
+		// Moves the element at dense position order[i] to dense position i and repoints every sparse slot
+		void reorder(const std::vector<size_type>& order);
 		
 		[[nodiscard]] auto capacity() const noexcept;
 		[[nodiscard]] auto size() const noexcept;
@@ -41,6 +61,19 @@ namespace sigma
 		[[nodiscard]] const_iterator_type cend() const noexcept;
 		[[nodiscard]] iterator_type begin() noexcept;
 		[[nodiscard]] iterator_type end() noexcept;
+		[[nodiscard]] const_iterator_type begin() const noexcept;
+		[[nodiscard]] const_iterator_type end() const noexcept;
+
+		[[nodiscard]] element_type* data() noexcept;
+		[[nodiscard]] const element_type* data() const noexcept;
+		[[nodiscard]] std::span<element_type> get_elements() noexcept;
+		[[nodiscard]] std::span<const element_type> get_elements() const noexcept;
+
+		[[nodiscard]] size_type get_dense_index(size_type index) const noexcept;
+		// Sparse index that owns the element at a dense position, the inverse of get_dense_index
+		[[nodiscard]] size_type get_index(size_type dense_index) const noexcept;
+		// Owning sparse indices in dense order, so the set can be walked by index without probing every slot
+		[[nodiscard]] const std::vector<size_type>& get_indices() const noexcept;
 
 		[[nodiscard]] element_type* get_element_pointer(size_type index) noexcept;
 		[[nodiscard]] const element_type* get_element_pointer(size_type index) const noexcept;
@@ -55,6 +88,80 @@ namespace sigma
 	private:		
 		std::vector<element_type> m_dense{};
 		std::vector<element_type*> m_sparse{};
+		std::vector<size_type> m_indices{};
+	};
+
+	// Membership-only set for empty tag components: a dense list of indices and, per sparse slot, the dense position
+	// plus one in 32 bits, with zero meaning absent. Every member shares one element instance, so no storage is spent
+	// on the elements themselves and iteration yields the indices. There is no element array, so data() and
+	// get_elements() do not exist; code that reads elements by dense position uses operator[] or get_element instead.
+	template <typename T>
+		requires std::is_empty_v<T>
+	class SparseSet<T>
+	{
+	public:
+		using element_type = T;
+		using size_type = std::size_t;
+		using iterator_type = typename std::vector<size_type>::const_iterator;
+		using const_iterator_type = iterator_type;
+
+		SparseSet() = default;
+		explicit SparseSet(size_type capacity);
+
+		template <typename... Args>
+		void emplace(size_type index, Args&& ...args);
+		void add_reference(size_type index, size_type reference_index) noexcept;
+		// Same two steps as the general set, only there are no elements to fill between them
+		[[nodiscard]] size_type extend(size_type count, size_type max_index);
+		void link(size_type dense_begin, std::span<const size_type> indices) noexcept;
+
+		void erase(size_type index) noexcept;
+		// Packs the surviving indices in order and repoints only their slots while there are no references
+		void erase(std::span<const size_type> indices) noexcept;
+
+		void reserve(size_type capacity);
+
+		// All elements compare equal, so the stable sort keeps the current order
+		template <typename Compare>
+		void sort(Compare compare);
+		// Moves the index at dense position order[i] to dense position i
+		void reorder(const std::vector<size_type>& order);
+
+		[[nodiscard]] auto capacity() const noexcept;
+		[[nodiscard]] auto size() const noexcept;
+
+		[[nodiscard]] bool is_empty() const noexcept;
+		[[nodiscard]] bool is_full() const noexcept;
+
+		[[nodiscard]] bool has_element(size_type index) const noexcept;
+
+		[[nodiscard]] const_iterator_type cbegin() const noexcept;
+		[[nodiscard]] const_iterator_type cend() const noexcept;
+		[[nodiscard]] iterator_type begin() const noexcept;
+		[[nodiscard]] iterator_type end() const noexcept;
+
+		[[nodiscard]] size_type get_dense_index(size_type index) const noexcept;
+		[[nodiscard]] size_type get_index(size_type dense_index) const noexcept;
+		[[nodiscard]] const std::vector<size_type>& get_indices() const noexcept;
+
+		[[nodiscard]] element_type* get_element_pointer(size_type index) noexcept;
+		[[nodiscard]] const element_type* get_element_pointer(size_type index) const noexcept;
+
+		[[nodiscard]] element_type& get_element(size_type index) noexcept;
+		[[nodiscard]] const element_type& get_element(size_type index) const noexcept;
+
+		[[nodiscard]] element_type& operator[](size_type index) noexcept;
+		[[nodiscard]] const element_type& operator[](size_type index) const noexcept;
+
+		void clear();
+	private:
+		[[nodiscard]] static element_type& get_shared_element() noexcept;
+
+		std::vector<size_type> m_indices{};
+		std::vector<UInt32> m_positions{};
+		// Slots added with add_reference that share the position of another member. While there are none, erase and
+		// reorder only touch the slots of the members themselves.
+		size_type m_reference_count{};
 	};
 
 	
@@ -73,6 +180,7 @@ namespace sigma
 		erase(index);
 		
 		m_dense.emplace_back(std::forward<Args>(args)...);	
+		m_indices.push_back(index);
 		safe_assignment(m_sparse, index, &m_dense.back());
 	}
 
@@ -82,6 +190,35 @@ namespace sigma
 		safe_assignment(m_sparse, index, get_element_pointer(reference_index));
 	}
 
+	template <typename T>
+	typename SparseSet<T>::size_type SparseSet<T>::extend(const size_type count, const size_type max_index)
+	{
+		assert(size() + count <= capacity());
+
+		const auto begin = m_dense.size();
+		m_dense.resize(begin + count);
+		m_indices.resize(begin + count);
+		if (m_sparse.size() <= max_index)
+		{
+			m_sparse.resize(max_index + 1);
+		}
+		return begin;
+	}
+
+	template <typename T>
+	void SparseSet<T>::link(const size_type dense_begin, std::span<const size_type> indices) noexcept
+	{
+		assert(dense_begin + indices.size() <= m_dense.size());
+
+		for (size_type offset = 0; offset < indices.size(); ++offset)
+		{
+			const auto index = indices[offset];
+			assert(index < m_sparse.size() && !m_sparse[index]);
+			m_indices[dense_begin + offset] = index;
+			m_sparse[index] = m_dense.data() + dense_begin + offset;
+		}
+	}
+
 	template <typename T>
 	void SparseSet<T>::erase(const size_type index) noexcept
 	{
@@ -97,11 +234,19 @@ namespace sigma
 		if (reference_count > 1)
 		{
 			m_sparse[index] = nullptr;
+			// Hand ownership to one of the remaining references
+			auto& owner = m_indices[static_cast<size_type>(item_address - m_dense.data())];
+			if (owner == index)
+			{
+				owner = static_cast<size_type>(std::find(m_sparse.cbegin(), m_sparse.cend(), item_address) - m_sparse.cbegin());
+			}
 			return;
 		}
 		
 		auto back_address = &m_dense.back();
 		std::swap(*item_address, *back_address);
+		m_indices[static_cast<size_type>(item_address - m_dense.data())] = m_indices.back();
+		m_indices.pop_back();
 
 		std::replace_if(m_sparse.begin(), m_sparse.end(),
 			[=](const element_type* address)
@@ -122,11 +267,122 @@ namespace sigma
 		m_dense.pop_back();
 	}
 
+	template <typename T>
+	void SparseSet<T>::erase(const std::span<const size_type> indices)
+	{
+		constexpr auto k_erased = std::numeric_limits<size_type>::max();
+
+		// Positions lose their element only once no reference to them is left, which one pass over the slots tells
+		std::vector<size_type> new_positions(m_dense.size());
+		auto erased_count = size_type{ 0 };
+		for (const auto index : indices)
+		{
+			if (has_element(index))
+			{
+				new_positions[static_cast<size_type>(m_sparse[index] - m_dense.data())] = k_erased;
+				m_sparse[index] = nullptr;
+				++erased_count;
+			}
+		}
+		if (erased_count == 0)
+		{
+			return;
+		}
+
+		for (size_type index = 0; index < m_sparse.size(); ++index)
+		{
+			const auto address = m_sparse[index];
+			if (address && new_positions[static_cast<size_type>(address - m_dense.data())] == k_erased)
+			{
+				// Hand ownership to one of the remaining references
+				const auto position = static_cast<size_type>(address - m_dense.data());
+				new_positions[position] = 0;
+				m_indices[position] = index;
+			}
+		}
+
+		size_type kept = 0;
+		for (size_type position = 0; position < m_dense.size(); ++position)
+		{
+			if (new_positions[position] == k_erased)
+			{
+				continue;
+			}
+			if (kept != position)
+			{
+				m_dense[kept] = std::move(m_dense[position]);
+				m_indices[kept] = m_indices[position];
+			}
+			new_positions[position] = kept++;
+		}
+		m_dense.erase(m_dense.begin() + static_cast<std::ptrdiff_t>(kept), m_dense.end());
+		m_indices.resize(kept);
+
+		for (auto& address : m_sparse)
+		{
+			if (address)
+			{
+				address = m_dense.data() + new_positions[static_cast<size_type>(address - m_dense.data())];
+			}
+		}
+	}
+
 	template <typename T>
 	void SparseSet<T>::reserve(const size_type capacity)
 	{
 		assert(is_empty());
 		m_dense.reserve(capacity);
+		m_indices.reserve(capacity);
+	}
+
+	template <typename T>
+	template <typename Compare>
+	void SparseSet<T>::sort(Compare compare)
+	{
+		std::vector<size_type> order(m_dense.size());
+		std::iota(order.begin(), order.end(), size_type{ 0 });
+		std::stable_sort(order.begin(), order.end(),
+			[&](const size_type lhs, const size_type rhs)
+			{
+				return compare(m_dense[lhs], m_dense[rhs]);
+			}
+		);
+
+		reorder(order);
+	}
+
+	template <typename T>
+	void SparseSet<T>::reorder(const std::vector<size_type>& order)
+	{
+		assert(order.size() == m_dense.size());
+
+		std::vector<size_type> new_positions(order.size());
+		for (size_type position = 0; position < order.size(); ++position)
+		{
+			new_positions[order[position]] = position;
+		}
+
+		std::vector<element_type> reordered{};
+		reordered.reserve(m_dense.capacity());
+		std::vector<size_type> reordered_indices{};
+		reordered_indices.reserve(m_indices.capacity());
+		for (const auto old_position : order)
+		{
+			reordered.emplace_back(std::move(m_dense[old_position]));
+			reordered_indices.push_back(m_indices[old_position]);
+		}
+		m_indices.swap(reordered_indices);
+
+		const auto old_data = m_dense.data();
+		m_dense.swap(reordered);
+
+		for (auto& address : m_sparse)
+		{
+			if (address)
+			{
+				address = m_dense.data() + new_positions[static_cast<size_type>(address - old_data)];
+			}
+		}
 	}
 
 	template <typename T>
@@ -162,25 +418,80 @@ namespace sigma
 	template <typename T>
 	typename SparseSet<T>::const_iterator_type SparseSet<T>::cbegin() const noexcept
 	{
-		return { m_dense, 0 };
+		return get_elements().begin();
 	}
 
 	template <typename T>
 	typename SparseSet<T>::const_iterator_type SparseSet<T>::cend() const noexcept
 	{
-		return { m_dense, m_dense.size() };
+		return get_elements().end();
 	}
 
 	template <typename T>
 	typename SparseSet<T>::iterator_type SparseSet<T>::begin() noexcept
 	{
-		return { m_dense, 0 };
+		return get_elements().begin();
 	}
 
 	template <typename T>
 	typename SparseSet<T>::iterator_type SparseSet<T>::end() noexcept
 	{
-		return { m_dense, m_dense.size() };
+		return get_elements().end();
+	}
+
+	template <typename T>
+	typename SparseSet<T>::const_iterator_type SparseSet<T>::begin() const noexcept
+	{
+		return get_elements().begin();
+	}
+
+	template <typename T>
+	typename SparseSet<T>::const_iterator_type SparseSet<T>::end() const noexcept
+	{
+		return get_elements().end();
+	}
+
+	template <typename T>
+	typename SparseSet<T>::element_type* SparseSet<T>::data() noexcept
+	{
+		return m_dense.data();
+	}
+
+	template <typename T>
+	const typename SparseSet<T>::element_type* SparseSet<T>::data() const noexcept
+	{
+		return m_dense.data();
+	}
+
+	template <typename T>
+	std::span<typename SparseSet<T>::element_type> SparseSet<T>::get_elements() noexcept
+	{
+		return m_dense;
+	}
+
+	template <typename T>
+	std::span<const typename SparseSet<T>::element_type> SparseSet<T>::get_elements() const noexcept
+	{
+		return m_dense;
+	}
+
+	template <typename T>
+	typename SparseSet<T>::size_type SparseSet<T>::get_dense_index(const size_type index) const noexcept
+	{
+		assert(has_element(index));
+		return static_cast<size_type>(m_sparse[index] - m_dense.data());
+	}
+
+	template <typename T>
+	typename SparseSet<T>::size_type SparseSet<T>::get_index(const size_type dense_index) const noexcept
+	{
+		return m_indices[dense_index];
+	}
+
+	template <typename T>
+	const std::vector<typename SparseSet<T>::size_type>& SparseSet<T>::get_indices() const noexcept
+	{
+		return m_indices;
 	}
 
 	template <typename T>
@@ -224,5 +535,345 @@ namespace sigma
 	{
 		m_dense.clear();
 		m_sparse.clear();
+		m_indices.clear();
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	SparseSet<T>::SparseSet(const size_type capacity)
+	{
+		reserve(capacity);
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	template <typename... Args>
+	void SparseSet<T>::emplace(const size_type index, Args&&...)
+	{
+		assert(size() < capacity());
+
+		erase(index);
+		assert(m_indices.size() < std::numeric_limits<UInt32>::max());
+
+		m_indices.push_back(index);
+		safe_assignment(m_positions, index, static_cast<UInt32>(m_indices.size()));
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	void SparseSet<T>::add_reference(const size_type index, const size_type reference_index) noexcept
+	{
+		if (index == reference_index)
+		{
+			return;
+		}
+
+		erase(index);
+		if (has_element(reference_index))
+		{
+			safe_assignment(m_positions, index, m_positions[reference_index]);
+			++m_reference_count;
+		}
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	typename SparseSet<T>::size_type SparseSet<T>::extend(const size_type count, const size_type max_index)
+	{
+		assert(size() + count <= capacity());
+		assert(m_indices.size() + count < std::numeric_limits<UInt32>::max());
+
+		const auto begin = m_indices.size();
+		m_indices.resize(begin + count);
+		if (m_positions.size() <= max_index)
+		{
+			m_positions.resize(max_index + 1);
+		}
+		return begin;
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	void SparseSet<T>::link(const size_type dense_begin, std::span<const size_type> indices) noexcept
+	{
+		assert(dense_begin + indices.size() <= m_indices.size());
+
+		for (size_type offset = 0; offset < indices.size(); ++offset)
+		{
+			const auto index = indices[offset];
+			assert(index < m_positions.size() && m_positions[index] == 0);
+			m_indices[dense_begin + offset] = index;
+			m_positions[index] = static_cast<UInt32>(dense_begin + offset + 1);
+		}
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	void SparseSet<T>::erase(const size_type index) noexcept
+	{
+		if (!has_element(index))
+		{
+			return;
+		}
+
+		const auto position = m_positions[index];
+		if (m_reference_count != 0 && std::count(m_positions.cbegin(), m_positions.cend(), position) > 1)
+		{
+			m_positions[index] = 0;
+			--m_reference_count;
+			// Hand ownership to one of the remaining references
+			auto& owner = m_indices[position - 1];
+			if (owner == index)
+			{
+				owner = static_cast<size_type>(std::find(m_positions.cbegin(), m_positions.cend(), position) - m_positions.cbegin());
+			}
+			return;
+		}
+
+		const auto back_position = static_cast<UInt32>(m_indices.size());
+		m_positions[index] = 0;
+		m_indices[position - 1] = m_indices.back();
+		m_indices.pop_back();
+		if (position == back_position)
+		{
+			return;
+		}
+
+		if (m_reference_count == 0)
+		{
+			m_positions[m_indices[position - 1]] = position;
+		}
+		else
+		{
+			std::replace(m_positions.begin(), m_positions.end(), back_position, position);
+		}
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	void SparseSet<T>::erase(const std::span<const size_type> indices) noexcept
+	{
+		// References would need a search over every slot, they keep the erase of one index at a time
+		if (m_reference_count != 0)
+		{
+			for (const auto index : indices)
+			{
+				erase(index);
+			}
+			return;
+		}
+
+		constexpr auto k_erased = std::numeric_limits<size_type>::max();
+		for (const auto index : indices)
+		{
+			if (has_element(index))
+			{
+				m_indices[m_positions[index] - 1] = k_erased;
+				m_positions[index] = 0;
+			}
+		}
+
+		std::erase(m_indices, k_erased);
+		for (size_type position = 0; position < m_indices.size(); ++position)
+		{
+			m_positions[m_indices[position]] = static_cast<UInt32>(position + 1);
+		}
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	void SparseSet<T>::reserve(const size_type capacity)
+	{
+		assert(is_empty());
+		m_indices.reserve(capacity);
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	template <typename Compare>
+	void SparseSet<T>::sort(Compare)
+	{
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	void SparseSet<T>::reorder(const std::vector<size_type>& order)
+	{
+		assert(order.size() == m_indices.size());
+
+		std::vector<size_type> reordered{};
+		reordered.reserve(m_indices.capacity());
+		for (const auto old_position : order)
+		{
+			reordered.push_back(m_indices[old_position]);
+		}
+		m_indices.swap(reordered);
+
+		if (m_reference_count == 0)
+		{
+			for (size_type position = 0; position < m_indices.size(); ++position)
+			{
+				m_positions[m_indices[position]] = static_cast<UInt32>(position + 1);
+			}
+			return;
+		}
+
+		std::vector<UInt32> new_positions(order.size());
+		for (size_type position = 0; position < order.size(); ++position)
+		{
+			new_positions[order[position]] = static_cast<UInt32>(position + 1);
+		}
+		for (auto& position : m_positions)
+		{
+			if (position != 0)
+			{
+				position = new_positions[position - 1];
+			}
+		}
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	auto SparseSet<T>::capacity() const noexcept
+	{
+		return m_indices.capacity();
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	auto SparseSet<T>::size() const noexcept
+	{
+		return m_indices.size();
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	bool SparseSet<T>::is_empty() const noexcept
+	{
+		return m_indices.empty();
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	bool SparseSet<T>::is_full() const noexcept
+	{
+		return m_indices.size() >= m_indices.capacity();
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	bool SparseSet<T>::has_element(const size_type index) const noexcept
+	{
+		return index < m_positions.size() && m_positions[index] != 0;
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	typename SparseSet<T>::const_iterator_type SparseSet<T>::cbegin() const noexcept
+	{
+		return m_indices.cbegin();
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	typename SparseSet<T>::const_iterator_type SparseSet<T>::cend() const noexcept
+	{
+		return m_indices.cend();
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	typename SparseSet<T>::iterator_type SparseSet<T>::begin() const noexcept
+	{
+		return m_indices.cbegin();
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	typename SparseSet<T>::iterator_type SparseSet<T>::end() const noexcept
+	{
+		return m_indices.cend();
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	typename SparseSet<T>::size_type SparseSet<T>::get_dense_index(const size_type index) const noexcept
+	{
+		assert(has_element(index));
+		return m_positions[index] - size_type{ 1 };
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	typename SparseSet<T>::size_type SparseSet<T>::get_index(const size_type dense_index) const noexcept
+	{
+		return m_indices[dense_index];
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	const std::vector<typename SparseSet<T>::size_type>& SparseSet<T>::get_indices() const noexcept
+	{
+		return m_indices;
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	typename SparseSet<T>::element_type* SparseSet<T>::get_element_pointer(const size_type index) noexcept
+	{
+		return has_element(index) ? &get_shared_element() : nullptr;
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	const typename SparseSet<T>::element_type* SparseSet<T>::get_element_pointer(const size_type index) const noexcept
+	{
+		return has_element(index) ? &get_shared_element() : nullptr;
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	typename SparseSet<T>::element_type& SparseSet<T>::get_element(const size_type) noexcept
+	{
+		return get_shared_element();
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	const typename SparseSet<T>::element_type& SparseSet<T>::get_element(const size_type) const noexcept
+	{
+		return get_shared_element();
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	typename SparseSet<T>::element_type& SparseSet<T>::operator[](const size_type) noexcept
+	{
+		return get_shared_element();
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	const typename SparseSet<T>::element_type& SparseSet<T>::operator[](const size_type) const noexcept
+	{
+		return get_shared_element();
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	void SparseSet<T>::clear()
+	{
+		m_indices.clear();
+		m_positions.clear();
+		m_reference_count = 0;
+	}
+
+	template <typename T>
+		requires std::is_empty_v<T>
+	typename SparseSet<T>::element_type& SparseSet<T>::get_shared_element() noexcept
+	{
+		// Empty, so writes through the reference change nothing and members can share it
+		static element_type element{};
+		return element;
 	}
 }
@@ -0,0 +1,391 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "Sigma/Engine/common/types.hpp"
+#include "Sigma/Engine/Utilities/vector_utils.hpp"
+
+namespace sigma
+{
+	// SparseSet variant whose elements never move while they are alive, for systems that keep pointers to them.
+	// Elements live in fixed-size chunks that are allocated once and never reallocated. Erasing destroys the element
+	// and leaves a tombstone whose storage holds the next entry of a free list, so the slot is reused by a later
+	// emplace. Iteration walks an occupancy bitmap per chunk and skips whole words of holes at a time. compact()
+	// packs the live elements to close the holes, which is the only operation that moves them.
+	template <typename T>
+	class StableSparseSet
+	{
+	public:
+		using element_type = T;
+		using size_type = std::size_t;
+
+		static constexpr size_type k_chunk_size = 256;
+		static constexpr Float k_default_compaction_threshold = 0.25f;
+
+		StableSparseSet() = default;
+		~StableSparseSet();
+
+		StableSparseSet(const StableSparseSet&) = delete;
+		StableSparseSet& operator=(const StableSparseSet&) = delete;
+		// Leaves the source empty, as clear() does
+		StableSparseSet(StableSparseSet&& other) noexcept;
+		StableSparseSet& operator=(StableSparseSet&&) = delete;
+
+		// Replaces the element of an index that already has one, in place
+		template <typename... Args>
+		element_type& emplace(size_type index, Args&&... args);
+		// Safe while iterating, the erased element is skipped if it has not been visited yet
+		void erase(size_type index) noexcept;
+		void clear() noexcept;
+
+		[[nodiscard]] size_type size() const noexcept;
+		[[nodiscard]] bool is_empty() const noexcept;
+		// Slots in use or tombstoned, the range iteration walks
+		[[nodiscard]] size_type get_slot_count() const noexcept;
+		// Share of the slots that are tombstones
+		[[nodiscard]] Float get_fragmentation() const noexcept;
+
+		[[nodiscard]] Float get_compaction_threshold() const noexcept;
+		void set_compaction_threshold(Float threshold) noexcept;
+		[[nodiscard]] bool needs_compaction() const noexcept;
+		// Moves elements from the back into the holes and releases empty chunks. Invalidates pointers to moved
+		// elements, so it belongs at a point in the frame where no system holds any.
+		void compact();
+
+		[[nodiscard]] bool has_element(size_type index) const noexcept;
+		[[nodiscard]] element_type* get_element_pointer(size_type index) noexcept;
+		[[nodiscard]] const element_type* get_element_pointer(size_type index) const noexcept;
+		[[nodiscard]] element_type& operator[](size_type index) noexcept;
+		[[nodiscard]] const element_type& operator[](size_type index) const noexcept;
+
+		// Calls function(index, element) for every element in slot order. Elements emplaced during the iteration
+		// may or may not be visited.
+		template <typename Function>
+		void for_each(Function&& function);
+		template <typename Function>
+		void for_each(Function&& function) const;
+	private:
+		static constexpr size_type k_word_count = k_chunk_size / 64;
+		static constexpr size_type k_no_slot = static_cast<size_type>(-1);
+
+		// A live slot holds an element, a tombstone holds the index of the next free slot
+		union Slot
+		{
+			Slot() noexcept {}
+			~Slot() {}
+
+			element_type element;
+			size_type next_free;
+		};
+
+		struct Chunk
+		{
+			std::array<Slot, k_chunk_size> slots;
+			std::array<size_type, k_chunk_size> indices{};
+			std::array<UInt64, k_word_count> occupied{};
+		};
+
+		[[nodiscard]] Slot& get_slot(size_type slot) noexcept;
+		[[nodiscard]] const Slot& get_slot(size_type slot) const noexcept;
+		[[nodiscard]] Chunk& get_chunk(size_type slot) noexcept;
+		[[nodiscard]] const Chunk& get_chunk(size_type slot) const noexcept;
+		[[nodiscard]] bool is_occupied(size_type slot) const noexcept;
+		void set_occupied(size_type slot, bool occupied) noexcept;
+		[[nodiscard]] size_type allocate_slot();
+
+		template <typename Self, typename Function>
+		static void for_each_occupied(Self& self, Function& function);
+
+		std::vector<std::unique_ptr<Chunk>> m_chunks{};
+		// Slot plus one per sparse index, zero when the index has no element
+		std::vector<size_type> m_sparse{};
+		size_type m_slot_count{};
+		size_type m_size{};
+		size_type m_free_head{ k_no_slot };
+		Float m_compaction_threshold{ k_default_compaction_threshold };
+	};
+
+
+	template <typename T>
+	StableSparseSet<T>::StableSparseSet(StableSparseSet&& other) noexcept
+		: m_chunks{ std::move(other.m_chunks) },
+		m_sparse{ std::move(other.m_sparse) },
+		m_slot_count{ std::exchange(other.m_slot_count, 0) },
+		m_size{ std::exchange(other.m_size, 0) },
+		m_free_head{ std::exchange(other.m_free_head, k_no_slot) },
+		m_compaction_threshold{ other.m_compaction_threshold }
+	{
+		other.m_chunks.clear();
+		other.m_sparse.clear();
+	}
+
+	template <typename T>
+	StableSparseSet<T>::~StableSparseSet()
+	{
+		clear();
+	}
+
+	template <typename T>
+	template <typename... Args>
+	typename StableSparseSet<T>::element_type& StableSparseSet<T>::emplace(const size_type index, Args&&... args)
+	{
+		if (has_element(index))
+		{
+			auto& element = get_slot(m_sparse[index] - 1).element;
+			element = element_type(std::forward<Args>(args)...);
+			return element;
+		}
+
+		const auto slot = allocate_slot();
+		auto& storage = get_slot(slot);
+		std::construct_at(&storage.element, std::forward<Args>(args)...);
+		get_chunk(slot).indices[slot % k_chunk_size] = index;
+		set_occupied(slot, true);
+		safe_assignment(m_sparse, index, slot + 1);
+		++m_size;
+		return storage.element;
+	}
+
+	template <typename T>
+	void StableSparseSet<T>::erase(const size_type index) noexcept
+	{
+		if (!has_element(index))
+		{
+			return;
+		}
+
+		const auto slot = m_sparse[index] - 1;
+		auto& storage = get_slot(slot);
+		std::destroy_at(&storage.element);
+		storage.next_free = m_free_head;
+		m_free_head = slot;
+		set_occupied(slot, false);
+		m_sparse[index] = 0;
+		--m_size;
+	}
+
+	template <typename T>
+	void StableSparseSet<T>::clear() noexcept
+	{
+		for_each([](size_type, element_type& element) { std::destroy_at(&element); });
+		m_chunks.clear();
+		m_sparse.clear();
+		m_slot_count = 0;
+		m_size = 0;
+		m_free_head = k_no_slot;
+	}
+
+	template <typename T>
+	typename StableSparseSet<T>::size_type StableSparseSet<T>::size() const noexcept
+	{
+		return m_size;
+	}
+
+	template <typename T>
+	bool StableSparseSet<T>::is_empty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	template <typename T>
+	typename StableSparseSet<T>::size_type StableSparseSet<T>::get_slot_count() const noexcept
+	{
+		return m_slot_count;
+	}
+
+	template <typename T>
+	Float StableSparseSet<T>::get_fragmentation() const noexcept
+	{
+		return m_slot_count == 0 ? 0.0f : static_cast<Float>(m_slot_count - m_size) / static_cast<Float>(m_slot_count);
+	}
+
+	template <typename T>
+	Float StableSparseSet<T>::get_compaction_threshold() const noexcept
+	{
+		return m_compaction_threshold;
+	}
+
+	template <typename T>
+	void StableSparseSet<T>::set_compaction_threshold(const Float threshold) noexcept
+	{
+		m_compaction_threshold = threshold;
+	}
+
+	template <typename T>
+	bool StableSparseSet<T>::needs_compaction() const noexcept
+	{
+		return get_fragmentation() > m_compaction_threshold;
+	}
+
+	template <typename T>
+	void StableSparseSet<T>::compact()
+	{
+		// Two cursors: the lowest hole is filled from the highest live slot until they meet
+		size_type hole = 0;
+		auto last = m_slot_count;
+		while (true)
+		{
+			while (hole < last && is_occupied(hole))
+			{
+				++hole;
+			}
+			while (last > hole && !is_occupied(last - 1))
+			{
+				--last;
+			}
+			if (hole >= last)
+			{
+				break;
+			}
+
+			const auto source = last - 1;
+			auto& element = get_slot(source).element;
+			const auto index = get_chunk(source).indices[source % k_chunk_size];
+			std::construct_at(&get_slot(hole).element, std::move(element));
+			std::destroy_at(&element);
+			get_chunk(hole).indices[hole % k_chunk_size] = index;
+			set_occupied(hole, true);
+			set_occupied(source, false);
+			m_sparse[index] = hole + 1;
+			--last;
+		}
+
+		m_slot_count = m_size;
+		m_chunks.resize((m_slot_count + k_chunk_size - 1) / k_chunk_size);
+		// Every live element now sits below the slot count, so no free slot is left to reuse
+		m_free_head = k_no_slot;
+	}
+
+	template <typename T>
+	bool StableSparseSet<T>::has_element(const size_type index) const noexcept
+	{
+		return index < m_sparse.size() && m_sparse[index] != 0;
+	}
+
+	template <typename T>
+	typename StableSparseSet<T>::element_type* StableSparseSet<T>::get_element_pointer(const size_type index) noexcept
+	{
+		return has_element(index) ? &get_slot(m_sparse[index] - 1).element : nullptr;
+	}
+
+	template <typename T>
+	const typename StableSparseSet<T>::element_type* StableSparseSet<T>::get_element_pointer(const size_type index) const noexcept
+	{
+		return has_element(index) ? &get_slot(m_sparse[index] - 1).element : nullptr;
+	}
+
+	template <typename T>
+	typename StableSparseSet<T>::element_type& StableSparseSet<T>::operator[](const size_type index) noexcept
+	{
+		assert(has_element(index));
+		return get_slot(m_sparse[index] - 1).element;
+	}
+
+	template <typename T>
+	const typename StableSparseSet<T>::element_type& StableSparseSet<T>::operator[](const size_type index) const noexcept
+	{
+		assert(has_element(index));
+		return get_slot(m_sparse[index] - 1).element;
+	}
+
+	template <typename T>
+	template <typename Function>
+	void StableSparseSet<T>::for_each(Function&& function)
+	{
+		for_each_occupied(*this, function);
+	}
+
+	template <typename T>
+	template <typename Function>
+	void StableSparseSet<T>::for_each(Function&& function) const
+	{
+		for_each_occupied(*this, function);
+	}
+
+	template <typename T>
+	typename StableSparseSet<T>::Slot& StableSparseSet<T>::get_slot(const size_type slot) noexcept
+	{
+		return get_chunk(slot).slots[slot % k_chunk_size];
+	}
+
+	template <typename T>
+	const typename StableSparseSet<T>::Slot& StableSparseSet<T>::get_slot(const size_type slot) const noexcept
+	{
+		return get_chunk(slot).slots[slot % k_chunk_size];
+	}
+
+	template <typename T>
+	typename StableSparseSet<T>::Chunk& StableSparseSet<T>::get_chunk(const size_type slot) noexcept
+	{
+		return *m_chunks[slot / k_chunk_size];
+	}
+
+	template <typename T>
+	const typename StableSparseSet<T>::Chunk& StableSparseSet<T>::get_chunk(const size_type slot) const noexcept
+	{
+		return *m_chunks[slot / k_chunk_size];
+	}
+
+	template <typename T>
+	bool StableSparseSet<T>::is_occupied(const size_type slot) const noexcept
+	{
+		const auto offset = slot % k_chunk_size;
+		return (get_chunk(slot).occupied[offset / 64] >> (offset % 64)) & 1;
+	}
+
+	template <typename T>
+	void StableSparseSet<T>::set_occupied(const size_type slot, const bool occupied) noexcept
+	{
+		const auto offset = slot % k_chunk_size;
+		auto& word = get_chunk(slot).occupied[offset / 64];
+		const auto bit = UInt64{ 1 } << (offset % 64);
+		word = occupied ? word | bit : word & ~bit;
+	}
+
+	template <typename T>
+	typename StableSparseSet<T>::size_type StableSparseSet<T>::allocate_slot()
+	{
+		if (m_free_head != k_no_slot)
+		{
+			const auto slot = m_free_head;
+			m_free_head = get_slot(slot).next_free;
+			return slot;
+		}
+
+		if (m_slot_count == m_chunks.size() * k_chunk_size)
+		{
+			m_chunks.push_back(std::make_unique<Chunk>());
+		}
+		return m_slot_count++;
+	}
+
+	template <typename T>
+	template <typename Self, typename Function>
+	void StableSparseSet<T>::for_each_occupied(Self& self, Function& function)
+	{
+		for (size_type chunk_index = 0; chunk_index < self.m_chunks.size(); ++chunk_index)
+		{
+			auto& chunk = *self.m_chunks[chunk_index];
+			for (size_type word = 0; word < k_word_count; ++word)
+			{
+				auto bits = chunk.occupied[word];
+				while (bits != 0)
+				{
+					const auto offset = word * 64 + static_cast<size_type>(std::countr_zero(bits));
+					bits &= bits - 1;
+					function(chunk.indices[offset], chunk.slots[offset].element);
+					// Elements the function erased are dropped from the bits still to visit
+					bits &= chunk.occupied[word];
+				}
+			}
+		}
+	}
+}
\ No newline at end of file
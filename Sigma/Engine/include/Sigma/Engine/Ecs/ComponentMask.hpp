@@ -0,0 +1,108 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "Sigma/Engine/common/types.hpp"
+
+namespace sigma
+{
+	// Fixed-size bit set usable in constant expressions, one bit per component id
+	template <std::size_t Bits>
+	class ComponentMask
+	{
+	public:
+		static constexpr std::size_t k_bit_count = Bits;
+		static constexpr std::size_t k_word_count = Bits == 0 ? 1 : (Bits + 63) / 64;
+
+		using words_type = std::array<UInt64, k_word_count>;
+
+		constexpr void set(std::size_t bit) noexcept;
+		constexpr void reset(std::size_t bit) noexcept;
+		[[nodiscard]] constexpr bool test(std::size_t bit) const noexcept;
+
+		[[nodiscard]] constexpr bool is_empty() const noexcept;
+		[[nodiscard]] constexpr bool intersects(const ComponentMask& other) const noexcept;
+		[[nodiscard]] constexpr bool contains(const ComponentMask& subset) const noexcept;
+
+		[[nodiscard]] constexpr ComponentMask operator|(const ComponentMask& other) const noexcept;
+		[[nodiscard]] constexpr ComponentMask operator&(const ComponentMask& other) const noexcept;
+		[[nodiscard]] constexpr bool operator==(const ComponentMask& other) const noexcept = default;
+
+		[[nodiscard]] constexpr const words_type& get_words() const noexcept;
+	private:
+		words_type m_words{};
+	};
+
+
+	template <std::size_t Bits>
+	constexpr void ComponentMask<Bits>::set(const std::size_t bit) noexcept
+	{
+		m_words[bit / 64] |= UInt64{ 1 } << (bit % 64);
+	}
+
+	template <std::size_t Bits>
+	constexpr void ComponentMask<Bits>::reset(const std::size_t bit) noexcept
+	{
+		m_words[bit / 64] &= ~(UInt64{ 1 } << (bit % 64));
+	}
+
+	template <std::size_t Bits>
+	constexpr bool ComponentMask<Bits>::test(const std::size_t bit) const noexcept
+	{
+		return (m_words[bit / 64] >> (bit % 64)) & 1;
+	}
+
+	template <std::size_t Bits>
+	constexpr bool ComponentMask<Bits>::is_empty() const noexcept
+	{
+		for (const auto word : m_words)
+		{
+			if (word != 0)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template <std::size_t Bits>
+	constexpr bool ComponentMask<Bits>::intersects(const ComponentMask& other) const noexcept
+	{
+		return !(*this & other).is_empty();
+	}
+
+	template <std::size_t Bits>
+	constexpr bool ComponentMask<Bits>::contains(const ComponentMask& subset) const noexcept
+	{
+		return (*this & subset) == subset;
+	}
+
+	template <std::size_t Bits>
+	constexpr ComponentMask<Bits> ComponentMask<Bits>::operator|(const ComponentMask& other) const noexcept
+	{
+		ComponentMask result{};
+		for (std::size_t word = 0; word < k_word_count; ++word)
+		{
+			result.m_words[word] = m_words[word] | other.m_words[word];
+		}
+		return result;
+	}
+
+	template <std::size_t Bits>
+	constexpr ComponentMask<Bits> ComponentMask<Bits>::operator&(const ComponentMask& other) const noexcept
+	{
+		ComponentMask result{};
+		for (std::size_t word = 0; word < k_word_count; ++word)
+		{
+			result.m_words[word] = m_words[word] & other.m_words[word];
+		}
+		return result;
+	}
+
+	template <std::size_t Bits>
+	constexpr const typename ComponentMask<Bits>::words_type& ComponentMask<Bits>::get_words() const noexcept
+	{
+		return m_words;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <limits>
+#include <type_traits>
+
+#include "Sigma/Engine/Ecs/ComponentMask.hpp"
+#include "Sigma/Engine/utilities/tag.hpp"
+#include "Sigma/Engine/utilities/type_list.hpp"
+#include "Sigma/Engine/utilities/type_name.hpp"
+
+namespace sigma
+{
+	using ComponentId = UInt32;
+	constexpr ComponentId k_invalid_component_id = std::numeric_limits<ComponentId>::max();
+
+	namespace detail
+	{
+		template <std::size_t Count>
+		[[nodiscard]] constexpr bool has_unique_values(const std::array<UInt32, Count>& values) noexcept
+		{
+			for (std::size_t first = 0; first < Count; ++first)
+			{
+				for (auto second = first + 1; second < Count; ++second)
+				{
+					if (values[first] == values[second])
+					{
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+	}
+
+	// Compile-time registry of the component types of a world. Ids are dense positions in the type list, so pool
+	// lookups, access masks and dispatch tables are plain arrays indexed by them. Hashes of the type names identify
+	// components in serialized data, where the position in the list is not stable.
+	template <typename... Components>
+	class ComponentTypes
+	{
+	public:
+		using list_type = TypeList<Components...>;
+		using mask_type = ComponentMask<sizeof...(Components)>;
+
+		static constexpr std::size_t k_count = sizeof...(Components);
+		static constexpr std::array<UInt32, k_count> k_hashes{ type_hash<Components>()... };
+
+		static_assert(type_list_is_unique_v<list_type>, "Component types must be listed once");
+		static_assert((std::is_same_v<Components, std::remove_cvref_t<Components>> && ...), "Component types must be unqualified");
+
+		template <typename Component>
+		static constexpr bool contains = type_list_contains_v<Component, list_type>;
+
+		template <typename Component>
+			requires contains<Component>
+		static constexpr ComponentId id = static_cast<ComponentId>(type_list_index_v<Component, list_type>);
+
+		template <typename Component>
+		using id_tag = Tag<id<Component>>;
+
+		// Component id for a serialized type hash, k_invalid_component_id if no component has it
+		[[nodiscard]] static constexpr ComponentId find(UInt32 hash) noexcept;
+
+		template <typename... Selected>
+		[[nodiscard]] static constexpr mask_type make_mask() noexcept;
+		template <typename... Selected>
+		[[nodiscard]] static constexpr mask_type make_mask(TypeList<Selected...>) noexcept;
+
+		// Calls function(std::type_identity<Component>{}) for the component with a runtime id through a table of
+		// one entry per component, so dispatch costs one indirect call regardless of the number of types. The id must
+		// belong to a component, so ids from find() are checked against k_invalid_component_id first.
+		template <typename Function>
+		static constexpr decltype(auto) visit(ComponentId id, Function&& function);
+
+		static_assert(detail::has_unique_values(k_hashes), "Two component type names hash to the same value");
+	};
+
+	// Components a system reads and writes. Two systems conflict, and cannot run concurrently, when one writes a
+	// component the other reads or writes.
+	template <typename Types>
+	struct ComponentAccess
+	{
+		typename Types::mask_type reads{};
+		typename Types::mask_type writes{};
+
+		[[nodiscard]] constexpr bool conflicts_with(const ComponentAccess& other) const noexcept
+		{
+			return writes.intersects(other.reads | other.writes) || other.writes.intersects(reads);
+		}
+	};
+
+	template <typename Types, typename Reads, typename Writes>
+	[[nodiscard]] constexpr ComponentAccess<Types> make_component_access() noexcept
+	{
+		return { Types::make_mask(Reads{}), Types::make_mask(Writes{}) };
+	}
+
+
+	template <typename... Components>
+	constexpr ComponentId ComponentTypes<Components...>::find(const UInt32 hash) noexcept
+	{
+		for (std::size_t index = 0; index < k_count; ++index)
+		{
+			if (k_hashes[index] == hash)
+			{
+				return static_cast<ComponentId>(index);
+			}
+		}
+		return k_invalid_component_id;
+	}
+
+	template <typename... Components>
+	template <typename... Selected>
+	constexpr typename ComponentTypes<Components...>::mask_type ComponentTypes<Components...>::make_mask() noexcept
+	{
+		mask_type mask{};
+		(mask.set(id<Selected>), ...);
+		return mask;
+	}
+
+	template <typename... Components>
+	template <typename... Selected>
+	constexpr typename ComponentTypes<Components...>::mask_type ComponentTypes<Components...>::make_mask(TypeList<Selected...>) noexcept
+	{
+		return make_mask<Selected...>();
+	}
+
+	template <typename... Components>
+	template <typename Function>
+	constexpr decltype(auto) ComponentTypes<Components...>::visit(const ComponentId id, Function&& function)
+	{
+		using first_type = type_list_element_t<0, list_type>;
+		using result_type = std::invoke_result_t<Function&, std::type_identity<first_type>>;
+		using thunk_type = result_type (*)(Function&);
+
+		constexpr thunk_type table[] = {
+			[](Function& visitor) -> result_type { return visitor(std::type_identity<Components>{}); }...
+		};
+		assert(id < sizeof...(Components));
+		return table[id](function);
+	}
+}
\ No newline at end of file
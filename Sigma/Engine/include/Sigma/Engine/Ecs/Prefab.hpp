@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cassert>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "Sigma/Engine/Ecs/ComponentTypes.hpp"
+
+namespace sigma
+{
+	// Components that refer to other entities list those members, e.g.
+	// static constexpr auto get_entity_references() noexcept { return std::array{ &Follow::target }; }
+	// so instantiating a prefab can point the copies at the entities created along with them.
+	template <typename Component>
+	concept HasEntityReferences = requires { Component::get_entity_references(); };
+
+	// Prefab entities carry the top bit, so references to them can be told apart from references to world entities
+	inline constexpr Entity k_prefab_entity_flag = ~(k_null_entity >> 1);
+
+	[[nodiscard]] constexpr bool is_prefab_entity(const Entity entity) noexcept
+	{
+		return entity != k_null_entity && (entity & k_prefab_entity_flag) != 0;
+	}
+
+	[[nodiscard]] constexpr Entity make_prefab_entity(const std::size_t index) noexcept
+	{
+		return index | k_prefab_entity_flag;
+	}
+
+	[[nodiscard]] constexpr std::size_t get_prefab_index(const Entity entity) noexcept
+	{
+		return entity & ~k_prefab_entity_flag;
+	}
+
+	// Replaces prefab entities in the listed members with the entity created for them, entities[prefab_index].
+	// World entities and k_null_entity are left alone.
+	template <typename Component>
+	void remap_entity_references(Component& component, std::span<const Entity> entities) noexcept;
+
+	// Template for a group of entities, stored column-wise: per component type, the components of all prefab
+	// entities that have one, next to the index of the prefab entity owning each. create() returns prefab entities,
+	// and entity references inside the components use those, while references to world entities are kept as they
+	// are. World::instantiate copies whole columns at once.
+	template <typename... Components>
+	class Prefab
+	{
+	public:
+		using size_type = std::size_t;
+		using component_types = ComponentTypes<Components...>;
+
+		// entities holds prefab indices, not prefab entities
+		template <typename Component>
+		struct Column
+		{
+			std::vector<Component> components{};
+			std::vector<Entity> entities{};
+		};
+
+		[[nodiscard]] Entity create();
+		[[nodiscard]] size_type size() const noexcept;
+
+		// At most one component of each type per prefab entity
+		template <typename Component, typename... Args>
+		Component& emplace(Entity entity, Args&&... args);
+
+		template <typename Component>
+		[[nodiscard]] const Column<Component>& get_column() const noexcept;
+	private:
+		std::tuple<Column<Components>...> m_columns{};
+		size_type m_size{};
+	};
+
+
+	template <typename Component>
+	void remap_entity_references(Component& component, const std::span<const Entity> entities) noexcept
+	{
+		if constexpr (HasEntityReferences<Component>)
+		{
+			for (const auto member : Component::get_entity_references())
+			{
+				auto& entity = component.*member;
+				if (is_prefab_entity(entity))
+				{
+					assert(get_prefab_index(entity) < entities.size());
+					entity = entities[get_prefab_index(entity)];
+				}
+			}
+		}
+	}
+
+	template <typename... Components>
+	Entity Prefab<Components...>::create()
+	{
+		return make_prefab_entity(m_size++);
+	}
+
+	template <typename... Components>
+	typename Prefab<Components...>::size_type Prefab<Components...>::size() const noexcept
+	{
+		return m_size;
+	}
+
+	template <typename... Components>
+	template <typename Component, typename... Args>
+	Component& Prefab<Components...>::emplace(const Entity entity, Args&&... args)
+	{
+		assert(is_prefab_entity(entity) && get_prefab_index(entity) < m_size);
+		auto& column = std::get<component_types::template id<Component>>(m_columns);
+		column.entities.push_back(get_prefab_index(entity));
+		return column.components.emplace_back(std::forward<Args>(args)...);
+	}
+
+	template <typename... Components>
+	template <typename Component>
+	const typename Prefab<Components...>::template Column<Component>& Prefab<Components...>::get_column() const noexcept
+	{
+		return std::get<component_types::template id<Component>>(m_columns);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,282 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "Sigma/Engine/Ecs/World.hpp"
+
+namespace sigma
+{
+	// Query filters. A const component is only read, which the access masks of the query reflect.
+	template <typename... Components>
+	struct Include {};
+
+	template <typename... Components>
+	struct Exclude {};
+
+	template <typename... Components>
+	struct Optional {};
+
+	namespace detail
+	{
+		template <template <typename...> class Filter, typename Argument>
+		struct QueryFilterList
+		{
+			using type = TypeList<>;
+		};
+
+		template <template <typename...> class Filter, typename... Components>
+		struct QueryFilterList<Filter, Filter<Components...>>
+		{
+			using type = TypeList<Components...>;
+		};
+
+		template <typename Argument>
+		inline constexpr bool is_query_filter_v = false;
+
+		template <typename... Components>
+		inline constexpr bool is_query_filter_v<Include<Components...>> = true;
+
+		template <typename... Components>
+		inline constexpr bool is_query_filter_v<Exclude<Components...>> = true;
+
+		template <typename... Components>
+		inline constexpr bool is_query_filter_v<Optional<Components...>> = true;
+
+		template <template <typename...> class Filter, typename... Arguments>
+		using query_filter_list_t = type_list_concat_t<TypeList<>, typename QueryFilterList<Filter, Arguments>::type...>;
+	}
+
+	template <typename Included, typename Excluded, typename Optionals>
+	class BasicQuery;
+
+	// Entities that have every included component and none of the excluded ones, with a pointer to each optional
+	// component that is null when the entity does not have it. Construction only takes the addresses of the pools.
+	// Iteration walks the smallest included pool and probes the others by entity, one loop is generated per
+	// included pool so the choice of the driving pool is the only runtime branch. In worlds with signatures, queries
+	// whose probes would cost more than a pass over the signature array filter it with vector AND/compares instead.
+	// The world only hands out its pools read-only, so both paths see the same entities.
+	template <typename... Included, typename... Excluded, typename... Optionals>
+	class BasicQuery<TypeList<Included...>, TypeList<Excluded...>, TypeList<Optionals...>>
+	{
+	public:
+		using size_type = std::size_t;
+
+		// Probing one pool costs about as much as testing this many signatures
+		static constexpr size_type k_signature_scan_ratio = 16;
+		static constexpr size_type k_signature_block_size = 256;
+
+		static_assert(sizeof...(Included) > 0, "A query needs at least one included component to iterate");
+		static_assert(type_list_is_unique_v<TypeList<std::remove_const_t<Included>..., Excluded..., std::remove_const_t<Optionals>...>>,
+			"A component can appear in only one filter of a query");
+
+		template <typename... Components>
+		explicit BasicQuery(World<Components...>& world) noexcept;
+
+		// Calls function(entity, included&..., optional*...) for every matching entity
+		template <typename Function>
+		void each(Function&& function);
+
+		[[nodiscard]] bool contains(Entity entity) const noexcept;
+		// Number of entities in the smallest included pool, an upper bound on the number of matches
+		[[nodiscard]] size_type size_hint() const noexcept;
+
+		// Included and optional components are written unless they are const, excluded ones are only tested
+		template <typename Types>
+		[[nodiscard]] static constexpr ComponentAccess<Types> get_access() noexcept;
+	private:
+		template <typename Component>
+		using pool_pointer = std::conditional_t<std::is_const_v<Component>, const SparseSet<std::remove_const_t<Component>>*, SparseSet<Component>*>;
+
+		[[nodiscard]] size_type get_driving_pool() const noexcept;
+		[[nodiscard]] bool is_excluded(Entity entity) const noexcept;
+
+		[[nodiscard]] bool should_scan_signatures() const noexcept;
+
+		template <std::size_t Driver, typename Function, std::size_t... Indices>
+		void each_driven_by(Function& function, std::index_sequence<Indices...>);
+		template <typename Function>
+		void each_by_signature(Function& function);
+
+		std::tuple<pool_pointer<Included>...> m_included;
+		std::tuple<const SparseSet<Excluded>*...> m_excluded;
+		std::tuple<pool_pointer<Optionals>...> m_optionals;
+
+		const std::vector<UInt64>* m_signatures{};
+		size_type m_signature_words{};
+		std::array<UInt64, 4> m_include_words{};
+		std::array<UInt64, 4> m_exclude_words{};
+	};
+
+	// Query<Include<A, B>, Exclude<C>, Optional<D>>, filters may be given in any order and repeated
+	template <typename... Filters>
+		requires (detail::is_query_filter_v<Filters> && ...)
+	using Query = BasicQuery<
+		detail::query_filter_list_t<Include, Filters...>,
+		detail::query_filter_list_t<Exclude, Filters...>,
+		detail::query_filter_list_t<Optional, Filters...>>;
+
+
+	template <typename... Included, typename... Excluded, typename... Optionals>
+	template <typename... Components>
+	BasicQuery<TypeList<Included...>, TypeList<Excluded...>, TypeList<Optionals...>>::BasicQuery(World<Components...>& world) noexcept
+		: m_included{ &world.template get_mutable_pool<std::remove_const_t<Included>>()... },
+		m_excluded{ &world.template get_pool<Excluded>()... },
+		m_optionals{ &world.template get_mutable_pool<std::remove_const_t<Optionals>>()... }
+	{
+		using world_type = World<Components...>;
+		if (!world.has_signatures())
+		{
+			return;
+		}
+
+		m_signatures = &world.get_signatures();
+		m_signature_words = world_type::k_signature_words;
+		const auto include = world_type::component_types::template make_mask<std::remove_const_t<Included>...>();
+		const auto exclude = world_type::component_types::template make_mask<Excluded...>();
+		std::copy(include.get_words().begin(), include.get_words().end(), m_include_words.begin());
+		std::copy(exclude.get_words().begin(), exclude.get_words().end(), m_exclude_words.begin());
+	}
+
+	template <typename... Included, typename... Excluded, typename... Optionals>
+	template <typename Function>
+	void BasicQuery<TypeList<Included...>, TypeList<Excluded...>, TypeList<Optionals...>>::each(Function&& function)
+	{
+		if (should_scan_signatures())
+		{
+			each_by_signature(function);
+			return;
+		}
+
+		const auto driver = get_driving_pool();
+		[&]<std::size_t... Drivers>(std::index_sequence<Drivers...>)
+		{
+			((driver == Drivers ? (each_driven_by<Drivers>(function, std::index_sequence_for<Included...>{}), true) : false) || ...);
+		}(std::index_sequence_for<Included...>{});
+	}
+
+	template <typename... Included, typename... Excluded, typename... Optionals>
+	bool BasicQuery<TypeList<Included...>, TypeList<Excluded...>, TypeList<Optionals...>>::contains(const Entity entity) const noexcept
+	{
+		return std::apply([&](const auto*... pools) { return (pools->has_element(entity) && ...); }, m_included) && !is_excluded(entity);
+	}
+
+	template <typename... Included, typename... Excluded, typename... Optionals>
+	typename BasicQuery<TypeList<Included...>, TypeList<Excluded...>, TypeList<Optionals...>>::size_type
+		BasicQuery<TypeList<Included...>, TypeList<Excluded...>, TypeList<Optionals...>>::size_hint() const noexcept
+	{
+		return std::apply([](const auto*... pools) { return std::min({ pools->size()... }); }, m_included);
+	}
+
+	template <typename... Included, typename... Excluded, typename... Optionals>
+	template <typename Types>
+	constexpr ComponentAccess<Types> BasicQuery<TypeList<Included...>, TypeList<Excluded...>, TypeList<Optionals...>>::get_access() noexcept
+	{
+		ComponentAccess<Types> access{};
+		((std::is_const_v<Included> ? access.reads : access.writes).set(Types::template id<std::remove_const_t<Included>>), ...);
+		((std::is_const_v<Optionals> ? access.reads : access.writes).set(Types::template id<std::remove_const_t<Optionals>>), ...);
+		(access.reads.set(Types::template id<Excluded>), ...);
+		return access;
+	}
+
+	template <typename... Included, typename... Excluded, typename... Optionals>
+	typename BasicQuery<TypeList<Included...>, TypeList<Excluded...>, TypeList<Optionals...>>::size_type
+		BasicQuery<TypeList<Included...>, TypeList<Excluded...>, TypeList<Optionals...>>::get_driving_pool() const noexcept
+	{
+		return std::apply([](const auto*... pools)
+		{
+			const size_type sizes[] = { pools->size()... };
+			return static_cast<size_type>(std::min_element(std::begin(sizes), std::end(sizes)) - std::begin(sizes));
+		}, m_included);
+	}
+
+	template <typename... Included, typename... Excluded, typename... Optionals>
+	bool BasicQuery<TypeList<Included...>, TypeList<Excluded...>, TypeList<Optionals...>>::should_scan_signatures() const noexcept
+	{
+		constexpr auto k_probe_count = sizeof...(Included) - 1 + sizeof...(Excluded);
+		if (m_signatures == nullptr || k_probe_count == 0)
+		{
+			return false;
+		}
+		return size_hint() * k_probe_count * k_signature_scan_ratio >= m_signatures->size() / m_signature_words;
+	}
+
+	template <typename... Included, typename... Excluded, typename... Optionals>
+	bool BasicQuery<TypeList<Included...>, TypeList<Excluded...>, TypeList<Optionals...>>::is_excluded([[maybe_unused]] const Entity entity) const noexcept
+	{
+		return (std::get<const SparseSet<Excluded>*>(m_excluded)->has_element(entity) || ...);
+	}
+
+	template <typename... Included, typename... Excluded, typename... Optionals>
+	template <std::size_t Driver, typename Function, std::size_t... Indices>
+	void BasicQuery<TypeList<Included...>, TypeList<Excluded...>, TypeList<Optionals...>>::each_driven_by(Function& function, std::index_sequence<Indices...>)
+	{
+		auto* const pool = std::get<Driver>(m_included);
+		const auto& entities = pool->get_indices();
+		constexpr auto k_is_tag = std::is_empty_v<std::remove_const_t<type_list_element_t<Driver, TypeList<Included...>>>>;
+		// Tag pools store no elements, every member refers to the one shared instance
+		auto* const components = [&]()
+		{
+			if constexpr (k_is_tag)
+			{
+				return &(*pool)[0];
+			}
+			else
+			{
+				return pool->data();
+			}
+		}();
+
+		for (size_type position = 0; position < entities.size(); ++position)
+		{
+			const auto entity = entities[position];
+			if (is_excluded(entity))
+			{
+				continue;
+			}
+
+			// The driving pool is read by position, the others are probed by entity
+			const std::tuple pointers{ [&]()
+			{
+				if constexpr (Indices == Driver)
+				{
+					return k_is_tag ? components : components + position;
+				}
+				else
+				{
+					return std::get<Indices>(m_included)->get_element_pointer(entity);
+				}
+			}()... };
+			if (((std::get<Indices>(pointers) == nullptr) || ...))
+			{
+				continue;
+			}
+
+			function(entity, *std::get<Indices>(pointers)..., std::get<pool_pointer<Optionals>>(m_optionals)->get_element_pointer(entity)...);
+		}
+	}
+
+	template <typename... Included, typename... Excluded, typename... Optionals>
+	template <typename Function>
+	void BasicQuery<TypeList<Included...>, TypeList<Excluded...>, TypeList<Optionals...>>::each_by_signature(Function& function)
+	{
+		const auto entity_count = m_signatures->size() / m_signature_words;
+		std::array<Entity, k_signature_block_size> matches;
+		for (Entity begin = 0; begin < entity_count; begin += k_signature_block_size)
+		{
+			const auto end = std::min(begin + k_signature_block_size, entity_count);
+			const auto count = filter_signatures(m_signatures->data(), m_signature_words, m_include_words.data(), m_exclude_words.data(), begin, end, matches.data());
+			for (size_type match = 0; match < count; ++match)
+			{
+				const auto entity = matches[match];
+				assert(contains(entity));
+				function(entity, (*std::get<pool_pointer<Included>>(m_included))[entity]..., std::get<pool_pointer<Optionals>>(m_optionals)->get_element_pointer(entity)...);
+			}
+		}
+	}
+}
\ No newline at end of file
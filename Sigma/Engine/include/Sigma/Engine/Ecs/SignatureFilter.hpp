@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+
+#include "Sigma/Engine/common/types.hpp"
+
+namespace sigma
+{
+	// Signatures are stored entity after entity, word_count words each. Widths of 1, 2 and 4 words pack evenly into
+	// 256-bit registers, so the vector path tests 4, 2 or 1 entities per AND/compare.
+	[[nodiscard]] constexpr std::size_t get_signature_word_count(const std::size_t component_count) noexcept
+	{
+		return component_count <= 64 ? 1 : (component_count <= 128 ? 2 : 4);
+	}
+
+	// Writes the entities in [begin, end) whose signature has every bit of include and no bit of exclude to output,
+	// which needs room for end - begin entries. Returns the number written, in ascending order.
+	[[nodiscard]] std::size_t filter_signatures(const UInt64* signatures, std::size_t word_count, const UInt64* include, const UInt64* exclude,
+		Entity begin, Entity end, Entity* output) noexcept;
+}
\ No newline at end of file
@@ -0,0 +1,379 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <span>
+#include <tuple>
+#include <vector>
+
+#include "Sigma/Engine/DataStructures/SparseSet.hpp"
+#include "Sigma/Engine/Ecs/ComponentTypes.hpp"
+#include "Sigma/Engine/Ecs/Prefab.hpp"
+#include "Sigma/Engine/Ecs/SignatureFilter.hpp"
+#include "Sigma/Engine/Jobs/JobSystem.hpp"
+
+namespace sigma
+{
+	template <typename Included, typename Excluded, typename Optionals>
+	class BasicQuery;
+
+	// Entities plus one SparseSet pool per component type. The set of component types is fixed at compile time, so
+	// a pool is found by its position in the type list and operations over all pools unroll into straight-line code.
+	// Worlds created with signatures also keep one bit per component for every entity, in a dense array indexed by
+	// entity, so broad filters scan that array instead of probing every pool. Signatures are 64, 128 or 256 bits
+	// wide depending on the number of component types.
+	template <typename... Components>
+	class World
+	{
+	public:
+		using size_type = std::size_t;
+		using component_types = ComponentTypes<Components...>;
+
+		template <typename Component>
+		using pool_type = SparseSet<Component>;
+
+		static constexpr size_type k_signature_words = get_signature_word_count(component_types::k_count);
+
+		// Pools are fixed-capacity, every pool can hold a component for up to capacity entities, and at most capacity
+		// entities are alive at once
+		explicit World(size_type capacity, bool use_signatures = false);
+
+		[[nodiscard]] Entity create();
+		void destroy(Entity entity);
+
+		// Creates count copies of the prefab and replaces entities with them, copy c of the prefab entity with index e at
+		// entities[c * prefab.size() + e]. Every pool grows once per call; trivially copyable columns are copied
+		// with memcpy, the others copy-assigned, both in parallel over blocks of copies, and entity references are
+		// remapped to the copy they belong to.
+		void instantiate(const Prefab<Components...>& prefab, size_type count, std::vector<Entity>& entities, JobSystem& job_system);
+
+		[[nodiscard]] bool is_alive(Entity entity) const noexcept;
+		[[nodiscard]] size_type size() const noexcept;
+		[[nodiscard]] size_type capacity() const noexcept;
+
+		[[nodiscard]] bool has_signatures() const noexcept;
+		[[nodiscard]] std::span<const UInt64> get_signature(Entity entity) const noexcept;
+		// k_signature_words words per created entity, empty when the world was created without signatures
+		[[nodiscard]] const std::vector<UInt64>& get_signatures() const noexcept;
+
+		template <typename Component, typename... Args>
+		Component& emplace(Entity entity, Args&&... args);
+		template <typename Component>
+		void erase(Entity entity);
+
+		template <typename Component>
+		[[nodiscard]] bool has(Entity entity) const noexcept;
+		template <typename Component>
+		[[nodiscard]] Component& get(Entity entity) noexcept;
+		template <typename Component>
+		[[nodiscard]] const Component& get(Entity entity) const noexcept;
+
+		// Null when the entity does not have the component
+		template <typename Component>
+		[[nodiscard]] Component* try_get(Entity entity) noexcept;
+		template <typename Component>
+		[[nodiscard]] const Component* try_get(Entity entity) const noexcept;
+
+		// Pools are only handed out read-only, so every component is added and removed through the world and the
+		// signatures always match the pools. Components are written through get, try_get or a query.
+		template <typename Component>
+		[[nodiscard]] const pool_type<Component>& get_pool() const noexcept;
+
+		// Calls function(component_id, component) for every component of the entity, in id order
+		template <typename Function>
+		void for_each_component(Entity entity, Function&& function);
+
+		// Calls function(pool) for the pool with a runtime component id, e.g. when writing serialized data
+		template <typename Function>
+		decltype(auto) visit_pool(ComponentId id, Function&& function) const;
+	private:
+		template <typename Included, typename Excluded, typename Optionals>
+		friend class BasicQuery;
+
+		template <typename Component>
+		[[nodiscard]] pool_type<Component>& get_mutable_pool() noexcept;
+
+		static constexpr size_type k_instantiate_grain = 4096;
+
+		template <typename Component>
+		void instantiate_column(const Prefab<Components...>& prefab, size_type count, std::span<const Entity> entities, JobSystem& job_system);
+
+		std::tuple<pool_type<Components>...> m_pools;
+		std::vector<UInt8> m_alive{};
+		std::vector<Entity> m_free_entities{};
+		std::vector<UInt64> m_signatures{};
+		size_type m_capacity{};
+		size_type m_size{};
+		bool m_use_signatures{};
+	};
+
+
+	template <typename... Components>
+	World<Components...>::World(const size_type capacity, const bool use_signatures)
+		: m_pools{ pool_type<Components>{ capacity }... }, m_capacity{ capacity }, m_use_signatures{ use_signatures }
+	{
+		assert(!use_signatures || component_types::k_count <= 256);
+	}
+
+	template <typename... Components>
+	Entity World<Components...>::create()
+	{
+		// Every live entity may hold one of each component, so the pools only have room for capacity of them
+		assert(m_size < m_capacity);
+		++m_size;
+		if (!m_free_entities.empty())
+		{
+			const auto entity = m_free_entities.back();
+			m_free_entities.pop_back();
+			m_alive[entity] = 1;
+			return entity;
+		}
+
+		m_alive.push_back(1);
+		if (m_use_signatures)
+		{
+			m_signatures.resize(m_signatures.size() + k_signature_words);
+		}
+		return m_alive.size() - 1;
+	}
+
+	template <typename... Components>
+	void World<Components...>::destroy(const Entity entity)
+	{
+		if (!is_alive(entity))
+		{
+			return;
+		}
+
+		(get_mutable_pool<Components>().erase(entity), ...);
+		if (m_use_signatures)
+		{
+			std::fill_n(m_signatures.begin() + static_cast<std::ptrdiff_t>(entity * k_signature_words), k_signature_words, UInt64{ 0 });
+		}
+		m_alive[entity] = 0;
+		m_free_entities.push_back(entity);
+		--m_size;
+	}
+
+	template <typename... Components>
+	void World<Components...>::instantiate(const Prefab<Components...>& prefab, const size_type count, std::vector<Entity>& entities, JobSystem& job_system)
+	{
+		entities.resize(prefab.size() * count);
+		m_alive.reserve(m_alive.size() + entities.size());
+		if (m_use_signatures)
+		{
+			m_signatures.reserve(m_signatures.size() + entities.size() * k_signature_words);
+		}
+		for (auto& entity : entities)
+		{
+			entity = create();
+		}
+		(instantiate_column<Components>(prefab, count, entities, job_system), ...);
+	}
+
+	template <typename... Components>
+	bool World<Components...>::is_alive(const Entity entity) const noexcept
+	{
+		return entity < m_alive.size() && m_alive[entity] != 0;
+	}
+
+	template <typename... Components>
+	typename World<Components...>::size_type World<Components...>::size() const noexcept
+	{
+		return m_size;
+	}
+
+	template <typename... Components>
+	typename World<Components...>::size_type World<Components...>::capacity() const noexcept
+	{
+		return m_capacity;
+	}
+
+	template <typename... Components>
+	bool World<Components...>::has_signatures() const noexcept
+	{
+		return m_use_signatures;
+	}
+
+	template <typename... Components>
+	std::span<const UInt64> World<Components...>::get_signature(const Entity entity) const noexcept
+	{
+		assert(m_use_signatures && is_alive(entity));
+		return { m_signatures.data() + entity * k_signature_words, k_signature_words };
+	}
+
+	template <typename... Components>
+	const std::vector<UInt64>& World<Components...>::get_signatures() const noexcept
+	{
+		return m_signatures;
+	}
+
+	template <typename... Components>
+	template <typename Component, typename... Args>
+	Component& World<Components...>::emplace(const Entity entity, Args&&... args)
+	{
+		assert(is_alive(entity));
+		auto& pool = get_mutable_pool<Component>();
+		pool.emplace(entity, std::forward<Args>(args)...);
+		if (m_use_signatures)
+		{
+			constexpr auto id = component_types::template id<Component>;
+			m_signatures[entity * k_signature_words + id / 64] |= UInt64{ 1 } << (id % 64);
+		}
+		return pool[entity];
+	}
+
+	template <typename... Components>
+	template <typename Component>
+	void World<Components...>::erase(const Entity entity)
+	{
+		get_mutable_pool<Component>().erase(entity);
+		if (m_use_signatures && is_alive(entity))
+		{
+			constexpr auto id = component_types::template id<Component>;
+			m_signatures[entity * k_signature_words + id / 64] &= ~(UInt64{ 1 } << (id % 64));
+		}
+	}
+
+	template <typename... Components>
+	template <typename Component>
+	bool World<Components...>::has(const Entity entity) const noexcept
+	{
+		return get_pool<Component>().has_element(entity);
+	}
+
+	template <typename... Components>
+	template <typename Component>
+	Component& World<Components...>::get(const Entity entity) noexcept
+	{
+		return get_mutable_pool<Component>()[entity];
+	}
+
+	template <typename... Components>
+	template <typename Component>
+	const Component& World<Components...>::get(const Entity entity) const noexcept
+	{
+		return get_pool<Component>()[entity];
+	}
+
+	template <typename... Components>
+	template <typename Component>
+	Component* World<Components...>::try_get(const Entity entity) noexcept
+	{
+		return get_mutable_pool<Component>().get_element_pointer(entity);
+	}
+
+	template <typename... Components>
+	template <typename Component>
+	const Component* World<Components...>::try_get(const Entity entity) const noexcept
+	{
+		return get_pool<Component>().get_element_pointer(entity);
+	}
+
+	template <typename... Components>
+	template <typename Component>
+	const typename World<Components...>::template pool_type<Component>& World<Components...>::get_pool() const noexcept
+	{
+		return std::get<component_types::template id<Component>>(m_pools);
+	}
+
+	template <typename... Components>
+	template <typename Component>
+	typename World<Components...>::template pool_type<Component>& World<Components...>::get_mutable_pool() noexcept
+	{
+		return std::get<component_types::template id<Component>>(m_pools);
+	}
+
+	template <typename... Components>
+	template <typename Function>
+	void World<Components...>::for_each_component(const Entity entity, Function&& function)
+	{
+		for_each_type(typename component_types::list_type{}, [&]<typename Component>(std::type_identity<Component>)
+		{
+			auto& pool = get_mutable_pool<Component>();
+			if (pool.has_element(entity))
+			{
+				function(component_types::template id<Component>, pool[entity]);
+			}
+		});
+	}
+
+	template <typename... Components>
+	template <typename Function>
+	decltype(auto) World<Components...>::visit_pool(const ComponentId id, Function&& function) const
+	{
+		return component_types::visit(id, [&]<typename Component>(std::type_identity<Component>) -> decltype(auto)
+		{
+			return function(get_pool<Component>());
+		});
+	}
+
+	template <typename... Components>
+	template <typename Component>
+	void World<Components...>::instantiate_column(const Prefab<Components...>& prefab, const size_type count, const std::span<const Entity> entities, JobSystem& job_system)
+	{
+		const auto& column = prefab.template get_column<Component>();
+		const auto column_size = column.components.size();
+		if (column_size == 0 || count == 0)
+		{
+			return;
+		}
+
+		auto& pool = get_mutable_pool<Component>();
+		constexpr auto id = component_types::template id<Component>;
+		const auto set_signatures = [&](const size_type copy)
+		{
+			if (m_use_signatures)
+			{
+				for (const auto prefab_entity : column.entities)
+				{
+					const auto entity = entities[copy * prefab.size() + prefab_entity];
+					m_signatures[entity * k_signature_words + id / 64] |= UInt64{ 1 } << (id % 64);
+				}
+			}
+		};
+
+		if constexpr (std::is_empty_v<Component>)
+		{
+			// Tag pools only hold indices, there is nothing to copy
+			for (size_type copy = 0; copy < count; ++copy)
+			{
+				for (const auto prefab_entity : column.entities)
+				{
+					pool.emplace(entities[copy * prefab.size() + prefab_entity]);
+				}
+				set_signatures(copy);
+			}
+		}
+		else
+		{
+			const auto dense_begin = pool.extend(column_size * count, *std::max_element(entities.begin(), entities.end()));
+			job_system.parallel_for(0, count, std::max<size_type>(k_instantiate_grain / column_size, 1), [&](const size_type copy_begin, const size_type copy_end)
+			{
+				std::vector<size_type> indices(column_size);
+				for (auto copy = copy_begin; copy < copy_end; ++copy)
+				{
+					auto* const destination = pool.data() + dense_begin + copy * column_size;
+					if constexpr (std::is_trivially_copyable_v<Component>)
+					{
+						std::memcpy(destination, column.components.data(), column_size * sizeof(Component));
+					}
+					else
+					{
+						std::copy(column.components.begin(), column.components.end(), destination);
+					}
+
+					const auto copy_entities = entities.subspan(copy * prefab.size(), prefab.size());
+					for (size_type element = 0; element < column_size; ++element)
+					{
+						remap_entity_references(destination[element], copy_entities);
+						indices[element] = copy_entities[column.entities[element]];
+					}
+					pool.link(dense_begin + copy * column_size, indices);
+					set_signatures(copy);
+				}
+			});
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,220 @@
+#pragma once
+
+#include <functional>
+#include <tuple>
+#include <vector>
+
+#include "Sigma/Engine/Events/EventQueue.hpp"
+#include "Sigma/Engine/utilities/type_list.hpp"
+
+namespace sigma
+{
+	using EventId = UInt32;
+
+	// Publish and subscribe for a fixed set of event types, with one batched queue per type. Event ids are positions
+	// in the type list, so publishing and dispatching resolve their queue at compile time. Subscribers receive whole
+	// pages of events through one plain function pointer per page, never one call per event. Publishing is lock-free
+	// from any thread; dispatching belongs to one thread, which drains the types it chooses at the phases of the frame
+	// it chooses. Events published by a subscriber while its type is dispatched wait for the next dispatch.
+	// Subscribers may subscribe and unsubscribe from inside a handler. Subscriptions made during a dispatch of their
+	// type take effect at the next dispatch; an unsubscribed handler is not called again, not even for the remaining
+	// pages of the current dispatch.
+	template <typename... Events>
+	class EventBus
+	{
+	public:
+		using list_type = TypeList<Events...>;
+		using size_type = std::size_t;
+
+		static constexpr size_type k_count = sizeof...(Events);
+
+		static_assert(type_list_is_unique_v<list_type>, "Event types must be listed once");
+
+		template <typename Event>
+		static constexpr bool contains = type_list_contains_v<Event, list_type>;
+
+		template <typename Event>
+			requires contains<Event>
+		static constexpr EventId id = static_cast<EventId>(type_list_index_v<Event, list_type>);
+
+		// Every type holds up to capacity events between two dispatches
+		explicit EventBus(size_type capacity);
+
+		template <typename Event>
+		bool publish(const Event& event) noexcept;
+
+		// Handler is called as std::invoke(Handler, context, std::span<const Event>), a member function pointer of
+		// Context works as well as a free function. The context has to outlive the bus or the subscription.
+		template <typename Event, auto Handler, typename Context>
+		void subscribe(Context& context);
+		template <typename Event, auto Handler, typename Context>
+		void unsubscribe(Context& context);
+
+		// Delivers the pending events of the selected types, or of every type, and returns how many there were
+		template <typename... Selected>
+		size_type dispatch();
+
+		template <typename Event>
+		[[nodiscard]] UInt64 get_dropped_count() const noexcept;
+	private:
+		template <typename Event>
+		struct Subscriber
+		{
+			using function_type = void (*)(void* context, std::span<const Event> events);
+
+			void* context{};
+			function_type function{};
+		};
+
+		template <typename Event>
+		struct Channel
+		{
+			explicit Channel(const size_type capacity)
+				: queue{ capacity }
+			{
+			}
+
+			EventQueue<Event> queue;
+			// Unsubscribing during a dispatch only clears the function, the slot is removed once the dispatch ends
+			std::vector<Subscriber<Event>> subscribers{};
+			// Subscriptions made during a dispatch, appended once it ends
+			std::vector<Subscriber<Event>> added{};
+			bool is_dispatching{};
+		};
+
+		template <typename Event, auto Handler, typename Context>
+		static void invoke_handler(void* context, std::span<const Event> events);
+
+		template <typename Event>
+		[[nodiscard]] Channel<Event>& get_channel() noexcept;
+		template <typename Event>
+		[[nodiscard]] const Channel<Event>& get_channel() const noexcept;
+		template <typename Event>
+		size_type dispatch_channel();
+
+		std::tuple<Channel<Events>...> m_channels;
+	};
+
+
+	template <typename... Events>
+	EventBus<Events...>::EventBus(const size_type capacity)
+		: m_channels{ ((void)sizeof(Events), capacity)... }
+	{
+	}
+
+	template <typename... Events>
+	template <typename Event>
+	bool EventBus<Events...>::publish(const Event& event) noexcept
+	{
+		static_assert(contains<Event>, "Not an event type of this bus");
+		return get_channel<Event>().queue.push(event);
+	}
+
+	template <typename... Events>
+	template <typename Event, auto Handler, typename Context>
+	void EventBus<Events...>::subscribe(Context& context)
+	{
+		static_assert(contains<Event>, "Not an event type of this bus");
+		static_assert(std::is_invocable_v<decltype(Handler), Context&, std::span<const Event>>, "Handler must take the context and a span of events");
+
+		auto& channel = get_channel<Event>();
+		(channel.is_dispatching ? channel.added : channel.subscribers).push_back({ &context, &invoke_handler<Event, Handler, Context> });
+	}
+
+	template <typename... Events>
+	template <typename Event, auto Handler, typename Context>
+	void EventBus<Events...>::unsubscribe(Context& context)
+	{
+		const auto matches = [&](const Subscriber<Event>& subscriber)
+		{
+			return subscriber.context == &context && subscriber.function == &invoke_handler<Event, Handler, Context>;
+		};
+
+		auto& channel = get_channel<Event>();
+		std::erase_if(channel.added, matches);
+		if (!channel.is_dispatching)
+		{
+			std::erase_if(channel.subscribers, matches);
+			return;
+		}
+
+		for (auto& subscriber : channel.subscribers)
+		{
+			if (matches(subscriber))
+			{
+				subscriber.function = nullptr;
+			}
+		}
+	}
+
+	template <typename... Events>
+	template <typename... Selected>
+	typename EventBus<Events...>::size_type EventBus<Events...>::dispatch()
+	{
+		static_assert((contains<Selected> && ...), "Not an event type of this bus");
+
+		size_type count = 0;
+		if constexpr (sizeof...(Selected) == 0)
+		{
+			((count += dispatch_channel<Events>()), ...);
+		}
+		else
+		{
+			((count += dispatch_channel<Selected>()), ...);
+		}
+		return count;
+	}
+
+	template <typename... Events>
+	template <typename Event>
+	UInt64 EventBus<Events...>::get_dropped_count() const noexcept
+	{
+		return get_channel<Event>().queue.get_dropped_count();
+	}
+
+	template <typename... Events>
+	template <typename Event, auto Handler, typename Context>
+	void EventBus<Events...>::invoke_handler(void* context, const std::span<const Event> events)
+	{
+		std::invoke(Handler, *static_cast<Context*>(context), events);
+	}
+
+	template <typename... Events>
+	template <typename Event>
+	typename EventBus<Events...>::template Channel<Event>& EventBus<Events...>::get_channel() noexcept
+	{
+		return std::get<id<Event>>(m_channels);
+	}
+
+	template <typename... Events>
+	template <typename Event>
+	const typename EventBus<Events...>::template Channel<Event>& EventBus<Events...>::get_channel() const noexcept
+	{
+		return std::get<id<Event>>(m_channels);
+	}
+
+	template <typename... Events>
+	template <typename Event>
+	typename EventBus<Events...>::size_type EventBus<Events...>::dispatch_channel()
+	{
+		auto& channel = get_channel<Event>();
+		channel.is_dispatching = true;
+		const auto count = channel.queue.drain([&](const std::span<const Event> events)
+		{
+			// Handlers cannot grow the list while it is dispatched, but an unsubscribe may clear a later entry
+			for (const auto& subscriber : channel.subscribers)
+			{
+				if (subscriber.function != nullptr)
+				{
+					subscriber.function(subscriber.context, events);
+				}
+			}
+		});
+		channel.is_dispatching = false;
+
+		std::erase_if(channel.subscribers, [](const Subscriber<Event>& subscriber) { return subscriber.function == nullptr; });
+		channel.subscribers.insert(channel.subscribers.end(), channel.added.begin(), channel.added.end());
+		channel.added.clear();
+		return count;
+	}
+}
\ No newline at end of file
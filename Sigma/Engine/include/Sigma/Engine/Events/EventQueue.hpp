@@ -0,0 +1,217 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
+#include <thread>
+#include <type_traits>
+
+#include "Sigma/Engine/common/types.hpp"
+
+namespace sigma
+{
+	// Queue for many producers and one consumer that is emptied in batches. Producers claim a slot with a
+	// compare-and-swap on one counter and copy the event into arena pages that are allocated on first use and kept for
+	// later batches. The claim counter carries a batch number in its upper half: draining swaps it for the next batch,
+	// so events pushed while a batch is consumed land in the other arena and wait for the next drain. A full batch
+	// stops counting claims, so dropped pushes never carry into the batch number. When a page cannot be allocated it is
+	// marked lost for the batch, and every push that lands on it is dropped and counted instead.
+	template <typename T>
+	class EventQueue
+	{
+	public:
+		using element_type = T;
+		using size_type = std::size_t;
+
+		static_assert(std::is_trivially_copyable_v<T>, "Events are copied into the arena and never destroyed");
+
+		static constexpr size_type k_page_size = std::max<size_type>(64 * 1024 / sizeof(T), 1);
+
+		// At most capacity events fit into one batch, further pushes are dropped and counted
+		explicit EventQueue(size_type capacity);
+		~EventQueue();
+
+		EventQueue(const EventQueue&) = delete;
+		EventQueue& operator=(const EventQueue&) = delete;
+		EventQueue(EventQueue&&) = delete;
+		EventQueue& operator=(EventQueue&&) = delete;
+
+		bool push(const element_type& element) noexcept;
+
+		// Only one thread may drain. Calls function(std::span<const T>) once per arena page of the batch, in claim
+		// order, and returns the number of events delivered. Lost pages are skipped.
+		template <typename Function>
+		size_type drain(Function&& function);
+
+		[[nodiscard]] size_type capacity() const noexcept;
+		[[nodiscard]] UInt64 get_dropped_count() const noexcept;
+	private:
+		struct Page
+		{
+			alignas(T) std::byte storage[sizeof(T) * k_page_size];
+		};
+
+		struct Arena
+		{
+			std::unique_ptr<std::atomic<Page*>[]> pages{};
+			alignas(64) std::atomic<size_type> committed_count{};
+		};
+
+		static constexpr UInt64 k_index_mask = 0xFFFFFFFFull;
+
+		// Null when the page could not be allocated
+		[[nodiscard]] Page* get_page(Arena& arena, size_type page_index) noexcept;
+		[[nodiscard]] static Page* get_lost_page() noexcept;
+
+		size_type m_capacity{};
+		size_type m_page_count{};
+		Arena m_arenas[2]{};
+		UInt64 m_batch{};
+		alignas(64) std::atomic<UInt64> m_claim{};
+		alignas(64) std::atomic<UInt64> m_dropped_count{};
+	};
+
+
+	template <typename T>
+	EventQueue<T>::EventQueue(const size_type capacity)
+		: m_capacity{ std::min<size_type>(capacity, k_index_mask) }
+		, m_page_count{ (m_capacity + k_page_size - 1) / k_page_size }
+	{
+		for (auto& arena : m_arenas)
+		{
+			arena.pages = std::make_unique<std::atomic<Page*>[]>(m_page_count);
+		}
+	}
+
+	template <typename T>
+	EventQueue<T>::~EventQueue()
+	{
+		for (auto& arena : m_arenas)
+		{
+			for (size_type page = 0; page < m_page_count; ++page)
+			{
+				if (auto* const allocated = arena.pages[page].load(std::memory_order_relaxed); allocated != get_lost_page())
+				{
+					delete allocated;
+				}
+			}
+		}
+	}
+
+	template <typename T>
+	bool EventQueue<T>::push(const element_type& element) noexcept
+	{
+		// Acquire pairs with the release of the swap in drain: the consumer is done reading this arena and has reset
+		// its committed count before a producer of the batch after next writes into it
+		auto claim = m_claim.load(std::memory_order_relaxed);
+		do
+		{
+			if ((claim & k_index_mask) >= m_capacity)
+			{
+				m_dropped_count.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+		} while (!m_claim.compare_exchange_weak(claim, claim + 1, std::memory_order_acquire, std::memory_order_relaxed));
+
+		const auto index = claim & k_index_mask;
+		auto& arena = m_arenas[(claim >> 32) & 1];
+
+		// The claim is committed either way so that drain does not wait for it
+		auto* const page = get_page(arena, index / k_page_size);
+		if (page != nullptr)
+		{
+			std::construct_at(reinterpret_cast<T*>(page->storage) + index % k_page_size, element);
+		}
+		else
+		{
+			m_dropped_count.fetch_add(1, std::memory_order_relaxed);
+		}
+		arena.committed_count.fetch_add(1, std::memory_order_release);
+		return page != nullptr;
+	}
+
+	template <typename T>
+	template <typename Function>
+	typename EventQueue<T>::size_type EventQueue<T>::drain(Function&& function)
+	{
+		const auto claim = m_claim.exchange((m_batch + 1) << 32, std::memory_order_acq_rel);
+		auto& arena = m_arenas[m_batch & 1];
+		++m_batch;
+
+		// Producers that claimed a slot before the swap may still be copying, they finish in a few instructions
+		const auto count = std::min(claim & k_index_mask, m_capacity);
+		auto committed = arena.committed_count.load(std::memory_order_acquire);
+		for (; committed < count; committed = arena.committed_count.load(std::memory_order_acquire))
+		{
+			std::this_thread::yield();
+		}
+
+		// A lost page is handed back for the next batch of this arena to try again
+		size_type delivered = 0;
+		for (size_type begin = 0; begin < count; begin += k_page_size)
+		{
+			auto& slot = arena.pages[begin / k_page_size];
+			const auto* const page = slot.load(std::memory_order_relaxed);
+			const auto size = std::min(k_page_size, count - begin);
+			if (page == get_lost_page())
+			{
+				slot.store(nullptr, std::memory_order_relaxed);
+				continue;
+			}
+			function(std::span<const T>{ reinterpret_cast<const T*>(page->storage), size });
+			delivered += size;
+		}
+
+		arena.committed_count.store(0, std::memory_order_relaxed);
+		return delivered;
+	}
+
+	template <typename T>
+	typename EventQueue<T>::size_type EventQueue<T>::capacity() const noexcept
+	{
+		return m_capacity;
+	}
+
+	template <typename T>
+	UInt64 EventQueue<T>::get_dropped_count() const noexcept
+	{
+		return m_dropped_count.load(std::memory_order_relaxed);
+	}
+
+	template <typename T>
+	typename EventQueue<T>::Page* EventQueue<T>::get_page(Arena& arena, const size_type page_index) noexcept
+	{
+		auto& slot = arena.pages[page_index];
+		auto* page = slot.load(std::memory_order_acquire);
+		if (page != nullptr)
+		{
+			return page;
+		}
+
+		if (page == get_lost_page())
+		{
+			return nullptr;
+		}
+
+		// Producers racing for a new page all allocate one, the first to publish it wins. A failed allocation publishes
+		// the lost marker, so a page is either written by all of its producers or by none of them.
+		auto* const allocated = new (std::nothrow) Page;
+		auto* const published = allocated != nullptr ? allocated : get_lost_page();
+		if (slot.compare_exchange_strong(page, published, std::memory_order_acq_rel, std::memory_order_acquire))
+		{
+			return allocated;
+		}
+		delete allocated;
+		return page != get_lost_page() ? page : nullptr;
+	}
+
+	template <typename T>
+	typename EventQueue<T>::Page* EventQueue<T>::get_lost_page() noexcept
+	{
+		alignas(Page) static std::byte marker{};
+		return reinterpret_cast<Page*>(&marker);
+	}
+}
\ No newline at end of file
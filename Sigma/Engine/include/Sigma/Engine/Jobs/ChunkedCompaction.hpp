@@ -0,0 +1,68 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "Sigma/Engine/common/types.hpp"
+#include "Sigma/Engine/Jobs/JobSystem.hpp"
+
+namespace sigma::detail
+{
+	// Parallel stream compaction shared by the culling, broadphase and particle passes. Every chunk first writes
+	// what it keeps into its own window of a scratch buffer and reports the count, a prefix sum over the counts
+	// places the windows, and a second pass packs them together without any chunk waiting on the ones before it.
+
+	// Writes first + lane for every lane and advances by its mask bit, which keeps the compaction free of branches.
+	// output needs room for LaneCount entries past count.
+	template <std::size_t LaneCount>
+	[[nodiscard]] std::size_t append_lanes(const std::size_t first, const int mask, UInt32* output, std::size_t count) noexcept
+	{
+		for (std::size_t lane = 0; lane < LaneCount; ++lane)
+		{
+			output[count] = static_cast<UInt32>(first + lane);
+			count += static_cast<std::size_t>(mask >> lane) & 1;
+		}
+		return count;
+	}
+
+	// Calls list(chunk, begin, end) for every chunk_size sized chunk of [0, size) in parallel, each returning the
+	// number of entries it kept. Leaves chunk_count + 1 ascending offsets in offsets and returns the total.
+	template <typename ListFunction>
+	std::size_t list_chunks(JobSystem& job_system, const std::size_t size, const std::size_t chunk_size, std::vector<std::size_t>& offsets, ListFunction&& list)
+	{
+		const auto chunk_count = (size + chunk_size - 1) / chunk_size;
+		offsets.assign(chunk_count + 1, 0);
+		job_system.parallel_for(0, chunk_count, 1, [&](const std::size_t chunk_begin, const std::size_t chunk_end)
+		{
+			for (auto chunk = chunk_begin; chunk < chunk_end; ++chunk)
+			{
+				const auto begin = chunk * chunk_size;
+				offsets[chunk + 1] = list(chunk, begin, std::min(begin + chunk_size, size));
+			}
+		});
+
+		for (std::size_t chunk = 0; chunk < chunk_count; ++chunk)
+		{
+			offsets[chunk + 1] += offsets[chunk];
+		}
+		return offsets[chunk_count];
+	}
+
+	// Calls gather(chunk, output, count) in parallel for every chunk that kept entries, output being where its
+	// window starts in the packed result. Empty chunks are skipped, so gather never copies zero entries.
+	template <typename GatherFunction>
+	void gather_chunks(JobSystem& job_system, const std::vector<std::size_t>& offsets, GatherFunction&& gather)
+	{
+		job_system.parallel_for(0, offsets.size() - 1, 1, [&](const std::size_t chunk_begin, const std::size_t chunk_end)
+		{
+			for (auto chunk = chunk_begin; chunk < chunk_end; ++chunk)
+			{
+				const auto count = offsets[chunk + 1] - offsets[chunk];
+				if (count != 0)
+				{
+					gather(chunk, offsets[chunk], count);
+				}
+			}
+		});
+	}
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Sigma/Engine/common/types.hpp"
+
+namespace sigma
+{
+	class JobSystem
+	{
+	public:
+		using size_type = std::size_t;
+		using job_type = std::function<void()>;
+
+		JobSystem();
+		explicit JobSystem(size_type worker_count);
+		~JobSystem();
+
+		JobSystem(const JobSystem&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+		JobSystem(JobSystem&&) = delete;
+		JobSystem& operator=(JobSystem&&) = delete;
+
+		void submit(job_type job);
+
+		// Calls function(chunk_begin, chunk_end) for every grain_size sized chunk of [begin, end).
+		// The calling thread takes part in the work and only returns once every chunk is done.
+		template <typename Function>
+		void parallel_for(size_type begin, size_type end, size_type grain_size, Function&& function);
+
+		[[nodiscard]] size_type worker_count() const noexcept;
+
+		// Running totals since construction, readable from any thread. Jobs the caller runs itself, inline or while
+		// helping a parallel_for, are not attributed to a worker.
+		[[nodiscard]] UInt64 get_worker_busy_nanoseconds(size_type worker) const noexcept;
+		[[nodiscard]] UInt64 get_worker_job_count(size_type worker) const noexcept;
+
+		[[nodiscard]] static size_type default_worker_count() noexcept;
+	private:
+		struct ParallelForState
+		{
+			std::atomic<size_type> next_chunk{};
+			std::atomic<size_type> completed_chunks{};
+			std::atomic<size_type> active_helpers{};
+		};
+
+		struct alignas(64) WorkerStatistics
+		{
+			std::atomic<UInt64> busy_nanoseconds{};
+			std::atomic<UInt64> job_count{};
+		};
+
+		bool try_run_pending_job();
+		void worker_loop(const std::stop_token& stop_token, size_type worker);
+
+		std::mutex m_mutex{};
+		std::condition_variable_any m_condition{};
+		std::deque<job_type> m_jobs{};
+		std::unique_ptr<WorkerStatistics[]> m_worker_statistics{};
+		std::vector<std::jthread> m_workers{};
+	};
+
+
+	template <typename Function>
+	void JobSystem::parallel_for(const size_type begin, const size_type end, size_type grain_size, Function&& function)
+	{
+		if (begin >= end)
+		{
+			return;
+		}
+
+		grain_size = std::max<size_type>(grain_size, 1);
+		const auto chunk_count = (end - begin + grain_size - 1) / grain_size;
+		const auto helper_count = std::min(m_workers.size(), chunk_count - 1);
+
+		if (helper_count == 0)
+		{
+			function(begin, end);
+			return;
+		}
+
+		ParallelForState state{};
+		state.active_helpers.store(helper_count, std::memory_order_relaxed);
+
+		const auto run_chunks = [&]()
+		{
+			for (auto chunk = state.next_chunk.fetch_add(1, std::memory_order_relaxed);
+				chunk < chunk_count;
+				chunk = state.next_chunk.fetch_add(1, std::memory_order_relaxed))
+			{
+				const auto chunk_begin = begin + chunk * grain_size;
+				function(chunk_begin, std::min(chunk_begin + grain_size, end));
+				state.completed_chunks.fetch_add(1, std::memory_order_acq_rel);
+			}
+		};
+
+		for (size_type helper = 0; helper < helper_count; ++helper)
+		{
+			submit([&]()
+			{
+				run_chunks();
+				state.active_helpers.fetch_sub(1, std::memory_order_acq_rel);
+			});
+		}
+
+		run_chunks();
+
+		// Helpers reference state on this stack frame, so wait until all of them have left, not only until the
+		// chunks are done. Running queued jobs meanwhile keeps nested parallel_for calls from deadlocking.
+		while (state.completed_chunks.load(std::memory_order_acquire) < chunk_count ||
+			state.active_helpers.load(std::memory_order_acquire) != 0)
+		{
+			if (!try_run_pending_job())
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+}
@@ -0,0 +1,279 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "Sigma/Engine/common/types.hpp"
+
+namespace sigma
+{
+	enum class LogLevel : UInt8
+	{
+		trace,
+		debug,
+		info,
+		warning,
+		error
+	};
+
+	// Format string captured as a template argument. Every {} is replaced by the next argument, and the number of
+	// placeholders is checked against the arguments at compile time.
+	template <std::size_t Size>
+	struct LogFormat
+	{
+		consteval LogFormat(const char (&format)[Size])
+		{
+			std::copy_n(format, Size, text);
+		}
+
+		[[nodiscard]] consteval std::size_t get_placeholder_count() const
+		{
+			std::size_t count = 0;
+			for (std::size_t index = 0; index + 1 < Size; ++index)
+			{
+				if (text[index] == '{' && text[index + 1] == '}')
+				{
+					++count;
+					++index;
+				}
+			}
+			return count;
+		}
+
+		char text[Size]{};
+	};
+
+	namespace detail
+	{
+		// Arguments are copied into the record as raw bytes and only turned into text on the logging thread. Strings
+		// are copied with their length in front, everything else has to be trivially copyable.
+		template <typename T>
+		struct LogArgument
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "Log arguments are copied as raw bytes");
+
+			[[nodiscard]] static std::size_t get_size(const T&) noexcept
+			{
+				return sizeof(T);
+			}
+
+			static std::byte* encode(std::byte* output, const T& value) noexcept
+			{
+				std::memcpy(output, &value, sizeof(T));
+				return output + sizeof(T);
+			}
+
+			static const std::byte* decode(const std::byte* input, std::string& text)
+			{
+				T value;
+				std::memcpy(&value, input, sizeof(T));
+				append_value(text, value);
+				return input + sizeof(T);
+			}
+
+			static void append_value(std::string& text, const T value)
+			{
+				if constexpr (std::is_same_v<T, bool>)
+				{
+					text += value ? "true" : "false";
+				}
+				else if constexpr (std::is_same_v<T, char>)
+				{
+					text += value;
+				}
+				else if constexpr (std::is_enum_v<T>)
+				{
+					LogArgument<std::underlying_type_t<T>>::append_value(text, static_cast<std::underlying_type_t<T>>(value));
+				}
+				else if constexpr (std::is_pointer_v<T>)
+				{
+					char buffer[2 + 2 * sizeof(void*)]{ '0', 'x' };
+					const auto result = std::to_chars(buffer + 2, std::end(buffer), reinterpret_cast<std::uintptr_t>(value), 16);
+					text.append(buffer, result.ptr);
+				}
+				else
+				{
+					char buffer[64];
+					const auto result = std::to_chars(std::begin(buffer), std::end(buffer), value);
+					text.append(buffer, result.ptr);
+				}
+			}
+		};
+
+		struct LogStringArgument
+		{
+			[[nodiscard]] static std::size_t get_size(const std::string_view value) noexcept
+			{
+				return sizeof(UInt32) + value.size();
+			}
+
+			static std::byte* encode(std::byte* output, const std::string_view value) noexcept
+			{
+				const auto size = static_cast<UInt32>(value.size());
+				std::memcpy(output, &size, sizeof(size));
+				std::memcpy(output + sizeof(size), value.data(), value.size());
+				return output + sizeof(size) + value.size();
+			}
+
+			static const std::byte* decode(const std::byte* input, std::string& text)
+			{
+				UInt32 size;
+				std::memcpy(&size, input, sizeof(size));
+				text.append(reinterpret_cast<const char*>(input + sizeof(size)), size);
+				return input + sizeof(size) + size;
+			}
+		};
+
+		template <>
+		struct LogArgument<std::string_view> : LogStringArgument {};
+
+		template <>
+		struct LogArgument<std::string> : LogStringArgument {};
+
+		template <>
+		struct LogArgument<const char*> : LogStringArgument {};
+
+		template <>
+		struct LogArgument<char*> : LogStringArgument {};
+	}
+
+	// What the logging thread needs to turn the raw arguments of a record back into text, one per call site
+	struct LogSite
+	{
+		std::string_view format{};
+		void (*append_message)(std::string& text, std::string_view format, const std::byte* arguments){};
+	};
+
+	// Asynchronous logger. Each thread that logs gets its own single-producer ring of binary records, so logging takes
+	// no lock and shares no cache line with other threads: a record is a pointer to its call site, a timestamp and the
+	// raw argument bytes. A background thread drains the rings, formats the records and writes them to the file.
+	// Records that do not fit into a full ring, or whose thread's ring could not be allocated, are dropped and
+	// counted. Lines of different threads are ordered by thread within one drain, each carries its timestamp.
+	class Logger
+	{
+	public:
+		using size_type = std::size_t;
+		using clock = std::chrono::steady_clock;
+
+		static constexpr size_type k_default_buffer_size = 64 * 1024;
+		static constexpr auto k_poll_interval = std::chrono::milliseconds{ 1 };
+
+		// Every thread gets a ring of buffer_size bytes, rounded up to a power of two, on its first record
+		explicit Logger(size_type buffer_size = k_default_buffer_size);
+		~Logger();
+
+		Logger(const Logger&) = delete;
+		Logger& operator=(const Logger&) = delete;
+		Logger(Logger&&) = delete;
+		Logger& operator=(Logger&&) = delete;
+
+		// Starts the logging thread, records logged before are kept and written once it runs
+		[[nodiscard]] bool open(const std::filesystem::path& path);
+		// Writes every pending record and stops the logging thread
+		void close();
+		[[nodiscard]] bool is_open() const noexcept;
+
+		template <LogFormat Format, typename... Args>
+		void log(LogLevel level, const Args&... args) noexcept;
+
+		void set_level(LogLevel level) noexcept;
+		[[nodiscard]] LogLevel get_level() const noexcept;
+
+		// Blocks until everything logged before the call is written to the file
+		void flush();
+
+		[[nodiscard]] UInt64 get_written_count() const noexcept;
+		[[nodiscard]] UInt64 get_dropped_count() const noexcept;
+	private:
+		struct RecordHeader
+		{
+			const LogSite* site{};
+			UInt64 timestamp{};
+			UInt32 size{};
+			LogLevel level{};
+		};
+
+		struct ThreadBuffer;
+
+		template <LogFormat Format, typename... Args>
+		static void append_message(std::string& text, std::string_view format, const std::byte* arguments);
+		static void append_until_placeholder(std::string& text, std::string_view& format);
+
+		// Null when the thread has no ring and creating one failed
+		[[nodiscard]] ThreadBuffer* get_thread_buffer() noexcept;
+		[[nodiscard]] static std::byte* try_reserve(ThreadBuffer& buffer, size_type size) noexcept;
+		static void commit(ThreadBuffer& buffer) noexcept;
+
+		void run(const std::stop_token& stop_token);
+		bool drain();
+		void write_record(const ThreadBuffer& buffer, const RecordHeader& header, const std::byte* arguments);
+
+		const UInt64 m_id;
+		const size_type m_buffer_size;
+		std::atomic<LogLevel> m_level{ LogLevel::info };
+
+		mutable std::mutex m_buffers_mutex{};
+		std::vector<std::unique_ptr<ThreadBuffer>> m_buffers{};
+		// Records of threads whose ring could not be created
+		std::atomic<UInt64> m_unbuffered_dropped_count{};
+
+		std::ofstream m_file{};
+		std::string m_line{};
+		std::vector<ThreadBuffer*> m_drain_buffers{};
+		clock::time_point m_start{ clock::now() };
+		std::atomic<UInt64> m_written_count{};
+		std::mutex m_drain_mutex{};
+		std::jthread m_thread{};
+	};
+
+
+	template <LogFormat Format, typename... Args>
+	void Logger::log(const LogLevel level, const Args&... args) noexcept
+	{
+		static_assert(Format.get_placeholder_count() == sizeof...(Args), "Every {} of the format needs exactly one argument");
+		static constexpr LogSite k_site{ std::string_view{ Format.text, sizeof(Format.text) - 1 }, &append_message<Format, std::decay_t<Args>...> };
+
+		if (level < m_level.load(std::memory_order_relaxed))
+		{
+			return;
+		}
+
+		auto* const buffer = get_thread_buffer();
+		if (buffer == nullptr)
+		{
+			return;
+		}
+
+		const auto size = (sizeof(RecordHeader) + (detail::LogArgument<std::decay_t<Args>>::get_size(args) + ... + 0) + 7) & ~size_type{ 7 };
+		auto* output = try_reserve(*buffer, size);
+		if (output == nullptr)
+		{
+			return;
+		}
+
+		const RecordHeader header{ &k_site, static_cast<UInt64>(std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - m_start).count()), static_cast<UInt32>(size), level };
+		std::memcpy(output, &header, sizeof(header));
+		output += sizeof(header);
+		((output = detail::LogArgument<std::decay_t<Args>>::encode(output, args)), ...);
+		commit(*buffer);
+	}
+
+	template <LogFormat Format, typename... Args>
+	void Logger::append_message(std::string& text, std::string_view format, [[maybe_unused]] const std::byte* arguments)
+	{
+		((append_until_placeholder(text, format), arguments = detail::LogArgument<Args>::decode(arguments, text)), ...);
+		text += format;
+	}
+}
\ No newline at end of file
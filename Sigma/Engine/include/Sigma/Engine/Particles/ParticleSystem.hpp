@@ -0,0 +1,93 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "Sigma/Engine/common/types.hpp"
+#include "Sigma/Engine/Jobs/JobSystem.hpp"
+
+namespace sigma
+{
+	struct ParticleEmitter
+	{
+		Vector3 position{};
+		// Particles spawn inside a cube of this half size around the position
+		Float spread{};
+		Vector3 velocity{};
+		// Each velocity component varies by up to this much either way
+		Float velocity_spread{};
+		Float lifetime{ 1.0f };
+		Float lifetime_spread{};
+		UInt32 color{ 0xFFFFFFFF };
+	};
+
+	struct ParticleStreams
+	{
+		const Float* position_x{};
+		const Float* position_y{};
+		const Float* position_z{};
+		const Float* velocity_x{};
+		const Float* velocity_y{};
+		const Float* velocity_z{};
+		const Float* age{};
+		const Float* lifetime{};
+		const UInt32* color{};
+		std::size_t size{};
+	};
+
+	// Particles as one stream per component with no per-particle identity. Emitters append whole batches, and update()
+	// integrates every particle and then removes the dead ones in one compaction pass: each chunk lists its survivors,
+	// a prefix sum over the chunk counts gives every chunk its output offset, and the survivors are gathered into a
+	// second set of streams that becomes the current one. Order is preserved.
+	class ParticleSystem
+	{
+	public:
+		using size_type = std::size_t;
+
+		static constexpr size_type k_chunk_size = 8192;
+
+		// Emission stops at the capacity, the streams never reallocate
+		explicit ParticleSystem(size_type capacity);
+
+		// Spawns count particles, fewer if the capacity runs out, and returns how many were spawned. The seed varies
+		// the random spread between batches.
+		size_type emit(const ParticleEmitter& emitter, size_type count, UInt32 seed, JobSystem& job_system);
+		void update(Float time_step, const Vector3& gravity, JobSystem& job_system);
+		void clear() noexcept;
+
+		[[nodiscard]] size_type size() const noexcept;
+		[[nodiscard]] size_type capacity() const noexcept;
+		[[nodiscard]] ParticleStreams get_streams() const noexcept;
+	private:
+		enum Stream : size_type
+		{
+			position_x,
+			position_y,
+			position_z,
+			velocity_x,
+			velocity_y,
+			velocity_z,
+			age,
+			lifetime,
+			stream_count
+		};
+
+		struct Streams
+		{
+			std::array<std::vector<Float>, stream_count> floats{};
+			std::vector<UInt32> color{};
+		};
+
+		void integrate(Float time_step, const Vector3& gravity, size_type begin, size_type end) noexcept;
+		[[nodiscard]] size_type list_survivors(size_type begin, size_type end, UInt32* output) const noexcept;
+		void compact(size_type survivor_count, JobSystem& job_system);
+
+		Streams m_current{};
+		Streams m_next{};
+		size_type m_size{};
+		size_type m_capacity{};
+
+		std::vector<UInt32> m_survivors{};
+		std::vector<size_type> m_chunk_offsets{};
+	};
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <vector>
+
+#include "Sigma/Engine/Culling/CullingBounds.hpp"
+#include "Sigma/Engine/DataStructures/SparseSet.hpp"
+#include "Sigma/Engine/Jobs/JobSystem.hpp"
+#include "Sigma/Engine/Spatial/Bounds.hpp"
+
+namespace sigma
+{
+	struct RigidBodyDesc
+	{
+		Vector3 position{};
+		Vector3 velocity{};
+		// Zero makes the body static, it ignores gravity and forces but still moves with its velocity
+		Float mass{ 1.0f };
+		Vector3 half_extents{ 0.5f, 0.5f, 0.5f };
+	};
+
+	struct RigidBodyStreams
+	{
+		Float* position_x{};
+		Float* position_y{};
+		Float* position_z{};
+		Float* velocity_x{};
+		Float* velocity_y{};
+		Float* velocity_z{};
+		Float* force_x{};
+		Float* force_y{};
+		Float* force_z{};
+		const Float* inverse_mass{};
+		std::size_t size{};
+	};
+
+	// Rigid bodies as one float stream per component, with an axis-aligned box around each. Erasing moves the last
+	// body into the hole, so body indices are only stable between changes of get_version().
+	class RigidBodies
+	{
+	public:
+		using size_type = std::size_t;
+
+		static constexpr size_type k_chunk_size = 8192;
+
+		explicit RigidBodies(size_type capacity);
+
+		void add(Entity entity, const RigidBodyDesc& desc);
+		void erase(Entity entity);
+
+		[[nodiscard]] size_type size() const noexcept;
+		[[nodiscard]] bool contains(Entity entity) const noexcept;
+		[[nodiscard]] Entity get_entity(size_type index) const noexcept;
+		[[nodiscard]] const std::vector<Entity>& get_entities() const noexcept;
+		// Changes whenever a body is added or erased
+		[[nodiscard]] UInt64 get_version() const noexcept;
+
+		[[nodiscard]] Vector3 get_position(Entity entity) const noexcept;
+		[[nodiscard]] Vector3 get_velocity(Entity entity) const noexcept;
+		void set_velocity(Entity entity, const Vector3& velocity) noexcept;
+		// Accumulated until the next integration
+		void apply_force(Entity entity, const Vector3& force) noexcept;
+		[[nodiscard]] Aabb get_bounds(Entity entity) const noexcept;
+
+		[[nodiscard]] RigidBodyStreams get_streams() noexcept;
+		// Positions and half extents, with the enclosing sphere as radius, so bodies can be culled directly
+		[[nodiscard]] BoundsStreams get_bounds_streams() const noexcept;
+
+		// Semi-implicit Euler: velocities take the acceleration first and positions move with the new velocities
+		void integrate(Float time_step, const Vector3& gravity, JobSystem& job_system);
+		static void integrate(const RigidBodyStreams& streams, Float time_step, const Vector3& gravity, size_type begin, size_type end) noexcept;
+	private:
+		SparseSet<UInt32> m_slots;
+		std::vector<Entity> m_entities{};
+		std::vector<Float> m_position_x{};
+		std::vector<Float> m_position_y{};
+		std::vector<Float> m_position_z{};
+		std::vector<Float> m_velocity_x{};
+		std::vector<Float> m_velocity_y{};
+		std::vector<Float> m_velocity_z{};
+		std::vector<Float> m_force_x{};
+		std::vector<Float> m_force_y{};
+		std::vector<Float> m_force_z{};
+		std::vector<Float> m_inverse_mass{};
+		std::vector<Float> m_extent_x{};
+		std::vector<Float> m_extent_y{};
+		std::vector<Float> m_extent_z{};
+		std::vector<Float> m_radius{};
+		UInt64 m_version{};
+	};
+}
\ No newline at end of file
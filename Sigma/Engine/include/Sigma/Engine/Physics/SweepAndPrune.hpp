@@ -0,0 +1,51 @@
+#pragma once
+
+#include <vector>
+
+#include "Sigma/Engine/Physics/RigidBodies.hpp"
+
+namespace sigma
+{
+	struct ContactPair
+	{
+		Entity first{ k_null_entity };
+		Entity second{ k_null_entity };
+	};
+
+	// Broadphase that keeps the bodies sorted by the lower x bound of their boxes across frames. With coherent motion
+	// the order barely changes, so an insertion sort repairs it in close to linear time; when too many bodies swapped
+	// places it falls back to a full sort. The sorted boxes are gathered into streams, and workers sweep chunks of
+	// them, each comparing a box with the following ones until their x ranges separate, four at a time.
+	class SweepAndPrune
+	{
+	public:
+		using size_type = std::size_t;
+
+		static constexpr size_type k_chunk_size = 1024;
+		// Insertion sort moves allowed per body before the order is rebuilt with a full sort
+		static constexpr size_type k_resort_move_budget = 8;
+
+		// Replaces pairs with every pair of bodies whose boxes overlap, in the order of the sweep
+		void update(const RigidBodies& bodies, std::vector<ContactPair>& pairs, JobSystem& job_system);
+
+		[[nodiscard]] bool was_fully_sorted() const noexcept;
+	private:
+		void sort(const BoundsStreams& streams, UInt64 version);
+		void sweep_chunk(const RigidBodies& bodies, size_type begin, size_type end, std::vector<ContactPair>& pairs) const;
+
+		std::vector<UInt32> m_order{};
+		std::vector<Float> m_keys{};
+		UInt64 m_version{ static_cast<UInt64>(-1) };
+		bool m_fully_sorted{};
+
+		std::vector<Float> m_min_x{};
+		std::vector<Float> m_max_x{};
+		std::vector<Float> m_min_y{};
+		std::vector<Float> m_max_y{};
+		std::vector<Float> m_min_z{};
+		std::vector<Float> m_max_z{};
+
+		std::vector<std::vector<ContactPair>> m_chunk_pairs{};
+		std::vector<size_type> m_chunk_offsets{};
+	};
+}
\ No newline at end of file
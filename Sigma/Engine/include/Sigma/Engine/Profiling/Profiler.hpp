@@ -0,0 +1,81 @@
+#pragma once
+
+#include <chrono>
+#include <vector>
+
+#include "Sigma/Engine/DataStructures/MpscRingBuffer.hpp"
+#include "Sigma/Engine/Jobs/JobSystem.hpp"
+
+namespace sigma
+{
+	enum class ProfileSampleType : UInt8
+	{
+		frame,
+		scope,
+		memory,
+		worker
+	};
+
+	// Names are not copied: they have to be string literals or otherwise outlive every consumer of the sample
+	struct ProfileSample
+	{
+		ProfileSampleType type{};
+		UInt32 thread{};
+		const char* name{};
+		UInt64 frame{};
+		// Nanoseconds for frames, scopes and workers (busy time within the frame), bytes for memory
+		UInt64 value{};
+	};
+
+	// Collects timing and memory samples from any thread into one lock-free ring for a single consumer, usually a
+	// tool that drains it once per displayed frame. Samples pushed while the ring is full are dropped and counted.
+	class Profiler
+	{
+	public:
+		using size_type = std::size_t;
+		using clock = std::chrono::steady_clock;
+
+		static constexpr size_type k_default_capacity = 16384;
+
+		explicit Profiler(size_type capacity = k_default_capacity);
+
+		// Pushes the time since the previous end_frame, or since construction, and the busy time of every worker of
+		// the job system over the same interval
+		void end_frame(const JobSystem& job_system);
+
+		void record_scope(const char* name, clock::duration duration) noexcept;
+		void record_memory(const char* name, size_type bytes) noexcept;
+
+		[[nodiscard]] bool try_pop(ProfileSample& sample) noexcept;
+
+		[[nodiscard]] UInt64 get_frame_index() const noexcept;
+		[[nodiscard]] UInt64 get_dropped_count() const noexcept;
+
+		// Small dense index of the calling thread, assigned on first use
+		[[nodiscard]] static UInt32 get_thread_index() noexcept;
+	private:
+		void push(const ProfileSample& sample) noexcept;
+
+		MpscRingBuffer<ProfileSample> m_samples;
+		std::atomic<UInt64> m_frame_index{};
+		std::atomic<UInt64> m_dropped_count{};
+		clock::time_point m_frame_begin{ clock::now() };
+		std::vector<UInt64> m_worker_busy_at_begin{};
+	};
+
+	class ProfileScope
+	{
+	public:
+		ProfileScope(Profiler& profiler, const char* name) noexcept;
+		~ProfileScope();
+
+		ProfileScope(const ProfileScope&) = delete;
+		ProfileScope& operator=(const ProfileScope&) = delete;
+		ProfileScope(ProfileScope&&) = delete;
+		ProfileScope& operator=(ProfileScope&&) = delete;
+	private:
+		Profiler& m_profiler;
+		const char* m_name;
+		Profiler::clock::time_point m_begin;
+	};
+}
\ No newline at end of file
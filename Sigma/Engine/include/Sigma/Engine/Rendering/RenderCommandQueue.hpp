@@ -0,0 +1,72 @@
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "Sigma/Engine/Rendering/RenderFrame.hpp"
+
+namespace sigma
+{
+	// Two frames handed back and forth between the simulation and the render thread: the simulation fills frame N + 1
+	// while frame N is rendered. The lock only guards the hand-off of a frame, never the building or the drawing.
+	class RenderCommandQueue
+	{
+	public:
+		using size_type = std::size_t;
+
+		static constexpr size_type k_frame_count = 2;
+
+		// Simulation side. Blocks until the render thread has released the frame previously built in this slot.
+		// Returns nullptr once the queue is closed.
+		[[nodiscard]] RenderFrame* begin_frame();
+		void submit_frame();
+
+		// Render side. Blocks until a frame is submitted, returns nullptr once the queue is closed and drained.
+		[[nodiscard]] RenderFrame* acquire_frame();
+		void release_frame();
+
+		void close();
+		[[nodiscard]] bool is_closed() const;
+	private:
+		enum class FrameState
+		{
+			free,
+			building,
+			ready,
+			rendering
+		};
+
+		std::array<RenderFrame, k_frame_count> m_frames{};
+		std::array<FrameState, k_frame_count> m_states{};
+		size_type m_write_slot{};
+		size_type m_read_slot{};
+		UInt64 m_next_frame_index{};
+		bool m_closed{};
+		mutable std::mutex m_mutex{};
+		std::condition_variable m_condition{};
+	};
+
+	// Consumes the queue on its own thread: every acquired frame is sorted, handed to the callback and released
+	class RenderThread
+	{
+	public:
+		using callback_type = std::function<void(RenderFrame&)>;
+
+		RenderThread(RenderCommandQueue& queue, callback_type callback);
+		~RenderThread();
+
+		RenderThread(const RenderThread&) = delete;
+		RenderThread& operator=(const RenderThread&) = delete;
+		RenderThread(RenderThread&&) = delete;
+		RenderThread& operator=(RenderThread&&) = delete;
+	private:
+		void run();
+
+		RenderCommandQueue& m_queue;
+		callback_type m_callback;
+		std::jthread m_thread{};
+	};
+}
\ No newline at end of file
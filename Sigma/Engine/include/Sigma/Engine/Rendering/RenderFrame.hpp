@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "Sigma/Engine/Rendering/SoftwareRasterizer.hpp"
+
+namespace sigma
+{
+	enum class RenderCommandType : UInt32
+	{
+		draw_mesh
+	};
+
+	// Mesh data is referenced, not copied: it has to stay alive and unchanged until the frame has been rendered
+	struct DrawMeshCommand
+	{
+		static constexpr RenderCommandType k_type = RenderCommandType::draw_mesh;
+
+		Matrix4x4 world_view_projection{};
+		const RasterVertex* vertices{};
+		const UInt32* indices{};
+		UInt32 vertex_count{};
+		UInt32 index_count{};
+	};
+
+	struct RenderCommand
+	{
+		UInt64 key{};
+		RenderCommandType type{};
+		UInt32 offset{};
+	};
+
+	// Sort key layout, most significant first: view (8 bits), layer (8 bits), depth (24 bits), material (24 bits).
+	// Opaque layers pass the depth as is to draw front to back, translucent layers pass 1 - depth.
+	[[nodiscard]] constexpr UInt64 make_render_key(const UInt8 view, const UInt8 layer, const Float depth, const UInt32 material) noexcept
+	{
+		constexpr auto k_depth_mask = (UInt64{ 1 } << 24) - 1;
+		const auto clamped_depth = depth < 0.0f ? 0.0f : (depth > 1.0f ? 1.0f : depth);
+		const auto quantized_depth = static_cast<UInt64>(clamped_depth * static_cast<Float>(k_depth_mask));
+		return UInt64{ view } << 56 | UInt64{ layer } << 48 | quantized_depth << 24 | (material & k_depth_mask);
+	}
+
+	// Draw commands of one simulated frame. Payloads go into a linear byte buffer and the command list only holds
+	// their offsets, so both buffers keep their capacity from frame to frame and steady-state frames do not allocate.
+	class RenderFrame
+	{
+	public:
+		using size_type = std::size_t;
+
+		void clear() noexcept;
+
+		template <typename Command>
+		void push(UInt64 key, const Command& command);
+
+		// Stable LSD radix sort on the keys, one pass per byte with passes skipped where every key has the same byte
+		void sort();
+
+		[[nodiscard]] size_type size() const noexcept;
+		[[nodiscard]] const std::vector<RenderCommand>& get_commands() const noexcept;
+
+		template <typename Command>
+		[[nodiscard]] Command get_payload(const RenderCommand& command) const noexcept;
+
+		[[nodiscard]] UInt64 get_frame_index() const noexcept;
+		void set_frame_index(UInt64 frame_index) noexcept;
+	private:
+		std::vector<RenderCommand> m_commands{};
+		std::vector<RenderCommand> m_sort_scratch{};
+		std::vector<std::byte> m_payloads{};
+		UInt64 m_frame_index{};
+	};
+
+	void draw(const RenderFrame& frame, SoftwareRasterizer& rasterizer);
+
+
+	template <typename Command>
+	void RenderFrame::push(const UInt64 key, const Command& command)
+	{
+		static_assert(std::is_trivially_copyable_v<Command>, "Render commands are copied as raw bytes");
+
+		const auto offset = m_payloads.size();
+		m_payloads.resize(offset + sizeof(Command));
+		std::memcpy(m_payloads.data() + offset, &command, sizeof(Command));
+		m_commands.push_back({ key, Command::k_type, static_cast<UInt32>(offset) });
+	}
+
+	template <typename Command>
+	Command RenderFrame::get_payload(const RenderCommand& command) const noexcept
+	{
+		Command payload{};
+		std::memcpy(&payload, m_payloads.data() + command.offset, sizeof(Command));
+		return payload;
+	}
+}
\ No newline at end of file
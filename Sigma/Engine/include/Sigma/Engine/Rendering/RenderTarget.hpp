@@ -0,0 +1,47 @@
+#pragma once
+
+#include <filesystem>
+#include <vector>
+
+#include "Sigma/Engine/common/types.hpp"
+
+namespace sigma
+{
+	// Color (0xAARRGGBB) and depth planes of a CPU rendered frame. Rows are padded to whole tiles so the rasterizer
+	// can work on full pixel quads without bounds checks.
+	class RenderTarget
+	{
+	public:
+		using size_type = std::size_t;
+
+		static constexpr size_type k_alignment = 64;
+
+		RenderTarget() = default;
+		RenderTarget(size_type width, size_type height);
+
+		void resize(size_type width, size_type height);
+
+		[[nodiscard]] size_type get_width() const noexcept;
+		[[nodiscard]] size_type get_height() const noexcept;
+		[[nodiscard]] size_type get_stride() const noexcept;
+		[[nodiscard]] size_type get_padded_height() const noexcept;
+
+		[[nodiscard]] UInt32* get_color_data() noexcept;
+		[[nodiscard]] const UInt32* get_color_data() const noexcept;
+		[[nodiscard]] Float* get_depth_data() noexcept;
+		[[nodiscard]] const Float* get_depth_data() const noexcept;
+
+		[[nodiscard]] UInt32 get_color(size_type x, size_type y) const noexcept;
+		[[nodiscard]] Float get_depth(size_type x, size_type y) const noexcept;
+
+		// Writes the color plane as a binary PPM, returns false if the file could not be written
+		[[nodiscard]] bool save_ppm(const std::filesystem::path& path) const;
+	private:
+		size_type m_width{};
+		size_type m_height{};
+		size_type m_stride{};
+		size_type m_padded_height{};
+		std::vector<UInt32> m_color{};
+		std::vector<Float> m_depth{};
+	};
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "Sigma/Engine/Jobs/JobSystem.hpp"
+#include "Sigma/Engine/Rendering/RenderTarget.hpp"
+
+namespace sigma
+{
+	struct RasterVertex
+	{
+		Vector3 position{};
+		Vector3 color{};
+	};
+
+	enum class CullMode
+	{
+		none,
+		back
+	};
+
+	// Tiled, binned triangle rasterizer. Draws are recorded during the frame; render() transforms and clips them,
+	// bins the resulting screen triangles into tiles and then rasterizes every tile on its own worker with
+	// fixed-point edge functions, a less-than depth test and perspective correct vertex colors.
+	// Triangles whose vertices appear clockwise on screen are front facing.
+	class SoftwareRasterizer
+	{
+	public:
+		using size_type = std::size_t;
+
+		static constexpr size_type k_tile_size = RenderTarget::k_alignment;
+		static constexpr size_type k_vertex_grain_size = 4096;
+		static constexpr UInt32 k_default_clear_color = 0xFF000000;
+
+		void set_cull_mode(CullMode cull_mode) noexcept;
+		void set_clear_color(UInt32 color) noexcept;
+
+		void begin_frame();
+		void draw(std::span<const RasterVertex> vertices, std::span<const UInt32> indices, const Matrix4x4& world_view_projection);
+		void render(RenderTarget& target, JobSystem& job_system);
+
+		// Screen space triangles that survived clipping and culling in the last render
+		[[nodiscard]] size_type get_triangle_count() const noexcept;
+	private:
+		struct ClipVertex
+		{
+			Vector4 position{};
+			Vector3 color{};
+		};
+
+		struct Draw
+		{
+			Matrix4x4 world_view_projection{};
+			size_type first_vertex{};
+			size_type vertex_count{};
+		};
+
+		struct Edge
+		{
+			Int64 a{};
+			Int64 b{};
+			Int64 origin_x{};
+			Int64 origin_y{};
+			Int64 bias{};
+		};
+
+		struct Plane
+		{
+			Float origin{};
+			Float step_x{};
+			Float step_y{};
+		};
+
+		struct ScreenTriangle
+		{
+			Int32 min_x{};
+			Int32 min_y{};
+			Int32 max_x{};
+			Int32 max_y{};
+			Edge edges[3]{};
+			Float origin_x{};
+			Float origin_y{};
+			// Depth, 1 / w and color / w across the screen
+			Plane planes[5]{};
+		};
+
+		struct BinningChunk
+		{
+			std::vector<ScreenTriangle> triangles{};
+			std::vector<std::vector<UInt32>> bins{};
+		};
+
+		void transform_vertices(JobSystem& job_system);
+		void setup_triangles(BinningChunk& chunk, size_type first_triangle, size_type last_triangle, const RenderTarget& target);
+		void setup_triangle(BinningChunk& chunk, const ClipVertex& a, const ClipVertex& b, const ClipVertex& c, const RenderTarget& target);
+		void rasterize_tile(size_type tile, RenderTarget& target) const;
+
+		CullMode m_cull_mode{ CullMode::back };
+		UInt32 m_clear_color{ k_default_clear_color };
+		Float m_guard_band{};
+		size_type m_tile_columns{};
+		size_type m_tile_rows{};
+		std::vector<Draw> m_draws{};
+		std::vector<RasterVertex> m_vertices{};
+		std::vector<UInt32> m_indices{};
+		std::vector<ClipVertex> m_clip_vertices{};
+		std::vector<BinningChunk> m_chunks{};
+	};
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <vector>
+
+#include "Sigma/Engine/common/types.hpp"
+#include "Sigma/Engine/DataStructures/SparseSet.hpp"
+#include "Sigma/Engine/Jobs/JobSystem.hpp"
+
+namespace sigma
+{
+	struct TransformNode
+	{
+		Entity entity{ k_null_entity };
+		Entity parent{ k_null_entity };
+		std::size_t parent_slot{};
+		UInt32 depth{};
+	};
+
+	struct TransformTicks
+	{
+		UInt64 local_changed{};
+		UInt64 world_changed{};
+	};
+
+	// Every pool shares one dense order: breadth first, so each depth level is a contiguous range that only reads
+	// world matrices of the level before it.
+	class TransformHierarchy
+	{
+	public:
+		using size_type = std::size_t;
+
+		static constexpr size_type k_no_slot = std::numeric_limits<size_type>::max();
+		static constexpr size_type k_update_grain_size = 2048;
+
+		TransformHierarchy() = default;
+		explicit TransformHierarchy(size_type capacity);
+
+		void reserve(size_type capacity);
+
+		void emplace(Entity entity, const Matrix4x4& local, Entity parent = k_null_entity);
+		void erase(Entity entity);
+
+		void set_parent(Entity entity, Entity parent);
+		void set_local(Entity entity, const Matrix4x4& local);
+
+		void update();
+		void update(JobSystem& job_system);
+
+		[[nodiscard]] size_type size() const noexcept;
+		[[nodiscard]] size_type level_count() const noexcept;
+		[[nodiscard]] UInt64 get_tick() const noexcept;
+		// Tick of the last update that changed the dense order, row positions of every pool are stable until then
+		[[nodiscard]] UInt64 get_structure_tick() const noexcept;
+
+		[[nodiscard]] bool has_node(Entity entity) const noexcept;
+		[[nodiscard]] Entity get_parent(Entity entity) const noexcept;
+		[[nodiscard]] const Matrix4x4& get_local(Entity entity) const noexcept;
+		[[nodiscard]] const Matrix4x4& get_world(Entity entity) const noexcept;
+		[[nodiscard]] UInt64 get_world_change_tick(Entity entity) const noexcept;
+
+		[[nodiscard]] const SparseSet<TransformNode>& get_nodes() const noexcept;
+		[[nodiscard]] const SparseSet<Matrix4x4>& get_world_pool() const noexcept;
+		[[nodiscard]] const SparseSet<TransformTicks>& get_ticks() const noexcept;
+	private:
+		// Children of an entity as a doubly linked list, indexed by entity so the dense reorders leave it alone
+		struct ChildLinks
+		{
+			Entity first_child{ k_null_entity };
+			Entity next_sibling{ k_null_entity };
+			Entity previous_sibling{ k_null_entity };
+		};
+
+		void link_child(Entity entity, Entity parent);
+		void unlink_child(Entity entity, Entity parent) noexcept;
+		void mark_dirty(Entity entity) noexcept;
+		void sort_breadth_first();
+		size_type update_range(size_type begin, size_type end) noexcept;
+
+		template <typename LevelFunction>
+		void propagate(LevelFunction&& update_level);
+
+		SparseSet<TransformNode> m_nodes{};
+		SparseSet<Matrix4x4> m_local{};
+		SparseSet<Matrix4x4> m_world{};
+		SparseSet<TransformTicks> m_ticks{};
+
+		std::vector<ChildLinks> m_links{};
+		std::vector<size_type> m_level_offsets{};
+
+		UInt64 m_tick{ 1 };
+		UInt64 m_structure_tick{};
+		size_type m_first_dirty_depth{ k_no_slot };
+		size_type m_last_dirty_depth{};
+		bool m_structure_dirty{};
+	};
+}
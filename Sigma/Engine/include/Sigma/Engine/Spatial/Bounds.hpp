@@ -0,0 +1,150 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "Sigma/Engine/common/types.hpp"
+
+namespace sigma
+{
+	struct Aabb
+	{
+		Vector3 min{};
+		Vector3 max{};
+	};
+
+	struct Sphere
+	{
+		Vector3 center{};
+		Float radius{};
+	};
+
+	struct Ray
+	{
+		Vector3 origin{};
+		Vector3 direction{};
+		Float max_distance{ std::numeric_limits<Float>::max() };
+	};
+
+	struct RayHit
+	{
+		Entity entity{ k_null_entity };
+		Float distance{ std::numeric_limits<Float>::max() };
+	};
+
+	[[nodiscard]] inline Aabb merge(const Aabb& lhs, const Aabb& rhs) noexcept
+	{
+		return {
+			{ std::min(lhs.min.x, rhs.min.x), std::min(lhs.min.y, rhs.min.y), std::min(lhs.min.z, rhs.min.z) },
+			{ std::max(lhs.max.x, rhs.max.x), std::max(lhs.max.y, rhs.max.y), std::max(lhs.max.z, rhs.max.z) }
+		};
+	}
+
+	[[nodiscard]] inline Aabb expand(const Aabb& bounds, const Float margin) noexcept
+	{
+		return {
+			{ bounds.min.x - margin, bounds.min.y - margin, bounds.min.z - margin },
+			{ bounds.max.x + margin, bounds.max.y + margin, bounds.max.z + margin }
+		};
+	}
+
+	[[nodiscard]] inline Aabb make_aabb(const Sphere& sphere) noexcept
+	{
+		return expand({ sphere.center, sphere.center }, sphere.radius);
+	}
+
+	[[nodiscard]] inline Vector3 get_center(const Aabb& bounds) noexcept
+	{
+		return { (bounds.min.x + bounds.max.x) * 0.5f, (bounds.min.y + bounds.max.y) * 0.5f, (bounds.min.z + bounds.max.z) * 0.5f };
+	}
+
+	[[nodiscard]] inline Float get_surface_area(const Aabb& bounds) noexcept
+	{
+		const auto x = bounds.max.x - bounds.min.x;
+		const auto y = bounds.max.y - bounds.min.y;
+		const auto z = bounds.max.z - bounds.min.z;
+		return 2.0f * (x * y + y * z + z * x);
+	}
+
+	[[nodiscard]] inline bool contains(const Aabb& outer, const Aabb& inner) noexcept
+	{
+		return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z &&
+			outer.max.x >= inner.max.x && outer.max.y >= inner.max.y && outer.max.z >= inner.max.z;
+	}
+
+	[[nodiscard]] inline bool intersects(const Aabb& lhs, const Aabb& rhs) noexcept
+	{
+		return lhs.min.x <= rhs.max.x && lhs.max.x >= rhs.min.x &&
+			lhs.min.y <= rhs.max.y && lhs.max.y >= rhs.min.y &&
+			lhs.min.z <= rhs.max.z && lhs.max.z >= rhs.min.z;
+	}
+
+	[[nodiscard]] inline Float get_distance_squared(const Aabb& bounds, const Vector3& point) noexcept
+	{
+		const auto dx = std::max({ bounds.min.x - point.x, 0.0f, point.x - bounds.max.x });
+		const auto dy = std::max({ bounds.min.y - point.y, 0.0f, point.y - bounds.max.y });
+		const auto dz = std::max({ bounds.min.z - point.z, 0.0f, point.z - bounds.max.z });
+		return dx * dx + dy * dy + dz * dz;
+	}
+
+	[[nodiscard]] inline bool intersects(const Aabb& bounds, const Sphere& sphere) noexcept
+	{
+		return get_distance_squared(bounds, sphere.center) <= sphere.radius * sphere.radius;
+	}
+
+	// Slab test. Returns the entry distance along the ray, or a negative value on a miss.
+	[[nodiscard]] inline Float intersect(const Aabb& bounds, const Ray& ray) noexcept
+	{
+		auto near_distance = 0.0f;
+		auto far_distance = ray.max_distance;
+
+		const Float origin[3]{ ray.origin.x, ray.origin.y, ray.origin.z };
+		const Float direction[3]{ ray.direction.x, ray.direction.y, ray.direction.z };
+		const Float minimum[3]{ bounds.min.x, bounds.min.y, bounds.min.z };
+		const Float maximum[3]{ bounds.max.x, bounds.max.y, bounds.max.z };
+
+		for (auto axis = 0; axis < 3; ++axis)
+		{
+			const auto inverse = 1.0f / direction[axis];
+			auto entry = (minimum[axis] - origin[axis]) * inverse;
+			auto exit = (maximum[axis] - origin[axis]) * inverse;
+			if (entry > exit)
+			{
+				std::swap(entry, exit);
+			}
+
+			// Rays parallel to a slab produce NaNs here, which the comparisons below ignore
+			near_distance = entry > near_distance ? entry : near_distance;
+			far_distance = exit < far_distance ? exit : far_distance;
+			if (near_distance > far_distance)
+			{
+				return -1.0f;
+			}
+		}
+		return near_distance;
+	}
+
+	// Arvo's method: the transformed box of a local box under an affine row-vector matrix
+	[[nodiscard]] inline Aabb transform(const Aabb& bounds, const Matrix4x4& matrix) noexcept
+	{
+		const auto center = get_center(bounds);
+		const Vector3 extents{ bounds.max.x - center.x, bounds.max.y - center.y, bounds.max.z - center.z };
+
+		const Vector3 world_center{
+			center.x * matrix._11 + center.y * matrix._21 + center.z * matrix._31 + matrix._41,
+			center.x * matrix._12 + center.y * matrix._22 + center.z * matrix._32 + matrix._42,
+			center.x * matrix._13 + center.y * matrix._23 + center.z * matrix._33 + matrix._43
+		};
+		const Vector3 world_extents{
+			extents.x * std::abs(matrix._11) + extents.y * std::abs(matrix._21) + extents.z * std::abs(matrix._31),
+			extents.x * std::abs(matrix._12) + extents.y * std::abs(matrix._22) + extents.z * std::abs(matrix._32),
+			extents.x * std::abs(matrix._13) + extents.y * std::abs(matrix._23) + extents.z * std::abs(matrix._33)
+		};
+
+		return {
+			{ world_center.x - world_extents.x, world_center.y - world_extents.y, world_center.z - world_extents.z },
+			{ world_center.x + world_extents.x, world_center.y + world_extents.y, world_center.z + world_extents.z }
+		};
+	}
+}
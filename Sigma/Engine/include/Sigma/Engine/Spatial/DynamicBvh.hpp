@@ -0,0 +1,147 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "Sigma/Engine/DataStructures/SparseSet.hpp"
+#include "Sigma/Engine/Spatial/Bounds.hpp"
+
+namespace sigma
+{
+	// Bounds quantized to 16 bits per axis inside the tree's world bounds, rounded outwards
+	struct QuantizedAabb
+	{
+		std::array<UInt16, 3> min{};
+		std::array<UInt16, 3> max{};
+	};
+
+	struct BvhNode
+	{
+		QuantizedAabb bounds{};
+		UInt32 parent{};
+		std::array<UInt32, 2> children{};
+		Int32 height{};
+		UInt32 entity{};
+	};
+	static_assert(sizeof(BvhNode) == 32);
+
+	// Incrementally updated bounding volume hierarchy. Leaves are inserted next to the sibling with the lowest
+	// surface area cost and every refit on the way back up tries a tree rotation that lowers that cost. Objects that
+	// leave the world bounds cannot be quantized, they move to an unsorted outside list that every query also checks
+	// and return to the tree once they are back inside.
+	class DynamicBvh
+	{
+	public:
+		using size_type = std::size_t;
+
+		static constexpr UInt32 k_null_node = std::numeric_limits<UInt32>::max();
+
+		DynamicBvh(const Aabb& world_bounds, Float margin, size_type capacity);
+
+		void insert(Entity entity, const Aabb& bounds);
+		void update(Entity entity, const Aabb& bounds);
+		void erase(Entity entity);
+
+		[[nodiscard]] size_type size() const noexcept;
+		[[nodiscard]] bool contains(Entity entity) const noexcept;
+		[[nodiscard]] const Aabb& get_bounds(Entity entity) const noexcept;
+		[[nodiscard]] Int32 get_height() const noexcept;
+		[[nodiscard]] Float get_total_surface_area() const noexcept;
+
+		void query(const Aabb& bounds, std::vector<Entity>& result) const;
+		void query(const Sphere& sphere, std::vector<Entity>& result) const;
+		[[nodiscard]] RayHit raycast(const Ray& ray) const;
+		void query_nearest(const Vector3& point, size_type count, std::vector<Entity>& result) const;
+
+		template <typename Visitor>
+		void visit(const Aabb& bounds, Visitor&& visitor) const;
+	private:
+		class TraversalStack
+		{
+		public:
+			void push(UInt32 node);
+			[[nodiscard]] UInt32 pop() noexcept;
+			[[nodiscard]] bool is_empty() const noexcept;
+		private:
+			std::array<UInt32, 64> m_inline{};
+			std::vector<UInt32> m_overflow{};
+			size_type m_size{};
+		};
+
+		[[nodiscard]] QuantizedAabb quantize(const Aabb& bounds) const noexcept;
+		[[nodiscard]] Aabb dequantize(const QuantizedAabb& bounds) const noexcept;
+		[[nodiscard]] Float get_cost(const QuantizedAabb& bounds) const noexcept;
+		[[nodiscard]] static QuantizedAabb merge(const QuantizedAabb& lhs, const QuantizedAabb& rhs) noexcept;
+		[[nodiscard]] static bool overlaps(const QuantizedAabb& lhs, const QuantizedAabb& rhs) noexcept;
+		[[nodiscard]] bool is_leaf(UInt32 node) const noexcept;
+
+		UInt32 allocate_node();
+		void free_node(UInt32 node) noexcept;
+
+		void insert_leaf(UInt32 leaf);
+		void remove_leaf(UInt32 leaf) noexcept;
+		void refit(UInt32 node) noexcept;
+		void rotate(UInt32 node) noexcept;
+
+		void erase_outside(Entity entity) noexcept;
+
+		std::vector<BvhNode> m_nodes{};
+		SparseSet<UInt32> m_leaves{};
+		SparseSet<Aabb> m_bounds{};
+		// Entities whose bounds leave the world bounds, their leaf is k_null_node
+		std::vector<Entity> m_outside{};
+
+		Aabb m_world_bounds{};
+		Vector3 m_scale{};
+		Vector3 m_inverse_scale{};
+		Float m_margin{};
+
+		UInt32 m_root{ k_null_node };
+		UInt32 m_free_list{ k_null_node };
+	};
+
+
+	template <typename Visitor>
+	void DynamicBvh::visit(const Aabb& bounds, Visitor&& visitor) const
+	{
+		for (const auto entity : m_outside)
+		{
+			const auto& outside_bounds = m_bounds[entity];
+			if (intersects(outside_bounds, bounds))
+			{
+				visitor(entity, outside_bounds);
+			}
+		}
+
+		if (m_root == k_null_node)
+		{
+			return;
+		}
+
+		const auto query_bounds = quantize(bounds);
+		TraversalStack stack{};
+		stack.push(m_root);
+
+		while (!stack.is_empty())
+		{
+			const auto& node = m_nodes[stack.pop()];
+			if (!overlaps(node.bounds, query_bounds))
+			{
+				continue;
+			}
+
+			if (node.children[0] == k_null_node)
+			{
+				const auto& leaf_bounds = m_bounds[node.entity];
+				if (intersects(leaf_bounds, bounds))
+				{
+					visitor(static_cast<Entity>(node.entity), leaf_bounds);
+				}
+				continue;
+			}
+
+			stack.push(node.children[0]);
+			stack.push(node.children[1]);
+		}
+	}
+}
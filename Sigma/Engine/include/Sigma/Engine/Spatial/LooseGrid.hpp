@@ -0,0 +1,161 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "Sigma/Engine/DataStructures/SparseSet.hpp"
+#include "Sigma/Engine/Spatial/Bounds.hpp"
+
+namespace sigma
+{
+	// Objects are binned by their center. A cell's loose bounds reach half a cell into its neighbours, so any object
+	// no larger than one cell fits in exactly one bucket; bigger objects go to a separate oversized bucket.
+	class LooseGrid
+	{
+	public:
+		using size_type = std::size_t;
+
+		LooseGrid(Float cell_size, size_type capacity);
+
+		void insert(Entity entity, const Aabb& bounds);
+		void update(Entity entity, const Aabb& bounds);
+		void erase(Entity entity);
+
+		[[nodiscard]] size_type size() const noexcept;
+		[[nodiscard]] bool contains(Entity entity) const noexcept;
+		[[nodiscard]] const Aabb& get_bounds(Entity entity) const noexcept;
+		[[nodiscard]] Float get_cell_size() const noexcept;
+		// Cells holding at least one object, the oversized bucket is not counted
+		[[nodiscard]] size_type get_cell_count() const noexcept;
+
+		void query(const Aabb& bounds, std::vector<Entity>& result) const;
+		void query(const Sphere& sphere, std::vector<Entity>& result) const;
+		[[nodiscard]] RayHit raycast(const Ray& ray) const;
+		void query_nearest(const Vector3& point, size_type count, std::vector<Entity>& result) const;
+
+		template <typename Visitor>
+		void visit(const Aabb& bounds, Visitor&& visitor) const;
+	private:
+		struct Cell
+		{
+			std::vector<Entity> entities{};
+			std::vector<Aabb> bounds{};
+		};
+
+		struct Entry
+		{
+			UInt64 cell_key{};
+			UInt32 slot{};
+		};
+
+		struct CellCoordinates
+		{
+			Int32 x{};
+			Int32 y{};
+			Int32 z{};
+		};
+
+		static constexpr UInt64 k_oversized_key = std::numeric_limits<UInt64>::max();
+
+		[[nodiscard]] CellCoordinates get_coordinates(const Vector3& point) const noexcept;
+		[[nodiscard]] UInt64 get_cell_key(const Aabb& bounds) const noexcept;
+		[[nodiscard]] static UInt64 pack(const CellCoordinates& coordinates) noexcept;
+		[[nodiscard]] static CellCoordinates unpack(UInt64 key) noexcept;
+
+		void add_to_cell(Entity entity, UInt64 cell_key, const Aabb& bounds);
+		void remove_from_cell(const Entry& entry) noexcept;
+		void remove_from_cell(Cell& cell, UInt32 slot) noexcept;
+
+		template <typename CellVisitor>
+		void visit_cells(const CellCoordinates& first, const CellCoordinates& last, CellVisitor&& visitor) const;
+
+		std::unordered_map<UInt64, Cell> m_cells{};
+		SparseSet<Entry> m_entries{};
+		Cell m_oversized{};
+
+		CellCoordinates m_occupied_min{ std::numeric_limits<Int32>::max(), std::numeric_limits<Int32>::max(), std::numeric_limits<Int32>::max() };
+		CellCoordinates m_occupied_max{ std::numeric_limits<Int32>::min(), std::numeric_limits<Int32>::min(), std::numeric_limits<Int32>::min() };
+
+		Float m_cell_size{};
+		Float m_inverse_cell_size{};
+	};
+
+
+	template <typename Visitor>
+	void LooseGrid::visit(const Aabb& bounds, Visitor&& visitor) const
+	{
+		const auto& oversized = m_oversized;
+		for (size_type slot = 0; slot < oversized.entities.size(); ++slot)
+		{
+			if (intersects(oversized.bounds[slot], bounds))
+			{
+				visitor(oversized.entities[slot], oversized.bounds[slot]);
+			}
+		}
+
+		const auto loose_bounds = expand(bounds, m_cell_size * 0.5f);
+		visit_cells(get_coordinates(loose_bounds.min), get_coordinates(loose_bounds.max), [&](const Cell& cell)
+		{
+			for (size_type slot = 0; slot < cell.entities.size(); ++slot)
+			{
+				if (intersects(cell.bounds[slot], bounds))
+				{
+					visitor(cell.entities[slot], cell.bounds[slot]);
+				}
+			}
+		});
+	}
+
+	template <typename CellVisitor>
+	void LooseGrid::visit_cells(const CellCoordinates& first, const CellCoordinates& last, CellVisitor&& visitor) const
+	{
+		if (m_cells.empty())
+		{
+			return;
+		}
+
+		const CellCoordinates begin{
+			std::max(first.x, m_occupied_min.x), std::max(first.y, m_occupied_min.y), std::max(first.z, m_occupied_min.z)
+		};
+		const CellCoordinates end{
+			std::min(last.x, m_occupied_max.x), std::min(last.y, m_occupied_max.y), std::min(last.z, m_occupied_max.z)
+		};
+
+		if (begin.x > end.x || begin.y > end.y || begin.z > end.z)
+		{
+			return;
+		}
+
+		// Huge query boxes over a sparse grid are cheaper to answer by walking the occupied cells
+		const auto range_volume = static_cast<double>(end.x - begin.x + 1) * static_cast<double>(end.y - begin.y + 1) *
+			static_cast<double>(end.z - begin.z + 1);
+		if (range_volume > static_cast<double>(m_cells.size()))
+		{
+			for (const auto& [key, cell] : m_cells)
+			{
+				const auto coordinates = unpack(key);
+				if (coordinates.x >= begin.x && coordinates.x <= end.x && coordinates.y >= begin.y &&
+					coordinates.y <= end.y && coordinates.z >= begin.z && coordinates.z <= end.z)
+				{
+					visitor(cell);
+				}
+			}
+			return;
+		}
+
+		for (auto x = begin.x; x <= end.x; ++x)
+		{
+			for (auto y = begin.y; y <= end.y; ++y)
+			{
+				for (auto z = begin.z; z <= end.z; ++z)
+				{
+					const auto cell = m_cells.find(pack({ x, y, z }));
+					if (cell != m_cells.end())
+					{
+						visitor(cell->second);
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,209 @@
+#pragma once
+
+#include <concepts>
+#include <span>
+#include <vector>
+
+#include "Sigma/Engine/DataStructures/SparseSet.hpp"
+#include "Sigma/Engine/Jobs/JobSystem.hpp"
+#include "Sigma/Engine/Scene/TransformHierarchy.hpp"
+#include "Sigma/Engine/Spatial/Bounds.hpp"
+
+namespace sigma
+{
+	template <typename Structure>
+	concept SpatialStructure = requires(Structure& structure, const Structure& const_structure, Entity entity,
+		const Aabb& bounds, const Sphere& sphere, const Ray& ray, const Vector3& point, std::vector<Entity>& result)
+	{
+		structure.insert(entity, bounds);
+		structure.update(entity, bounds);
+		structure.erase(entity);
+		{ const_structure.contains(entity) } -> std::same_as<bool>;
+		const_structure.query(bounds, result);
+		const_structure.query(sphere, result);
+		{ const_structure.raycast(ray) } -> std::same_as<RayHit>;
+		const_structure.query_nearest(point, std::size_t{}, result);
+	};
+
+	// Keeps a spatial structure in step with the world matrices of a TransformHierarchy. Only nodes whose world
+	// change tick is newer than the previous synchronization are pushed into the structure.
+	template <SpatialStructure Structure>
+	class SpatialIndex
+	{
+	public:
+		using size_type = std::size_t;
+		using structure_type = Structure;
+
+		static constexpr size_type k_query_grain_size = 64;
+
+		template <typename... Args>
+		explicit SpatialIndex(size_type capacity, Args&&... args);
+
+		void set_local_bounds(Entity entity, const Aabb& bounds);
+		void erase(Entity entity);
+
+		void synchronize(const TransformHierarchy& hierarchy);
+
+		[[nodiscard]] structure_type& get_structure() noexcept;
+		[[nodiscard]] const structure_type& get_structure() const noexcept;
+
+		void query(std::span<const Aabb> queries, std::vector<std::vector<Entity>>& results, JobSystem& job_system) const;
+		void query(std::span<const Sphere> queries, std::vector<std::vector<Entity>>& results, JobSystem& job_system) const;
+		void raycast(std::span<const Ray> rays, std::vector<RayHit>& hits, JobSystem& job_system) const;
+		void query_nearest(std::span<const Vector3> points, size_type count, std::vector<std::vector<Entity>>& results, JobSystem& job_system) const;
+	private:
+		void place(Entity entity, const Matrix4x4& world);
+
+		template <typename Query, typename Result, typename Function>
+		static void run_batch(std::span<const Query> queries, std::vector<Result>& results, JobSystem& job_system, Function&& function);
+
+		structure_type m_structure;
+		SparseSet<Aabb> m_local_bounds{};
+		std::vector<Entity> m_pending{};
+		UInt64 m_synchronized_tick{};
+	};
+
+
+	template <SpatialStructure Structure>
+	template <typename... Args>
+	SpatialIndex<Structure>::SpatialIndex(const size_type capacity, Args&&... args)
+		: m_structure{ std::forward<Args>(args)..., capacity }, m_local_bounds{ capacity }
+	{
+	}
+
+	template <SpatialStructure Structure>
+	void SpatialIndex<Structure>::set_local_bounds(const Entity entity, const Aabb& bounds)
+	{
+		if (m_local_bounds.has_element(entity))
+		{
+			m_local_bounds[entity] = bounds;
+		}
+		else
+		{
+			m_local_bounds.emplace(entity, bounds);
+		}
+		m_pending.push_back(entity);
+	}
+
+	template <SpatialStructure Structure>
+	void SpatialIndex<Structure>::erase(const Entity entity)
+	{
+		m_structure.erase(entity);
+		m_local_bounds.erase(entity);
+		std::erase(m_pending, entity);
+	}
+
+	template <SpatialStructure Structure>
+	void SpatialIndex<Structure>::synchronize(const TransformHierarchy& hierarchy)
+	{
+		// Bounds set before their transform exists wait until the hierarchy has a node for them
+		std::erase_if(m_pending, [&](const Entity entity)
+		{
+			if (!m_local_bounds.has_element(entity))
+			{
+				return true;
+			}
+			if (!hierarchy.has_node(entity))
+			{
+				return false;
+			}
+
+			place(entity, hierarchy.get_world(entity));
+			return true;
+		});
+
+		const auto nodes = hierarchy.get_nodes().data();
+		const auto ticks = hierarchy.get_ticks().data();
+		const auto world = hierarchy.get_world_pool().data();
+		for (size_type slot = 0; slot < hierarchy.size(); ++slot)
+		{
+			const auto entity = nodes[slot].entity;
+			if (ticks[slot].world_changed >= m_synchronized_tick && m_structure.contains(entity))
+			{
+				m_structure.update(entity, transform(m_local_bounds[entity], world[slot]));
+			}
+		}
+
+		m_synchronized_tick = hierarchy.get_tick();
+	}
+
+	template <SpatialStructure Structure>
+	typename SpatialIndex<Structure>::structure_type& SpatialIndex<Structure>::get_structure() noexcept
+	{
+		return m_structure;
+	}
+
+	template <SpatialStructure Structure>
+	const typename SpatialIndex<Structure>::structure_type& SpatialIndex<Structure>::get_structure() const noexcept
+	{
+		return m_structure;
+	}
+
+	template <SpatialStructure Structure>
+	void SpatialIndex<Structure>::query(std::span<const Aabb> queries, std::vector<std::vector<Entity>>& results, JobSystem& job_system) const
+	{
+		run_batch(queries, results, job_system, [this](const Aabb& bounds, std::vector<Entity>& result)
+		{
+			result.clear();
+			m_structure.query(bounds, result);
+		});
+	}
+
+	template <SpatialStructure Structure>
+	void SpatialIndex<Structure>::query(std::span<const Sphere> queries, std::vector<std::vector<Entity>>& results, JobSystem& job_system) const
+	{
+		run_batch(queries, results, job_system, [this](const Sphere& sphere, std::vector<Entity>& result)
+		{
+			result.clear();
+			m_structure.query(sphere, result);
+		});
+	}
+
+	template <SpatialStructure Structure>
+	void SpatialIndex<Structure>::raycast(std::span<const Ray> rays, std::vector<RayHit>& hits, JobSystem& job_system) const
+	{
+		run_batch(rays, hits, job_system, [this](const Ray& ray, RayHit& hit)
+		{
+			hit = m_structure.raycast(ray);
+		});
+	}
+
+	template <SpatialStructure Structure>
+	void SpatialIndex<Structure>::query_nearest(std::span<const Vector3> points, const size_type count, std::vector<std::vector<Entity>>& results, JobSystem& job_system) const
+	{
+		run_batch(points, results, job_system, [this, count](const Vector3& point, std::vector<Entity>& result)
+		{
+			result.clear();
+			m_structure.query_nearest(point, count, result);
+		});
+	}
+
+	template <SpatialStructure Structure>
+	void SpatialIndex<Structure>::place(const Entity entity, const Matrix4x4& world)
+	{
+		const auto bounds = transform(m_local_bounds[entity], world);
+		if (m_structure.contains(entity))
+		{
+			m_structure.update(entity, bounds);
+		}
+		else
+		{
+			m_structure.insert(entity, bounds);
+		}
+	}
+
+	template <SpatialStructure Structure>
+	template <typename Query, typename Result, typename Function>
+	void SpatialIndex<Structure>::run_batch(std::span<const Query> queries, std::vector<Result>& results, JobSystem& job_system, Function&& function)
+	{
+		// Result vectors are reused between batches so steady-state queries do not allocate
+		results.resize(queries.size());
+		job_system.parallel_for(0, queries.size(), k_query_grain_size, [&](const size_type begin, const size_type end)
+		{
+			for (auto query = begin; query < end; ++query)
+			{
+				function(queries[query], results[query]);
+			}
+		});
+	}
+}
@@ -1,18 +1,22 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
 #include <DirectXMath.h>
 
 namespace sigma
 {
-	using Int8 = __int8;
-	using Int16 = __int16;
-	using Int32 = __int32;
-	using Int64 = __int64;
+	using Int8 = std::int8_t;
+	using Int16 = std::int16_t;
+	using Int32 = std::int32_t;
+	using Int64 = std::int64_t;
 
-	using UInt8 = unsigned __int8;
-	using UInt16 = unsigned __int16;
-	using UInt32 = unsigned __int32;
-	using UInt64 = unsigned __int64;
+	using UInt8 = std::uint8_t;
+	using UInt16 = std::uint16_t;
+	using UInt32 = std::uint32_t;
+	using UInt64 = std::uint64_t;
 
 	using Float = float;
 	using Double = double;
@@ -32,4 +36,7 @@ namespace sigma
 	using Matrix4x4 = DirectX::XMFLOAT4X4;
 	using Matrix3x4 = DirectX::XMFLOAT3X4;
 	using Matrix4x3 = DirectX::XMFLOAT4X3;
+
+	using Entity = std::size_t;
+	constexpr Entity k_null_entity = std::numeric_limits<Entity>::max();
 }
\ No newline at end of file
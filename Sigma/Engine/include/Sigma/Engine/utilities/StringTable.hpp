@@ -0,0 +1,34 @@
+#pragma once
+
+#include <atomic>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "Sigma/Engine/utilities/hashed_string.hpp"
+
+namespace sigma
+{
+	// Interns names that are only known at runtime, so they can be hashed once where they enter the engine and be
+	// turned back into text for logs and tools. Any number of threads may intern and look up concurrently. Debug
+	// builds compare every interned name with the one already stored under its hash and count collisions.
+	class StringTable
+	{
+	public:
+		HashedString intern(std::string_view text);
+
+		// Empty for names that were never interned, which includes every literal hashed at compile time
+		[[nodiscard]] std::string_view find(HashedString name) const;
+		[[nodiscard]] bool contains(HashedString name) const;
+
+		[[nodiscard]] std::size_t size() const;
+		// Always zero in release builds, where names are not compared
+		[[nodiscard]] std::size_t get_collision_count() const noexcept;
+	private:
+		mutable std::shared_mutex m_mutex{};
+		// Nodes never move, so views of the stored strings stay valid while the table lives
+		std::unordered_map<HashedString, std::string> m_strings{};
+		std::atomic<std::size_t> m_collision_count{};
+	};
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <string_view>
+
+#include "Sigma/Engine/utilities/tag.hpp"
+
+namespace sigma
+{
+	// 32-bit FNV-1a
+	[[nodiscard]] constexpr UInt32 hash_string(const std::string_view text) noexcept
+	{
+		UInt32 hash = 2166136261u;
+		for (const auto character : text)
+		{
+			hash ^= static_cast<UInt8>(character);
+			hash *= 16777619u;
+		}
+		return hash;
+	}
+
+	// Identifier made from the hash of a name, so comparing and looking up names costs an integer compare. Literals
+	// are hashed at compile time, and the type is structural, so a name can be a template argument as well.
+	struct HashedString
+	{
+		constexpr HashedString() noexcept = default;
+
+		template<std::size_t Size>
+		consteval HashedString(const char (&text)[Size]) noexcept
+			: value{ hash_string({ text, Size - 1 }) }
+		{
+		}
+
+		constexpr explicit HashedString(const std::string_view text) noexcept
+			: value{ hash_string(text) }
+		{
+		}
+
+		[[nodiscard]] constexpr UInt32 get_value() const noexcept
+		{
+			return value;
+		}
+
+		[[nodiscard]] constexpr auto operator<=>(const HashedString&) const noexcept = default;
+
+		// Public, a non-type template argument must not have private members
+		UInt32 value{};
+	};
+
+	template<HashedString Name>
+	using HashedStringTag = Tag<Name.value>;
+
+	namespace literals
+	{
+		[[nodiscard]] consteval HashedString operator""_hs(const char* text, const std::size_t size) noexcept
+		{
+			return HashedString{ std::string_view{ text, size } };
+		}
+	}
+}
+
+template<>
+struct std::hash<sigma::HashedString>
+{
+	[[nodiscard]] std::size_t operator()(const sigma::HashedString name) const noexcept
+	{
+		return name.value;
+	}
+};
\ No newline at end of file
@@ -2,7 +2,7 @@
 
 #include <type_traits>
 
-#include "../Common/types.hpp"
+#include "Sigma/Engine/common/types.hpp"
 
 namespace sigma
 {
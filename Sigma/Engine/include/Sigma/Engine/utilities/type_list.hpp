@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+namespace sigma
+{
+	template<typename... Types>
+	struct TypeList
+	{
+		static constexpr std::size_t size = sizeof...(Types);
+	};
+
+	namespace detail
+	{
+		template<typename T, typename List>
+		struct TypeListIndex;
+
+		template<typename T, typename... Types>
+		struct TypeListIndex<T, TypeList<Types...>>
+		{
+			static constexpr std::size_t find() noexcept
+			{
+				constexpr bool matches[] = { std::is_same_v<T, Types>..., false };
+				std::size_t index = 0;
+				while (index < sizeof...(Types) && !matches[index])
+				{
+					++index;
+				}
+				return index;
+			}
+
+			static constexpr std::size_t value = find();
+		};
+
+		template<std::size_t Index, typename List>
+		struct TypeListElement;
+
+		template<std::size_t Index, typename Head, typename... Tail>
+		struct TypeListElement<Index, TypeList<Head, Tail...>> : TypeListElement<Index - 1, TypeList<Tail...>> {};
+
+		template<typename Head, typename... Tail>
+		struct TypeListElement<0, TypeList<Head, Tail...>>
+		{
+			using type = Head;
+		};
+
+		template<typename... Lists>
+		struct TypeListConcat
+		{
+			using type = TypeList<>;
+		};
+
+		template<typename... Types>
+		struct TypeListConcat<TypeList<Types...>>
+		{
+			using type = TypeList<Types...>;
+		};
+
+		template<typename... First, typename... Second, typename... Rest>
+		struct TypeListConcat<TypeList<First...>, TypeList<Second...>, Rest...> : TypeListConcat<TypeList<First..., Second...>, Rest...> {};
+
+		template<template<typename> class Predicate, typename List>
+		struct TypeListFilter;
+
+		template<template<typename> class Predicate, typename... Types>
+		struct TypeListFilter<Predicate, TypeList<Types...>>
+		{
+			using type = typename TypeListConcat<TypeList<>, std::conditional_t<Predicate<Types>::value, TypeList<Types>, TypeList<>>...>::type;
+		};
+
+		template<typename List, template<typename...> class Target>
+		struct TypeListApply;
+
+		template<typename... Types, template<typename...> class Target>
+		struct TypeListApply<TypeList<Types...>, Target>
+		{
+			using type = Target<Types...>;
+		};
+
+		template<typename List>
+		struct TypeListUnique;
+
+		template<typename... Types>
+		struct TypeListUnique<TypeList<Types...>>
+		{
+			// Every type is unique if each one is found first at its own position
+			static constexpr bool check() noexcept
+			{
+				constexpr std::size_t indices[] = { TypeListIndex<Types, TypeList<Types...>>::value..., 0 };
+				for (std::size_t index = 0; index < sizeof...(Types); ++index)
+				{
+					if (indices[index] != index)
+					{
+						return false;
+					}
+				}
+				return true;
+			}
+
+			static constexpr bool value = check();
+		};
+	}
+
+	// Index of the first occurrence of T, List::size if it is not in the list
+	template<typename T, typename List>
+	inline constexpr std::size_t type_list_index_v = detail::TypeListIndex<T, List>::value;
+
+	template<typename T, typename List>
+	inline constexpr bool type_list_contains_v = type_list_index_v<T, List> < List::size;
+
+	template<typename List>
+	inline constexpr bool type_list_is_unique_v = detail::TypeListUnique<List>::value;
+
+	template<std::size_t Index, typename List>
+	using type_list_element_t = typename detail::TypeListElement<Index, List>::type;
+
+	template<typename... Lists>
+	using type_list_concat_t = typename detail::TypeListConcat<Lists...>::type;
+
+	// Keeps the types for which Predicate<T>::value is true, in order
+	template<template<typename> class Predicate, typename List>
+	using type_list_filter_t = typename detail::TypeListFilter<Predicate, List>::type;
+
+	// TypeList<A, B> applied to Target gives Target<A, B>
+	template<typename List, template<typename...> class Target>
+	using type_list_apply_t = typename detail::TypeListApply<List, Target>::type;
+
+	// Calls function(std::type_identity<T>{}) for every type in order. The calls are unrolled at compile time, so
+	// the body is specialized per type with no branching on a runtime type id.
+	template<typename... Types, typename Function>
+	constexpr void for_each_type(TypeList<Types...>, Function&& function)
+	{
+		(function(std::type_identity<Types>{}), ...);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <string_view>
+
+#include "Sigma/Engine/utilities/hashed_string.hpp"
+#include "Sigma/Engine/utilities/tag.hpp"
+
+namespace sigma
+{
+	// Name of T as spelled by the compiler, extracted from the signature of this function at compile time.
+	// The spelling differs between compilers, so ids derived from it are stable across builds, not across toolchains.
+	template<typename T>
+	[[nodiscard]] constexpr std::string_view type_name() noexcept
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		constexpr std::string_view signature = __FUNCSIG__;
+		constexpr std::string_view prefix = "type_name<";
+		constexpr std::string_view suffix = ">(void)";
+		constexpr auto begin = signature.find(prefix) + prefix.size();
+		constexpr auto end = signature.rfind(suffix);
+#else
+		constexpr std::string_view signature = __PRETTY_FUNCTION__;
+		constexpr std::string_view prefix = "T = ";
+		constexpr auto begin = signature.find(prefix) + prefix.size();
+		constexpr auto end = signature.find_first_of(";]", begin);
+#endif
+		return signature.substr(begin, end - begin);
+	}
+
+	// 32-bit FNV-1a of the type name
+	template<typename T>
+	[[nodiscard]] constexpr UInt32 type_hash() noexcept
+	{
+		return hash_string(type_name<T>());
+	}
+
+	template<typename T>
+	using TypeHashTag = Tag<type_hash<T>()>;
+}
\ No newline at end of file
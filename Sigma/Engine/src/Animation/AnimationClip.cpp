@@ -0,0 +1,159 @@
+#include "Sigma/Engine/Animation/AnimationClip.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace sigma
+{
+	namespace
+	{
+		constexpr auto k_component_range = 0.70710678f;
+		constexpr auto k_component_steps = 32767.0f;
+		constexpr UInt16 k_component_mask = 0x7FFF;
+
+		[[nodiscard]] UInt16 quantize_component(const Float value) noexcept
+		{
+			const auto normalized = std::clamp((value / k_component_range) * 0.5f + 0.5f, 0.0f, 1.0f);
+			return static_cast<UInt16>(std::lround(normalized * k_component_steps));
+		}
+
+		[[nodiscard]] Float dequantize_component(const UInt16 value) noexcept
+		{
+			return (static_cast<Float>(value & k_component_mask) / k_component_steps * 2.0f - 1.0f) * k_component_range;
+		}
+	}
+
+	QuantizedRotation quantize_rotation(const Vector4& rotation) noexcept
+	{
+		const Float components[4]{ rotation.x, rotation.y, rotation.z, rotation.w };
+		std::size_t largest = 0;
+		for (std::size_t component = 1; component < 4; ++component)
+		{
+			if (std::abs(components[component]) > std::abs(components[largest]))
+			{
+				largest = component;
+			}
+		}
+
+		// q and -q are the same rotation, negating makes the dropped component positive
+		const auto sign = components[largest] < 0.0f ? -1.0f : 1.0f;
+		QuantizedRotation result{};
+		std::size_t output = 0;
+		for (std::size_t component = 0; component < 4; ++component)
+		{
+			if (component != largest)
+			{
+				result.components[output++] = quantize_component(components[component] * sign);
+			}
+		}
+		result.components[0] = static_cast<UInt16>(result.components[0] | ((largest & 1) << 15));
+		result.components[1] = static_cast<UInt16>(result.components[1] | ((largest >> 1) << 15));
+		return result;
+	}
+
+	Vector4 dequantize_rotation(const QuantizedRotation& rotation) noexcept
+	{
+		const auto largest = static_cast<std::size_t>((rotation.components[0] >> 15) | ((rotation.components[1] >> 15) << 1));
+		Float components[4]{};
+		Float sum{};
+		std::size_t input = 0;
+		for (std::size_t component = 0; component < 4; ++component)
+		{
+			if (component != largest)
+			{
+				components[component] = dequantize_component(rotation.components[input++]);
+				sum += components[component] * components[component];
+			}
+		}
+		components[largest] = std::sqrt(std::max(0.0f, 1.0f - sum));
+		return { components[0], components[1], components[2], components[3] };
+	}
+
+	AnimationClip::AnimationClip(const size_type bone_count, const Float sample_rate, std::span<const BoneTransform> frames)
+		: m_bone_count{ bone_count }, m_frame_count{ bone_count == 0 ? 0 : frames.size() / bone_count }, m_sample_rate{ sample_rate }
+	{
+		assert(bone_count == 0 || frames.size() % bone_count == 0);
+		assert(sample_rate > 0.0f);
+
+		m_rotations.reserve(frames.size());
+		m_translations.reserve(frames.size());
+		m_scales.reserve(frames.size());
+		for (const auto& transform : frames)
+		{
+			m_rotations.push_back(quantize_rotation(transform.rotation));
+			m_translations.push_back(transform.translation);
+			m_scales.push_back(transform.scale);
+		}
+	}
+
+	AnimationClip::size_type AnimationClip::get_bone_count() const noexcept
+	{
+		return m_bone_count;
+	}
+
+	AnimationClip::size_type AnimationClip::get_frame_count() const noexcept
+	{
+		return m_frame_count;
+	}
+
+	Float AnimationClip::get_duration() const noexcept
+	{
+		return static_cast<Float>(m_frame_count) / m_sample_rate;
+	}
+
+	void AnimationClip::sample(const Float time, Pose& result, Pose& scratch) const
+	{
+		if (m_frame_count == 0)
+		{
+			result.resize(m_bone_count);
+			return;
+		}
+
+		// The last frame blends back into the first, so a looping clip has no seam
+		const auto position = std::fmod(std::fmod(time, get_duration()) + get_duration(), get_duration()) * m_sample_rate;
+		const auto frame = std::min(static_cast<size_type>(position), m_frame_count - 1);
+		const auto weight = position - static_cast<Float>(frame);
+
+		decode_frame(frame, result);
+		decode_frame((frame + 1) % m_frame_count, scratch);
+		Pose::blend(result, scratch, weight, result);
+	}
+
+	void AnimationClip::decode_frame(const size_type frame, Pose& result) const
+	{
+		assert(frame < m_frame_count);
+		result.resize(m_bone_count);
+
+		auto* rotation_x = result.get_stream(Pose::rotation_x);
+		auto* rotation_y = result.get_stream(Pose::rotation_y);
+		auto* rotation_z = result.get_stream(Pose::rotation_z);
+		auto* rotation_w = result.get_stream(Pose::rotation_w);
+		auto* translation_x = result.get_stream(Pose::translation_x);
+		auto* translation_y = result.get_stream(Pose::translation_y);
+		auto* translation_z = result.get_stream(Pose::translation_z);
+		auto* scale_x = result.get_stream(Pose::scale_x);
+		auto* scale_y = result.get_stream(Pose::scale_y);
+		auto* scale_z = result.get_stream(Pose::scale_z);
+
+		const auto first = frame * m_bone_count;
+		for (size_type bone = 0; bone < m_bone_count; ++bone)
+		{
+			const auto rotation = dequantize_rotation(m_rotations[first + bone]);
+			rotation_x[bone] = rotation.x;
+			rotation_y[bone] = rotation.y;
+			rotation_z[bone] = rotation.z;
+			rotation_w[bone] = rotation.w;
+
+			const auto& translation = m_translations[first + bone];
+			translation_x[bone] = translation.x;
+			translation_y[bone] = translation.y;
+			translation_z[bone] = translation.z;
+
+			const auto& scale = m_scales[first + bone];
+			scale_x[bone] = scale.x;
+			scale_y[bone] = scale.y;
+			scale_z[bone] = scale.z;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+#include "Sigma/Engine/Animation/CharacterAnimator.hpp"
+
+#include <cassert>
+
+namespace sigma
+{
+	CharacterAnimator::size_type CharacterAnimator::add(const CharacterAnimation& animation)
+	{
+		assert(animation.skeleton != nullptr && animation.clip != nullptr);
+		assert(animation.clip->get_bone_count() == animation.skeleton->get_bone_count());
+
+		m_animations.push_back(animation);
+		m_palette_offsets.push_back(m_palette_offsets.back() + animation.skeleton->get_bone_count());
+		m_vertex_offsets.push_back(m_vertex_offsets.back() + animation.mesh.size());
+		m_palettes.resize(m_palette_offsets.back());
+		m_positions.resize(m_vertex_offsets.back());
+		m_normals.resize(m_vertex_offsets.back());
+		return m_animations.size() - 1;
+	}
+
+	CharacterAnimator::size_type CharacterAnimator::size() const noexcept
+	{
+		return m_animations.size();
+	}
+
+	CharacterAnimation& CharacterAnimator::get_animation(const size_type character) noexcept
+	{
+		return m_animations[character];
+	}
+
+	void CharacterAnimator::update(JobSystem& job_system)
+	{
+		job_system.parallel_for(0, m_animations.size(), k_update_grain_size, [&](const size_type begin, const size_type end)
+		{
+			Scratch scratch{};
+			for (auto character = begin; character < end; ++character)
+			{
+				update_character(character, scratch);
+			}
+		});
+	}
+
+	std::span<const Matrix3x4> CharacterAnimator::get_palette(const size_type character) const noexcept
+	{
+		const auto begin = m_palette_offsets[character];
+		return std::span{ m_palettes }.subspan(begin, m_palette_offsets[character + 1] - begin);
+	}
+
+	std::span<const Vector3> CharacterAnimator::get_skinned_positions(const size_type character) const noexcept
+	{
+		const auto begin = m_vertex_offsets[character];
+		return std::span{ m_positions }.subspan(begin, m_vertex_offsets[character + 1] - begin);
+	}
+
+	std::span<const Vector3> CharacterAnimator::get_skinned_normals(const size_type character) const noexcept
+	{
+		const auto begin = m_vertex_offsets[character];
+		return std::span{ m_normals }.subspan(begin, m_vertex_offsets[character + 1] - begin);
+	}
+
+	void CharacterAnimator::update_character(const size_type character, Scratch& scratch)
+	{
+		const auto& animation = m_animations[character];
+		animation.clip->sample(animation.time, scratch.pose, scratch.sample_pose);
+		if (animation.blend_clip != nullptr && animation.blend_weight > 0.0f)
+		{
+			animation.blend_clip->sample(animation.blend_time, scratch.blend_pose, scratch.sample_pose);
+			Pose::blend(scratch.pose, scratch.blend_pose, animation.blend_weight, scratch.pose);
+		}
+
+		const auto bone_count = animation.skeleton->get_bone_count();
+		scratch.model.resize(bone_count);
+		const auto palette = std::span{ m_palettes }.subspan(m_palette_offsets[character], bone_count);
+		animation.skeleton->build_palette(scratch.pose, scratch.model, palette);
+
+		if (!animation.mesh.empty())
+		{
+			const auto first = m_vertex_offsets[character];
+			skin_vertices(animation.mesh, palette, std::span{ m_positions }.subspan(first, animation.mesh.size()),
+				std::span{ m_normals }.subspan(first, animation.mesh.size()));
+		}
+	}
+}
\ No newline at end of file
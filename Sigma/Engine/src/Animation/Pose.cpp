@@ -0,0 +1,161 @@
+#include "Sigma/Engine/Animation/Pose.hpp"
+
+#include <cassert>
+#include <cmath>
+
+#if defined(_XM_SSE_INTRINSICS_)
+#include <immintrin.h>
+#endif
+
+namespace sigma
+{
+	namespace
+	{
+		void blend_rotations(const Pose& from, const Pose& to, const Float weight, Pose& result, std::size_t bone, const std::size_t end) noexcept
+		{
+			const auto* from_x = from.get_stream(Pose::rotation_x);
+			const auto* from_y = from.get_stream(Pose::rotation_y);
+			const auto* from_z = from.get_stream(Pose::rotation_z);
+			const auto* from_w = from.get_stream(Pose::rotation_w);
+			const auto* to_x = to.get_stream(Pose::rotation_x);
+			const auto* to_y = to.get_stream(Pose::rotation_y);
+			const auto* to_z = to.get_stream(Pose::rotation_z);
+			const auto* to_w = to.get_stream(Pose::rotation_w);
+			auto* result_x = result.get_stream(Pose::rotation_x);
+			auto* result_y = result.get_stream(Pose::rotation_y);
+			auto* result_z = result.get_stream(Pose::rotation_z);
+			auto* result_w = result.get_stream(Pose::rotation_w);
+
+#if defined(_XM_SSE_INTRINSICS_)
+			const auto weights = _mm_set1_ps(weight);
+			const auto sign_bit = _mm_set1_ps(-0.0f);
+			for (; bone + 4 <= end; bone += 4)
+			{
+				const auto ax = _mm_loadu_ps(from_x + bone);
+				const auto ay = _mm_loadu_ps(from_y + bone);
+				const auto az = _mm_loadu_ps(from_z + bone);
+				const auto aw = _mm_loadu_ps(from_w + bone);
+				auto bx = _mm_loadu_ps(to_x + bone);
+				auto by = _mm_loadu_ps(to_y + bone);
+				auto bz = _mm_loadu_ps(to_z + bone);
+				auto bw = _mm_loadu_ps(to_w + bone);
+
+				// Flipping the target of lanes with a negative dot product takes the shorter arc
+				const auto dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_add_ps(_mm_mul_ps(az, bz), _mm_mul_ps(aw, bw)));
+				const auto flip = _mm_and_ps(dot, sign_bit);
+				bx = _mm_xor_ps(bx, flip);
+				by = _mm_xor_ps(by, flip);
+				bz = _mm_xor_ps(bz, flip);
+				bw = _mm_xor_ps(bw, flip);
+
+				const auto x = _mm_add_ps(ax, _mm_mul_ps(_mm_sub_ps(bx, ax), weights));
+				const auto y = _mm_add_ps(ay, _mm_mul_ps(_mm_sub_ps(by, ay), weights));
+				const auto z = _mm_add_ps(az, _mm_mul_ps(_mm_sub_ps(bz, az), weights));
+				const auto w = _mm_add_ps(aw, _mm_mul_ps(_mm_sub_ps(bw, aw), weights));
+				const auto length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_add_ps(_mm_mul_ps(z, z), _mm_mul_ps(w, w))));
+				_mm_storeu_ps(result_x + bone, _mm_div_ps(x, length));
+				_mm_storeu_ps(result_y + bone, _mm_div_ps(y, length));
+				_mm_storeu_ps(result_z + bone, _mm_div_ps(z, length));
+				_mm_storeu_ps(result_w + bone, _mm_div_ps(w, length));
+			}
+#endif
+
+			for (; bone < end; ++bone)
+			{
+				const auto dot = from_x[bone] * to_x[bone] + from_y[bone] * to_y[bone] + from_z[bone] * to_z[bone] + from_w[bone] * to_w[bone];
+				const auto sign = dot < 0.0f ? -1.0f : 1.0f;
+				const auto x = from_x[bone] + (to_x[bone] * sign - from_x[bone]) * weight;
+				const auto y = from_y[bone] + (to_y[bone] * sign - from_y[bone]) * weight;
+				const auto z = from_z[bone] + (to_z[bone] * sign - from_z[bone]) * weight;
+				const auto w = from_w[bone] + (to_w[bone] * sign - from_w[bone]) * weight;
+				const auto length = std::sqrt(x * x + y * y + z * z + w * w);
+				result_x[bone] = x / length;
+				result_y[bone] = y / length;
+				result_z[bone] = z / length;
+				result_w[bone] = w / length;
+			}
+		}
+
+		void lerp_stream(const Float* from, const Float* to, const Float weight, Float* result, std::size_t bone, const std::size_t end) noexcept
+		{
+#if defined(_XM_SSE_INTRINSICS_)
+			const auto weights = _mm_set1_ps(weight);
+			for (; bone + 4 <= end; bone += 4)
+			{
+				const auto a = _mm_loadu_ps(from + bone);
+				_mm_storeu_ps(result + bone, _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(to + bone), a), weights)));
+			}
+#endif
+
+			for (; bone < end; ++bone)
+			{
+				result[bone] = from[bone] + (to[bone] - from[bone]) * weight;
+			}
+		}
+	}
+
+	Pose::Pose(const size_type bone_count)
+	{
+		resize(bone_count);
+	}
+
+	void Pose::resize(const size_type bone_count)
+	{
+		for (size_type stream = 0; stream < stream_count; ++stream)
+		{
+			const auto identity = stream == rotation_w || stream >= scale_x ? 1.0f : 0.0f;
+			m_streams[stream].resize(bone_count, identity);
+		}
+	}
+
+	Pose::size_type Pose::size() const noexcept
+	{
+		return m_streams[0].size();
+	}
+
+	void Pose::set_bone(const size_type bone, const BoneTransform& transform) noexcept
+	{
+		m_streams[rotation_x][bone] = transform.rotation.x;
+		m_streams[rotation_y][bone] = transform.rotation.y;
+		m_streams[rotation_z][bone] = transform.rotation.z;
+		m_streams[rotation_w][bone] = transform.rotation.w;
+		m_streams[translation_x][bone] = transform.translation.x;
+		m_streams[translation_y][bone] = transform.translation.y;
+		m_streams[translation_z][bone] = transform.translation.z;
+		m_streams[scale_x][bone] = transform.scale.x;
+		m_streams[scale_y][bone] = transform.scale.y;
+		m_streams[scale_z][bone] = transform.scale.z;
+	}
+
+	BoneTransform Pose::get_bone(const size_type bone) const noexcept
+	{
+		return {
+			{ m_streams[rotation_x][bone], m_streams[rotation_y][bone], m_streams[rotation_z][bone], m_streams[rotation_w][bone] },
+			{ m_streams[translation_x][bone], m_streams[translation_y][bone], m_streams[translation_z][bone] },
+			{ m_streams[scale_x][bone], m_streams[scale_y][bone], m_streams[scale_z][bone] }
+		};
+	}
+
+	Float* Pose::get_stream(const Stream stream) noexcept
+	{
+		return m_streams[stream].data();
+	}
+
+	const Float* Pose::get_stream(const Stream stream) const noexcept
+	{
+		return m_streams[stream].data();
+	}
+
+	void Pose::blend(const Pose& from, const Pose& to, const Float weight, Pose& result)
+	{
+		assert(from.size() == to.size());
+		const auto bone_count = from.size();
+		result.resize(bone_count);
+
+		blend_rotations(from, to, weight, result, 0, bone_count);
+		for (auto stream = translation_x; stream < stream_count; stream = static_cast<Stream>(stream + 1))
+		{
+			lerp_stream(from.get_stream(stream), to.get_stream(stream), weight, result.get_stream(stream), 0, bone_count);
+		}
+	}
+}
\ No newline at end of file
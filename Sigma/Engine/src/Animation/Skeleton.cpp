@@ -0,0 +1,87 @@
+#include "Sigma/Engine/Animation/Skeleton.hpp"
+
+#include <cassert>
+#include <utility>
+
+namespace sigma
+{
+	Skeleton::Skeleton(std::vector<Int32> parents, std::vector<Matrix4x4> inverse_bind)
+		: m_parents{ std::move(parents) }, m_inverse_bind{ std::move(inverse_bind) }
+	{
+		assert(m_parents.size() == m_inverse_bind.size());
+		for (size_type bone = 0; bone < m_parents.size(); ++bone)
+		{
+			assert(m_parents[bone] < static_cast<Int32>(bone));
+		}
+	}
+
+	Skeleton::size_type Skeleton::get_bone_count() const noexcept
+	{
+		return m_parents.size();
+	}
+
+	Int32 Skeleton::get_parent(const size_type bone) const noexcept
+	{
+		return m_parents[bone];
+	}
+
+	void Skeleton::build_palette(const Pose& pose, std::span<Matrix4x4> model, std::span<Matrix3x4> palette) const noexcept
+	{
+		assert(pose.size() == get_bone_count());
+		assert(model.size() >= get_bone_count() && palette.size() >= get_bone_count());
+
+		for (size_type bone = 0; bone < m_parents.size(); ++bone)
+		{
+			const auto transform = pose.get_bone(bone);
+			auto local = DirectX::XMMatrixAffineTransformation(DirectX::XMLoadFloat3(&transform.scale), DirectX::XMVectorZero(),
+				DirectX::XMLoadFloat4(&transform.rotation), DirectX::XMLoadFloat3(&transform.translation));
+
+			if (m_parents[bone] != k_no_parent)
+			{
+				const auto parent = DirectX::XMLoadFloat4x4(&model[static_cast<size_type>(m_parents[bone])]);
+				local = DirectX::XMMatrixMultiply(local, parent);
+			}
+			DirectX::XMStoreFloat4x4(&model[bone], local);
+
+			const auto inverse_bind = DirectX::XMLoadFloat4x4(&m_inverse_bind[bone]);
+			DirectX::XMStoreFloat3x4(&palette[bone], DirectX::XMMatrixMultiply(inverse_bind, local));
+		}
+	}
+
+	void skin_vertices(std::span<const SkinnedVertex> vertices, std::span<const Matrix3x4> palette, std::span<Vector3> positions, std::span<Vector3> normals) noexcept
+	{
+		assert(positions.size() >= vertices.size() && normals.size() >= vertices.size());
+
+		for (std::size_t vertex = 0; vertex < vertices.size(); ++vertex)
+		{
+			const auto& source = vertices[vertex];
+
+			// Blending the matrices first costs one transform per vertex instead of one per influence
+			Float blended[3][4]{};
+			for (std::size_t influence = 0; influence < 4; ++influence)
+			{
+				const auto weight = source.weights[influence];
+				const auto& matrix = palette[source.bones[influence]];
+				for (std::size_t row = 0; row < 3; ++row)
+				{
+					for (std::size_t column = 0; column < 4; ++column)
+					{
+						blended[row][column] += matrix.m[row][column] * weight;
+					}
+				}
+			}
+
+			const auto& position = source.position;
+			const auto& normal = source.normal;
+			Float skinned_position[3]{};
+			Float skinned_normal[3]{};
+			for (std::size_t row = 0; row < 3; ++row)
+			{
+				skinned_position[row] = blended[row][0] * position.x + blended[row][1] * position.y + blended[row][2] * position.z + blended[row][3];
+				skinned_normal[row] = blended[row][0] * normal.x + blended[row][1] * normal.y + blended[row][2] * normal.z;
+			}
+			positions[vertex] = { skinned_position[0], skinned_position[1], skinned_position[2] };
+			normals[vertex] = { skinned_normal[0], skinned_normal[1], skinned_normal[2] };
+		}
+	}
+}
\ No newline at end of file
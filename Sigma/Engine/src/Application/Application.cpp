@@ -1,6 +1,139 @@
-#include <iostream>
+#include "Sigma/Engine/Application/Application.hpp"
 
-void foo()
+#include <algorithm>
+#include <cassert>
+
+namespace sigma
 {
-	
+	Application::Application(const ApplicationSettings& settings)
+		: m_settings{ settings }
+	{
+		assert(m_settings.fixed_timestep > 0.0);
+		assert(m_settings.max_steps_per_frame > 0);
+	}
+
+	void Application::run()
+	{
+		m_exit_requested.store(false, std::memory_order_relaxed);
+		on_start();
+		if (m_settings.uncapped)
+		{
+			run_uncapped();
+		}
+		else
+		{
+			run_capped();
+		}
+		on_stop();
+	}
+
+	void Application::request_exit() noexcept
+	{
+		m_exit_requested.store(true, std::memory_order_relaxed);
+	}
+
+	const ApplicationSettings& Application::get_settings() const noexcept
+	{
+		return m_settings;
+	}
+
+	UInt64 Application::get_frame_count() const noexcept
+	{
+		return m_frame_count;
+	}
+
+	UInt64 Application::get_step_count() const noexcept
+	{
+		return m_step_count;
+	}
+
+	UInt64 Application::get_dropped_step_count() const noexcept
+	{
+		return m_dropped_step_count;
+	}
+
+	Double Application::get_simulation_time() const noexcept
+	{
+		return static_cast<Double>(m_step_count) * m_settings.fixed_timestep;
+	}
+
+	void Application::run_capped()
+	{
+		using seconds = std::chrono::duration<Double>;
+
+		const auto timestep = m_settings.fixed_timestep;
+		const auto frame_period = m_settings.headless ? timestep
+			: (m_settings.target_frame_rate > 0.0 ? 1.0 / m_settings.target_frame_rate : 0.0);
+
+		Double accumulator = 0.0;
+		auto previous = get_time();
+		while (!m_exit_requested.load(std::memory_order_relaxed))
+		{
+			const auto frame_start = get_time();
+			// Clamping the frame time keeps a long stall from queueing more steps than the simulation can ever catch up on
+			accumulator += std::min(seconds{ frame_start - previous }.count(), m_settings.max_frame_time);
+			previous = frame_start;
+
+			UInt32 steps = 0;
+			while (accumulator >= timestep && steps < m_settings.max_steps_per_frame && !m_exit_requested.load(std::memory_order_relaxed))
+			{
+				simulate();
+				accumulator -= timestep;
+				++steps;
+			}
+			// A step that asked to exit ends the frame, the leftover time is no longer a fraction of one step
+			if (m_exit_requested.load(std::memory_order_relaxed))
+			{
+				break;
+			}
+			if (steps == m_settings.max_steps_per_frame && accumulator >= timestep)
+			{
+				const auto dropped = static_cast<UInt64>(accumulator / timestep);
+				m_dropped_step_count += dropped;
+				accumulator -= static_cast<Double>(dropped) * timestep;
+			}
+
+			if (!m_settings.headless)
+			{
+				on_render(accumulator / timestep);
+			}
+			++m_frame_count;
+
+			if (frame_period > 0.0)
+			{
+				// Headless loops wake up for the next step instead of a fixed frame period
+				const auto wait = m_settings.headless ? timestep - accumulator : frame_period;
+				wait_until(frame_start + std::chrono::duration_cast<clock::duration>(seconds{ wait }));
+			}
+		}
+	}
+
+	Application::clock::time_point Application::get_time() const
+	{
+		return clock::now();
+	}
+
+	void Application::wait_until(const clock::time_point deadline)
+	{
+		m_pacer.wait_until(deadline);
+	}
+
+	void Application::run_uncapped()
+	{
+		while (!m_exit_requested.load(std::memory_order_relaxed))
+		{
+			simulate();
+			if (!m_settings.headless)
+			{
+				on_render(1.0);
+			}
+			++m_frame_count;
+		}
+	}
+
+	void Application::simulate()
+	{
+		on_simulate(m_settings.fixed_timestep);
+		++m_step_count;
+	}
 }
\ No newline at end of file
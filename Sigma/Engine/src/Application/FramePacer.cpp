@@ -0,0 +1,38 @@
+#include "Sigma/Engine/Application/FramePacer.hpp"
+
+#include <cmath>
+#include <thread>
+
+namespace sigma
+{
+	void FramePacer::wait_until(const clock::time_point deadline)
+	{
+		using seconds = std::chrono::duration<Double>;
+
+		auto remaining = seconds{ deadline - clock::now() }.count();
+		while (remaining > m_estimate)
+		{
+			const auto start = clock::now();
+			std::this_thread::sleep_for(k_sleep_slice);
+			const auto observed = seconds{ clock::now() - start }.count();
+			remaining -= observed;
+
+			// Welford's online variance
+			++m_count;
+			const auto delta = observed - m_mean;
+			m_mean += delta / static_cast<Double>(m_count);
+			m_m2 += delta * (observed - m_mean);
+			m_estimate = m_mean + std::sqrt(m_m2 / static_cast<Double>(m_count - 1));
+		}
+
+		while (clock::now() < deadline)
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	Double FramePacer::get_sleep_estimate() const noexcept
+	{
+		return m_estimate;
+	}
+}
\ No newline at end of file
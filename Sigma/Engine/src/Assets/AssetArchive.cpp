@@ -0,0 +1,240 @@
+#include "Sigma/Engine/Assets/AssetArchive.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+
+namespace sigma
+{
+	static_assert(std::endian::native == std::endian::little, "Archives are stored little endian");
+	static_assert(sizeof(ArchiveHeader) == 24);
+	static_assert(sizeof(ArchiveEntry) == 40);
+
+	namespace
+	{
+		[[nodiscard]] constexpr UInt64 align_up(const UInt64 value, const UInt64 alignment) noexcept
+		{
+			return (value + alignment - 1) / alignment * alignment;
+		}
+
+		[[nodiscard]] bool is_valid_entry(const ArchiveEntry& entry, const UInt64 data_begin, const UInt64 file_size, const UInt64 alignment) noexcept
+		{
+			const auto in_bounds = entry.offset >= data_begin && entry.offset <= file_size && entry.stored_size <= file_size - entry.offset;
+			const auto stored_as_is = entry.compression != Compression::none || entry.stored_size == entry.size;
+			return in_bounds && stored_as_is && entry.offset % alignment == 0;
+		}
+	}
+
+	AssetData AssetData::make_view(const std::span<const std::byte> bytes) noexcept
+	{
+		AssetData data{};
+		data.m_bytes = bytes;
+		return data;
+	}
+
+	AssetData AssetData::make_owned(std::unique_ptr<std::byte[]> buffer, const std::size_t size) noexcept
+	{
+		AssetData data{};
+		data.m_bytes = { buffer.get(), size };
+		data.m_buffer = std::move(buffer);
+		return data;
+	}
+
+	std::span<const std::byte> AssetData::get_bytes() const noexcept
+	{
+		return m_bytes;
+	}
+
+	bool AssetData::is_zero_copy() const noexcept
+	{
+		return m_buffer == nullptr;
+	}
+
+	bool AssetArchive::open(const std::filesystem::path& path)
+	{
+		close();
+		if (!m_file.open(path))
+		{
+			return false;
+		}
+
+		const auto bytes = m_file.get_data();
+		ArchiveHeader header{};
+		if (bytes.size() < sizeof(header))
+		{
+			close();
+			return false;
+		}
+		std::memcpy(&header, bytes.data(), sizeof(header));
+
+		const auto toc_size = UInt64{ header.entry_count } * sizeof(ArchiveEntry);
+		if (header.magic != ArchiveHeader::k_magic || header.version != ArchiveHeader::k_version ||
+			!std::has_single_bit(header.alignment) || header.file_size != bytes.size() ||
+			toc_size > bytes.size() - sizeof(header))
+		{
+			close();
+			return false;
+		}
+
+		m_entries.resize(header.entry_count);
+		std::memcpy(m_entries.data(), bytes.data() + sizeof(header), toc_size);
+
+		const auto data_begin = sizeof(header) + toc_size;
+		for (size_type index = 0; index < m_entries.size(); ++index)
+		{
+			if (!is_valid_entry(m_entries[index], data_begin, header.file_size, header.alignment) ||
+				(index > 0 && m_entries[index - 1].id >= m_entries[index].id))
+			{
+				close();
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void AssetArchive::close() noexcept
+	{
+		m_file.close();
+		m_entries.clear();
+	}
+
+	bool AssetArchive::is_open() const noexcept
+	{
+		return m_file.is_open();
+	}
+
+	const ArchiveEntry* AssetArchive::find(const AssetId id) const noexcept
+	{
+		const auto found = std::lower_bound(m_entries.begin(), m_entries.end(), id,
+			[](const ArchiveEntry& entry, const AssetId value) { return entry.id < value; });
+		return found != m_entries.end() && found->id == id ? &*found : nullptr;
+	}
+
+	const std::vector<ArchiveEntry>& AssetArchive::get_entries() const noexcept
+	{
+		return m_entries;
+	}
+
+	std::span<const std::byte> AssetArchive::get_stored_bytes(const ArchiveEntry& entry) const noexcept
+	{
+		return m_file.get_data().subspan(entry.offset, entry.stored_size);
+	}
+
+	AssetStatus AssetArchive::load(const AssetId id, AssetData& data) const
+	{
+		const auto* entry = find(id);
+		return entry != nullptr ? load(*entry, data) : AssetStatus::not_found;
+	}
+
+	AssetStatus AssetArchive::load(const ArchiveEntry& entry, AssetData& data) const
+	{
+		const auto stored = get_stored_bytes(entry);
+		if (entry.compression == Compression::none)
+		{
+			data = AssetData::make_view(stored);
+			return AssetStatus::loaded;
+		}
+		if (!is_compression_supported(entry.compression))
+		{
+			return AssetStatus::unsupported_compression;
+		}
+
+		// A corrupt table could otherwise ask for an allocation far larger than anything the stored bytes can produce
+		const size_type size = entry.size;
+		if (size > get_max_decompressed_size(entry.compression, stored))
+		{
+			return AssetStatus::corrupt;
+		}
+		auto buffer = std::make_unique_for_overwrite<std::byte[]>(size);
+		if (!decompress(entry.compression, stored, { buffer.get(), size }))
+		{
+			return AssetStatus::corrupt;
+		}
+		data = AssetData::make_owned(std::move(buffer), size);
+		return AssetStatus::loaded;
+	}
+
+	AssetArchiveWriter::AssetArchiveWriter(const size_type alignment)
+		: m_alignment{ std::bit_ceil(std::max<size_type>(alignment, 1)) }
+	{
+	}
+
+	bool AssetArchiveWriter::add(const AssetId id, const std::span<const std::byte> bytes, const Compression compression)
+	{
+		PendingEntry pending{};
+		pending.entry.id = id;
+		pending.entry.size = bytes.size();
+		pending.entry.compression = compression;
+		if (!compress(compression, bytes, pending.bytes))
+		{
+			return false;
+		}
+		if (compression != Compression::none && pending.bytes.size() >= bytes.size())
+		{
+			pending.entry.compression = Compression::none;
+			pending.bytes.assign(bytes.begin(), bytes.end());
+		}
+		pending.entry.stored_size = pending.bytes.size();
+		m_entries.push_back(std::move(pending));
+		return true;
+	}
+
+	bool AssetArchiveWriter::write(const std::filesystem::path& path) const
+	{
+		std::vector<const PendingEntry*> sorted{};
+		sorted.reserve(m_entries.size());
+		for (const auto& pending : m_entries)
+		{
+			sorted.push_back(&pending);
+		}
+		std::sort(sorted.begin(), sorted.end(), [](const PendingEntry* a, const PendingEntry* b) { return a->entry.id < b->entry.id; });
+		const auto duplicate = std::adjacent_find(sorted.begin(), sorted.end(),
+			[](const PendingEntry* a, const PendingEntry* b) { return a->entry.id == b->entry.id; });
+		if (duplicate != sorted.end())
+		{
+			return false;
+		}
+
+		std::vector<ArchiveEntry> table{};
+		table.reserve(sorted.size());
+		UInt64 offset = sizeof(ArchiveHeader) + sorted.size() * sizeof(ArchiveEntry);
+		for (const auto* pending : sorted)
+		{
+			offset = align_up(offset, m_alignment);
+			auto& entry = table.emplace_back(pending->entry);
+			entry.offset = offset;
+			offset += entry.stored_size;
+		}
+
+		ArchiveHeader header{};
+		header.entry_count = static_cast<UInt32>(table.size());
+		header.alignment = static_cast<UInt32>(m_alignment);
+		header.file_size = offset;
+
+		std::ofstream file{ path, std::ios::binary };
+		if (!file)
+		{
+			return false;
+		}
+
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		file.write(reinterpret_cast<const char*>(table.data()), static_cast<std::streamsize>(table.size() * sizeof(ArchiveEntry)));
+
+		const std::vector<char> padding(m_alignment, '\0');
+		UInt64 position = sizeof(header) + table.size() * sizeof(ArchiveEntry);
+		for (size_type index = 0; index < sorted.size(); ++index)
+		{
+			file.write(padding.data(), static_cast<std::streamsize>(table[index].offset - position));
+			const auto& bytes = sorted[index]->bytes;
+			file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+			position = table[index].offset + bytes.size();
+		}
+		return static_cast<bool>(file);
+	}
+
+	AssetArchiveWriter::size_type AssetArchiveWriter::size() const noexcept
+	{
+		return m_entries.size();
+	}
+}
\ No newline at end of file
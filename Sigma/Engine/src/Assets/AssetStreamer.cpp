@@ -0,0 +1,114 @@
+#include "Sigma/Engine/Assets/AssetStreamer.hpp"
+
+#include <algorithm>
+
+namespace sigma
+{
+	AssetStreamer::AssetStreamer(const AssetArchive& archive, JobSystem& job_system, const size_type io_thread_count)
+		: m_archive{ archive }
+		, m_job_system{ job_system }
+	{
+		const auto thread_count = std::max<size_type>(io_thread_count, 1);
+		m_io_threads.reserve(thread_count);
+		for (size_type index = 0; index < thread_count; ++index)
+		{
+			m_io_threads.emplace_back([this](const std::stop_token& stop_token) { io_loop(stop_token); });
+		}
+	}
+
+	AssetStreamer::~AssetStreamer()
+	{
+		{
+			std::lock_guard lock{ m_mutex };
+			m_requests.clear();
+		}
+		for (auto& thread : m_io_threads)
+		{
+			thread.request_stop();
+		}
+		m_io_threads.clear();
+
+		// Decompression jobs already submitted still reference this streamer
+		wait_idle();
+	}
+
+	void AssetStreamer::request(const AssetId id, const UInt32 priority, callback_type callback)
+	{
+		{
+			std::lock_guard lock{ m_mutex };
+			m_requests.push_back({ id, priority, m_next_sequence++, std::move(callback) });
+			std::push_heap(m_requests.begin(), m_requests.end(), RequestOrder{});
+		}
+		m_request_condition.notify_one();
+	}
+
+	void AssetStreamer::wait_idle()
+	{
+		std::unique_lock lock{ m_mutex };
+		m_idle_condition.wait(lock, [this]() { return m_requests.empty() && m_in_flight == 0; });
+	}
+
+	AssetStreamer::size_type AssetStreamer::get_pending_count() const
+	{
+		std::lock_guard lock{ m_mutex };
+		return m_requests.size() + m_in_flight;
+	}
+
+	bool AssetStreamer::RequestOrder::operator()(const Request& a, const Request& b) const noexcept
+	{
+		return a.priority != b.priority ? a.priority < b.priority : a.sequence > b.sequence;
+	}
+
+	void AssetStreamer::io_loop(const std::stop_token& stop_token)
+	{
+		while (true)
+		{
+			Request request{};
+			{
+				std::unique_lock lock{ m_mutex };
+				if (!m_request_condition.wait(lock, stop_token, [this]() { return !m_requests.empty(); }))
+				{
+					return;
+				}
+				std::pop_heap(m_requests.begin(), m_requests.end(), RequestOrder{});
+				request = std::move(m_requests.back());
+				m_requests.pop_back();
+				++m_in_flight;
+			}
+
+			const auto* entry = m_archive.find(request.id);
+			if (entry == nullptr)
+			{
+				request.callback(request.id, AssetStatus::not_found, {});
+				complete_request();
+				continue;
+			}
+
+			MappedFile::prefetch(m_archive.get_stored_bytes(*entry));
+			if (entry->compression == Compression::none)
+			{
+				AssetData data{};
+				const auto status = m_archive.load(*entry, data);
+				request.callback(request.id, status, std::move(data));
+				complete_request();
+				continue;
+			}
+
+			m_job_system.submit([this, entry, request = std::move(request)]()
+			{
+				AssetData data{};
+				const auto status = m_archive.load(*entry, data);
+				request.callback(request.id, status, std::move(data));
+				complete_request();
+			});
+		}
+	}
+
+	void AssetStreamer::complete_request()
+	{
+		// Notified under the lock: once the count reaches zero the destructor may return and destroy the condition
+		std::lock_guard lock{ m_mutex };
+		--m_in_flight;
+		m_idle_condition.notify_all();
+	}
+}
\ No newline at end of file
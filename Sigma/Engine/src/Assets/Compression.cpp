@@ -0,0 +1,282 @@
+#include "Sigma/Engine/Assets/Compression.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+
+#if defined(SIGMA_WITH_ZSTD)
+#include <zstd.h>
+#endif
+
+namespace sigma
+{
+	namespace
+	{
+		// LZ4 block format: a token holds the literal length (high nibble) and match length minus four (low nibble),
+		// each extended by 255-valued bytes when the nibble is saturated, followed by the literals and a 16-bit
+		// little endian match offset. The last five bytes are always literals and no match starts in the last twelve.
+		constexpr std::size_t k_lz4_min_match = 4;
+		constexpr std::size_t k_lz4_last_literals = 5;
+		constexpr std::size_t k_lz4_match_limit = 12;
+		constexpr std::size_t k_lz4_max_offset = 65535;
+		constexpr std::size_t k_lz4_hash_bits = 12;
+
+		[[nodiscard]] UInt32 read_u32(const std::byte* data) noexcept
+		{
+			UInt32 value{};
+			std::memcpy(&value, data, sizeof(value));
+			return value;
+		}
+
+		[[nodiscard]] std::size_t hash_sequence(const UInt32 sequence) noexcept
+		{
+			return (sequence * 2654435761u) >> (32 - k_lz4_hash_bits);
+		}
+
+		void write_length(std::vector<std::byte>& destination, std::size_t length)
+		{
+			for (; length >= 255; length -= 255)
+			{
+				destination.push_back(std::byte{ 255 });
+			}
+			destination.push_back(static_cast<std::byte>(length));
+		}
+
+		void write_sequence(std::vector<std::byte>& destination, const std::byte* literals, const std::size_t literal_length, const std::size_t offset, const std::size_t match_length)
+		{
+			const auto literal_nibble = std::min<std::size_t>(literal_length, 15);
+			const auto match_nibble = match_length == 0 ? 0 : std::min<std::size_t>(match_length - k_lz4_min_match, 15);
+			destination.push_back(static_cast<std::byte>(literal_nibble << 4 | match_nibble));
+			if (literal_nibble == 15)
+			{
+				write_length(destination, literal_length - 15);
+			}
+			destination.insert(destination.end(), literals, literals + literal_length);
+
+			if (match_length == 0)
+			{
+				return;
+			}
+			destination.push_back(static_cast<std::byte>(offset & 0xFF));
+			destination.push_back(static_cast<std::byte>(offset >> 8));
+			if (match_nibble == 15)
+			{
+				write_length(destination, match_length - k_lz4_min_match - 15);
+			}
+		}
+
+		void compress_lz4(std::span<const std::byte> source, std::vector<std::byte>& destination)
+		{
+			destination.clear();
+			destination.reserve(source.size() + source.size() / 255 + 16);
+
+			const auto* data = source.data();
+			const auto size = source.size();
+			std::size_t anchor = 0;
+			if (size > k_lz4_match_limit)
+			{
+				// Positions are stored plus one so a zero entry means empty
+				std::array<UInt32, std::size_t{ 1 } << k_lz4_hash_bits> table{};
+				const auto match_end = size - k_lz4_last_literals;
+				std::size_t position = 0;
+				while (position < size - k_lz4_match_limit)
+				{
+					const auto sequence = read_u32(data + position);
+					auto& slot = table[hash_sequence(sequence)];
+					const auto candidate = static_cast<std::size_t>(slot);
+					slot = static_cast<UInt32>(position + 1);
+
+					if (candidate == 0 || position - (candidate - 1) > k_lz4_max_offset || read_u32(data + candidate - 1) != sequence)
+					{
+						++position;
+						continue;
+					}
+
+					const auto match = candidate - 1;
+					auto match_length = k_lz4_min_match;
+					while (position + match_length < match_end && data[match + match_length] == data[position + match_length])
+					{
+						++match_length;
+					}
+
+					write_sequence(destination, data + anchor, position - anchor, position - match, match_length);
+					position += match_length;
+					anchor = position;
+				}
+			}
+			write_sequence(destination, data + anchor, size - anchor, 0, 0);
+		}
+
+		[[nodiscard]] bool read_length(std::span<const std::byte> source, std::size_t& position, std::size_t& length) noexcept
+		{
+			UInt8 value = 255;
+			while (value == 255)
+			{
+				if (position >= source.size())
+				{
+					return false;
+				}
+				value = static_cast<UInt8>(source[position++]);
+				length += value;
+			}
+			return true;
+		}
+
+		[[nodiscard]] bool decompress_lz4(std::span<const std::byte> source, std::span<std::byte> destination) noexcept
+		{
+			std::size_t input = 0;
+			std::size_t output = 0;
+			while (input < source.size())
+			{
+				const auto token = static_cast<UInt8>(source[input++]);
+
+				std::size_t literal_length = token >> 4;
+				if (literal_length == 15 && !read_length(source, input, literal_length))
+				{
+					return false;
+				}
+				if (literal_length > source.size() - input || literal_length > destination.size() - output)
+				{
+					return false;
+				}
+				if (literal_length != 0)
+				{
+					std::memcpy(destination.data() + output, source.data() + input, literal_length);
+				}
+				input += literal_length;
+				output += literal_length;
+
+				if (input == source.size())
+				{
+					break;
+				}
+
+				if (source.size() - input < 2)
+				{
+					return false;
+				}
+				const auto offset = static_cast<std::size_t>(source[input]) | static_cast<std::size_t>(source[input + 1]) << 8;
+				input += 2;
+				if (offset == 0 || offset > output)
+				{
+					return false;
+				}
+
+				std::size_t match_length = token & 0x0F;
+				if (match_length == 15 && !read_length(source, input, match_length))
+				{
+					return false;
+				}
+				match_length += k_lz4_min_match;
+				if (match_length > destination.size() - output)
+				{
+					return false;
+				}
+
+				// Matches may overlap their own output, so they are copied front to back one byte at a time
+				for (auto copied = output - offset; match_length > 0; --match_length)
+				{
+					destination[output++] = destination[copied++];
+				}
+			}
+			return output == destination.size();
+		}
+	}
+
+	bool is_compression_supported(const Compression compression) noexcept
+	{
+		switch (compression)
+		{
+		case Compression::none:
+		case Compression::lz4:
+			return true;
+		case Compression::zstd:
+#if defined(SIGMA_WITH_ZSTD)
+			return true;
+#else
+			return false;
+#endif
+		}
+		return false;
+	}
+
+	bool compress(const Compression compression, std::span<const std::byte> source, std::vector<std::byte>& destination)
+	{
+		switch (compression)
+		{
+		case Compression::none:
+			destination.assign(source.begin(), source.end());
+			return true;
+		case Compression::lz4:
+			compress_lz4(source, destination);
+			return true;
+		case Compression::zstd:
+#if defined(SIGMA_WITH_ZSTD)
+		{
+			destination.resize(ZSTD_compressBound(source.size()));
+			const auto size = ZSTD_compress(destination.data(), destination.size(), source.data(), source.size(), ZSTD_CLEVEL_DEFAULT);
+			if (ZSTD_isError(size))
+			{
+				return false;
+			}
+			destination.resize(size);
+			return true;
+		}
+#else
+			return false;
+#endif
+		}
+		return false;
+	}
+
+	std::size_t get_max_decompressed_size(const Compression compression, std::span<const std::byte> source) noexcept
+	{
+		switch (compression)
+		{
+		case Compression::none:
+			return source.size();
+		case Compression::lz4:
+			return source.size() > std::numeric_limits<std::size_t>::max() / 255 ? std::numeric_limits<std::size_t>::max() : source.size() * 255;
+		case Compression::zstd:
+#if defined(SIGMA_WITH_ZSTD)
+		{
+			const auto size = ZSTD_getFrameContentSize(source.data(), source.size());
+			return size == ZSTD_CONTENTSIZE_UNKNOWN || size == ZSTD_CONTENTSIZE_ERROR ? 0 : static_cast<std::size_t>(size);
+		}
+#else
+			return 0;
+#endif
+		}
+		return 0;
+	}
+
+	bool decompress(const Compression compression, std::span<const std::byte> source, std::span<std::byte> destination) noexcept
+	{
+		switch (compression)
+		{
+		case Compression::none:
+			if (source.size() != destination.size())
+			{
+				return false;
+			}
+			if (!source.empty())
+			{
+				std::memcpy(destination.data(), source.data(), source.size());
+			}
+			return true;
+		case Compression::lz4:
+			return decompress_lz4(source, destination);
+		case Compression::zstd:
+#if defined(SIGMA_WITH_ZSTD)
+		{
+			const auto size = ZSTD_decompress(destination.data(), destination.size(), source.data(), source.size());
+			return !ZSTD_isError(size) && size == destination.size();
+		}
+#else
+			return false;
+#endif
+		}
+		return false;
+	}
+}
\ No newline at end of file
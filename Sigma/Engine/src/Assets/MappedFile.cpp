@@ -0,0 +1,172 @@
+#include "Sigma/Engine/Assets/MappedFile.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace sigma
+{
+	namespace
+	{
+		constexpr std::size_t k_page_size = 4096;
+	}
+
+	MappedFile::~MappedFile()
+	{
+		close();
+	}
+
+	MappedFile::MappedFile(MappedFile&& other) noexcept
+	{
+		*this = std::move(other);
+	}
+
+	MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+	{
+		if (this != &other)
+		{
+			close();
+			m_data = std::exchange(other.m_data, nullptr);
+			m_size = std::exchange(other.m_size, 0);
+#if defined(_WIN32)
+			m_mapping = std::exchange(other.m_mapping, nullptr);
+#endif
+		}
+		return *this;
+	}
+
+#if defined(_WIN32)
+	bool MappedFile::open(const std::filesystem::path& path)
+	{
+		close();
+
+		const auto file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			return false;
+		}
+
+		LARGE_INTEGER size{};
+		if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+		{
+			CloseHandle(file);
+			return false;
+		}
+
+		const auto mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(file);
+		if (mapping == nullptr)
+		{
+			return false;
+		}
+
+		const auto* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if (view == nullptr)
+		{
+			CloseHandle(mapping);
+			return false;
+		}
+
+		m_data = static_cast<const std::byte*>(view);
+		m_size = static_cast<size_type>(size.QuadPart);
+		m_mapping = mapping;
+		return true;
+	}
+
+	void MappedFile::close() noexcept
+	{
+		if (m_data != nullptr)
+		{
+			UnmapViewOfFile(m_data);
+			CloseHandle(m_mapping);
+		}
+		m_data = nullptr;
+		m_size = 0;
+		m_mapping = nullptr;
+	}
+#else
+	bool MappedFile::open(const std::filesystem::path& path)
+	{
+		close();
+
+		const auto file = ::open(path.c_str(), O_RDONLY);
+		if (file < 0)
+		{
+			return false;
+		}
+
+		struct stat status{};
+		if (fstat(file, &status) != 0 || status.st_size <= 0)
+		{
+			::close(file);
+			return false;
+		}
+
+		const auto size = static_cast<size_type>(status.st_size);
+		auto* view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+		::close(file);
+		if (view == MAP_FAILED)
+		{
+			return false;
+		}
+
+		m_data = static_cast<const std::byte*>(view);
+		m_size = size;
+		return true;
+	}
+
+	void MappedFile::close() noexcept
+	{
+		if (m_data != nullptr)
+		{
+			munmap(const_cast<std::byte*>(m_data), m_size);
+		}
+		m_data = nullptr;
+		m_size = 0;
+	}
+#endif
+
+	bool MappedFile::is_open() const noexcept
+	{
+		return m_data != nullptr;
+	}
+
+	std::span<const std::byte> MappedFile::get_data() const noexcept
+	{
+		return { m_data, m_size };
+	}
+
+	void MappedFile::prefetch(const std::span<const std::byte> range) noexcept
+	{
+		if (range.empty())
+		{
+			return;
+		}
+
+		const auto first_page = reinterpret_cast<std::uintptr_t>(range.data()) & ~std::uintptr_t{ k_page_size - 1 };
+		const auto end = reinterpret_cast<std::uintptr_t>(range.data() + range.size());
+#if defined(_WIN32)
+		WIN32_MEMORY_RANGE_ENTRY entry{ reinterpret_cast<void*>(first_page), end - first_page };
+		PrefetchVirtualMemory(GetCurrentProcess(), 1, &entry, 0);
+#else
+		madvise(reinterpret_cast<void*>(first_page), end - first_page, MADV_WILLNEED);
+#endif
+
+		for (auto page = first_page; page < end; page += k_page_size)
+		{
+			const auto address = std::max(page, reinterpret_cast<std::uintptr_t>(range.data()));
+			static_cast<void>(*reinterpret_cast<const volatile std::byte*>(address));
+		}
+	}
+}
\ No newline at end of file
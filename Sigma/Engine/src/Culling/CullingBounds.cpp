@@ -0,0 +1,100 @@
+#include "Sigma/Engine/Culling/CullingBounds.hpp"
+
+namespace sigma
+{
+	CullingBounds::CullingBounds(const size_type capacity)
+		: m_slots{ capacity }
+	{
+		for (auto* stream : { &m_center_x, &m_center_y, &m_center_z, &m_radius, &m_extent_x, &m_extent_y, &m_extent_z })
+		{
+			stream->reserve(capacity);
+		}
+		m_entities.reserve(capacity);
+	}
+
+	void CullingBounds::set(const Entity entity, const Aabb& bounds)
+	{
+		const auto center = get_center(bounds);
+		const Vector3 extents{ bounds.max.x - center.x, bounds.max.y - center.y, bounds.max.z - center.z };
+		set(entity, center, extents, std::sqrt(extents.x * extents.x + extents.y * extents.y + extents.z * extents.z));
+	}
+
+	void CullingBounds::set(const Entity entity, const Sphere& sphere)
+	{
+		set(entity, sphere.center, { sphere.radius, sphere.radius, sphere.radius }, sphere.radius);
+	}
+
+	void CullingBounds::erase(const Entity entity)
+	{
+		if (!contains(entity))
+		{
+			return;
+		}
+
+		const auto slot = m_slots[entity];
+		const auto last = m_entities.size() - 1;
+		for (auto* stream : { &m_center_x, &m_center_y, &m_center_z, &m_radius, &m_extent_x, &m_extent_y, &m_extent_z })
+		{
+			(*stream)[slot] = stream->back();
+			stream->pop_back();
+		}
+
+		m_entities[slot] = m_entities[last];
+		m_entities.pop_back();
+		if (slot != last)
+		{
+			m_slots[m_entities[slot]] = slot;
+		}
+		m_slots.erase(entity);
+	}
+
+	CullingBounds::size_type CullingBounds::size() const noexcept
+	{
+		return m_entities.size();
+	}
+
+	bool CullingBounds::contains(const Entity entity) const noexcept
+	{
+		return m_slots.has_element(entity);
+	}
+
+	Entity CullingBounds::get_entity(const size_type index) const noexcept
+	{
+		return m_entities[index];
+	}
+
+	const std::vector<Entity>& CullingBounds::get_entities() const noexcept
+	{
+		return m_entities;
+	}
+
+	BoundsStreams CullingBounds::get_streams() const noexcept
+	{
+		return {
+			m_center_x.data(), m_center_y.data(), m_center_z.data(), m_radius.data(),
+			m_extent_x.data(), m_extent_y.data(), m_extent_z.data(), m_entities.size()
+		};
+	}
+
+	void CullingBounds::set(const Entity entity, const Vector3& center, const Vector3& extents, const Float radius)
+	{
+		if (!contains(entity))
+		{
+			m_slots.emplace(entity, static_cast<UInt32>(m_entities.size()));
+			m_entities.push_back(entity);
+			for (auto* stream : { &m_center_x, &m_center_y, &m_center_z, &m_radius, &m_extent_x, &m_extent_y, &m_extent_z })
+			{
+				stream->emplace_back();
+			}
+		}
+
+		const auto slot = m_slots[entity];
+		m_center_x[slot] = center.x;
+		m_center_y[slot] = center.y;
+		m_center_z[slot] = center.z;
+		m_radius[slot] = radius;
+		m_extent_x[slot] = extents.x;
+		m_extent_y[slot] = extents.y;
+		m_extent_z[slot] = extents.z;
+	}
+}
\ No newline at end of file
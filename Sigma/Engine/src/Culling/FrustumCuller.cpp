@@ -0,0 +1,148 @@
+#include "Sigma/Engine/Culling/FrustumCuller.hpp"
+
+#include <cstring>
+
+#include "Sigma/Engine/Jobs/ChunkedCompaction.hpp"
+
+#if defined(_XM_SSE_INTRINSICS_)
+#include <immintrin.h>
+#endif
+
+namespace sigma
+{
+	namespace
+	{
+		template <CullingVolume Volume>
+		[[nodiscard]] Float get_reach(const BoundsStreams& streams, const Vector4& plane, const std::size_t index) noexcept
+		{
+			if constexpr (Volume == CullingVolume::sphere)
+			{
+				return streams.radius[index];
+			}
+			else
+			{
+				return streams.extent_x[index] * std::abs(plane.x) + streams.extent_y[index] * std::abs(plane.y) + streams.extent_z[index] * std::abs(plane.z);
+			}
+		}
+
+		template <CullingVolume Volume>
+		[[nodiscard]] bool is_visible(const BoundsStreams& streams, const Frustum& frustum, const std::size_t index) noexcept
+		{
+			for (const auto& plane : frustum.planes)
+			{
+				const auto distance = streams.center_x[index] * plane.x + streams.center_y[index] * plane.y + streams.center_z[index] * plane.z + plane.w;
+				if (distance < -get_reach<Volume>(streams, plane, index))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		template <CullingVolume Volume>
+		std::size_t cull_range(const BoundsStreams& streams, const Frustum& frustum, std::size_t index, const std::size_t end, UInt32* output) noexcept
+		{
+			std::size_t count = 0;
+
+#if defined(__AVX__)
+			for (; index + 8 <= end; index += 8)
+			{
+				const auto x = _mm256_loadu_ps(streams.center_x + index);
+				const auto y = _mm256_loadu_ps(streams.center_y + index);
+				const auto z = _mm256_loadu_ps(streams.center_z + index);
+				auto inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+				for (const auto& plane : frustum.planes)
+				{
+					const auto distance = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, _mm256_set1_ps(plane.x)), _mm256_mul_ps(y, _mm256_set1_ps(plane.y))),
+						_mm256_add_ps(_mm256_mul_ps(z, _mm256_set1_ps(plane.z)), _mm256_set1_ps(plane.w)));
+
+					__m256 reach;
+					if constexpr (Volume == CullingVolume::sphere)
+					{
+						reach = _mm256_loadu_ps(streams.radius + index);
+					}
+					else
+					{
+						reach = _mm256_add_ps(_mm256_add_ps(
+							_mm256_mul_ps(_mm256_loadu_ps(streams.extent_x + index), _mm256_set1_ps(std::abs(plane.x))),
+							_mm256_mul_ps(_mm256_loadu_ps(streams.extent_y + index), _mm256_set1_ps(std::abs(plane.y)))),
+							_mm256_mul_ps(_mm256_loadu_ps(streams.extent_z + index), _mm256_set1_ps(std::abs(plane.z))));
+					}
+
+					inside = _mm256_and_ps(inside, _mm256_cmp_ps(_mm256_add_ps(distance, reach), _mm256_setzero_ps(), _CMP_GE_OQ));
+				}
+
+				count = detail::append_lanes<8>(index, _mm256_movemask_ps(inside), output, count);
+			}
+#endif
+
+#if defined(_XM_SSE_INTRINSICS_)
+			for (; index + 4 <= end; index += 4)
+			{
+				const auto x = _mm_loadu_ps(streams.center_x + index);
+				const auto y = _mm_loadu_ps(streams.center_y + index);
+				const auto z = _mm_loadu_ps(streams.center_z + index);
+				auto inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+				for (const auto& plane : frustum.planes)
+				{
+					const auto distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(plane.x)), _mm_mul_ps(y, _mm_set1_ps(plane.y))),
+						_mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(plane.z)), _mm_set1_ps(plane.w)));
+
+					__m128 reach;
+					if constexpr (Volume == CullingVolume::sphere)
+					{
+						reach = _mm_loadu_ps(streams.radius + index);
+					}
+					else
+					{
+						reach = _mm_add_ps(_mm_add_ps(
+							_mm_mul_ps(_mm_loadu_ps(streams.extent_x + index), _mm_set1_ps(std::abs(plane.x))),
+							_mm_mul_ps(_mm_loadu_ps(streams.extent_y + index), _mm_set1_ps(std::abs(plane.y)))),
+							_mm_mul_ps(_mm_loadu_ps(streams.extent_z + index), _mm_set1_ps(std::abs(plane.z))));
+					}
+
+					inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(distance, reach), _mm_setzero_ps()));
+				}
+
+				count = detail::append_lanes<4>(index, _mm_movemask_ps(inside), output, count);
+			}
+#endif
+
+			for (; index < end; ++index)
+			{
+				output[count] = static_cast<UInt32>(index);
+				count += is_visible<Volume>(streams, frustum, index) ? 1u : 0u;
+			}
+			return count;
+		}
+	}
+
+	void FrustumCuller::cull(const CullingBounds& bounds, const Frustum& frustum, const CullingVolume volume, std::vector<UInt32>& visible, JobSystem& job_system)
+	{
+		const auto streams = bounds.get_streams();
+
+		// Every chunk compacts into its own window of the scratch buffer, the windows are then packed together
+		m_scratch.resize(streams.size);
+		const auto visible_count = detail::list_chunks(job_system, streams.size, k_chunk_size, m_chunk_offsets, [&](size_type, const size_type begin, const size_type end)
+		{
+			return cull(streams, frustum, volume, begin, end, m_scratch.data() + begin);
+		});
+
+		visible.resize(visible_count);
+		detail::gather_chunks(job_system, m_chunk_offsets, [&](const size_type chunk, const size_type output, const size_type count)
+		{
+			std::memcpy(visible.data() + output, m_scratch.data() + chunk * k_chunk_size, count * sizeof(UInt32));
+		});
+	}
+
+	FrustumCuller::size_type FrustumCuller::cull(const BoundsStreams& streams, const Frustum& frustum, const CullingVolume volume, const size_type begin, const size_type end, UInt32* output) noexcept
+	{
+		if (volume == CullingVolume::sphere)
+		{
+			return cull_range<CullingVolume::sphere>(streams, frustum, begin, end, output);
+		}
+		return cull_range<CullingVolume::box>(streams, frustum, begin, end, output);
+	}
+}
\ No newline at end of file
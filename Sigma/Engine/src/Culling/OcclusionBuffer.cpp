@@ -0,0 +1,291 @@
+#include "Sigma/Engine/Culling/OcclusionBuffer.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstring>
+
+namespace sigma
+{
+	namespace
+	{
+		// Geometry closer to the camera plane than this is not projected, occluders drop the triangle and occludees
+		// count as visible so the buffer never hides something it has not seen
+		constexpr Float k_min_w = 1e-4f;
+
+		constexpr std::array<UInt32, 36> k_box_indices{
+			0, 1, 3, 0, 3, 2,
+			4, 6, 7, 4, 7, 5,
+			0, 4, 5, 0, 5, 1,
+			2, 3, 7, 2, 7, 6,
+			0, 2, 6, 0, 6, 4,
+			1, 5, 7, 1, 7, 3
+		};
+
+		[[nodiscard]] std::array<Vector3, 8> get_corners(const Aabb& bounds) noexcept
+		{
+			std::array<Vector3, 8> corners{};
+			for (UInt32 corner = 0; corner < 8; ++corner)
+			{
+				corners[corner] = {
+					(corner & 4) != 0 ? bounds.max.x : bounds.min.x,
+					(corner & 2) != 0 ? bounds.max.y : bounds.min.y,
+					(corner & 1) != 0 ? bounds.max.z : bounds.min.z
+				};
+			}
+			return corners;
+		}
+
+		[[nodiscard]] Float get_edge(const Float ax, const Float ay, const Float bx, const Float by, const Float px, const Float py) noexcept
+		{
+			return (bx - ax) * (py - ay) - (by - ay) * (px - ax);
+		}
+	}
+
+	OcclusionBuffer::OcclusionBuffer(const size_type width, const size_type height)
+		: m_width{ width }, m_height{ height },
+		m_tile_columns{ (width + k_tile_size - 1) / k_tile_size }, m_tile_rows{ (height + k_tile_size - 1) / k_tile_size },
+		m_depth(width * height, 1.0f), m_tile_max_depth(m_tile_columns * m_tile_rows, 1.0f)
+	{
+	}
+
+	void OcclusionBuffer::clear(const Matrix4x4& view_projection)
+	{
+		m_view_projection = view_projection;
+		std::fill(m_depth.begin(), m_depth.end(), 1.0f);
+		m_finalized = false;
+	}
+
+	void OcclusionBuffer::add_occluder(std::span<const Vector3> vertices, std::span<const UInt32> indices)
+	{
+		assert(indices.size() % 3 == 0);
+
+		for (size_type index = 0; index + 2 < indices.size(); index += 3)
+		{
+			rasterize(project(vertices[indices[index]]), project(vertices[indices[index + 1]]), project(vertices[indices[index + 2]]));
+		}
+		m_finalized = false;
+	}
+
+	void OcclusionBuffer::add_occluder(const Aabb& bounds)
+	{
+		const auto corners = get_corners(bounds);
+		add_occluder(corners, k_box_indices);
+	}
+
+	void OcclusionBuffer::finalize()
+	{
+		for (size_type tile_y = 0; tile_y < m_tile_rows; ++tile_y)
+		{
+			for (size_type tile_x = 0; tile_x < m_tile_columns; ++tile_x)
+			{
+				Float max_depth = 0.0f;
+				for (auto y = tile_y * k_tile_size; y < std::min((tile_y + 1) * k_tile_size, m_height); ++y)
+				{
+					const auto row = m_depth.data() + y * m_width;
+					for (auto x = tile_x * k_tile_size; x < std::min((tile_x + 1) * k_tile_size, m_width); ++x)
+					{
+						max_depth = std::max(max_depth, row[x]);
+					}
+				}
+				m_tile_max_depth[tile_y * m_tile_columns + tile_x] = max_depth;
+			}
+		}
+		m_finalized = true;
+	}
+
+	bool OcclusionBuffer::is_visible(const Aabb& bounds) const noexcept
+	{
+		assert(m_finalized);
+
+		auto min_x = std::numeric_limits<Float>::max();
+		auto min_y = std::numeric_limits<Float>::max();
+		auto min_z = std::numeric_limits<Float>::max();
+		auto max_x = std::numeric_limits<Float>::lowest();
+		auto max_y = std::numeric_limits<Float>::lowest();
+		for (const auto& corner : get_corners(bounds))
+		{
+			const auto vertex = project(corner);
+			if (vertex.w < k_min_w)
+			{
+				return true;
+			}
+
+			min_x = std::min(min_x, vertex.x);
+			min_y = std::min(min_y, vertex.y);
+			min_z = std::min(min_z, vertex.z);
+			max_x = std::max(max_x, vertex.x);
+			max_y = std::max(max_y, vertex.y);
+		}
+
+		if (min_z <= 0.0f)
+		{
+			return true;
+		}
+
+		const auto width = static_cast<Float>(m_width);
+		const auto height = static_cast<Float>(m_height);
+		if (max_x < 0.0f || max_y < 0.0f || min_x >= width || min_y >= height)
+		{
+			return false;
+		}
+
+		const auto first_x = static_cast<size_type>(std::max(min_x, 0.0f));
+		const auto first_y = static_cast<size_type>(std::max(min_y, 0.0f));
+		const auto last_x = std::min(static_cast<size_type>(max_x), m_width - 1);
+		const auto last_y = std::min(static_cast<size_type>(max_y), m_height - 1);
+
+		for (auto tile_y = first_y / k_tile_size; tile_y <= last_y / k_tile_size; ++tile_y)
+		{
+			for (auto tile_x = first_x / k_tile_size; tile_x <= last_x / k_tile_size; ++tile_x)
+			{
+				if (min_z >= m_tile_max_depth[tile_y * m_tile_columns + tile_x])
+				{
+					continue;
+				}
+
+				const auto end_y = std::min((tile_y + 1) * k_tile_size - 1, last_y);
+				const auto end_x = std::min((tile_x + 1) * k_tile_size - 1, last_x);
+				for (auto y = std::max(tile_y * k_tile_size, first_y); y <= end_y; ++y)
+				{
+					const auto row = m_depth.data() + y * m_width;
+					for (auto x = std::max(tile_x * k_tile_size, first_x); x <= end_x; ++x)
+					{
+						if (min_z < row[x])
+						{
+							return true;
+						}
+					}
+				}
+			}
+		}
+		return false;
+	}
+
+	void OcclusionBuffer::cull(const CullingBounds& bounds, std::vector<UInt32>& visible, JobSystem& job_system)
+	{
+		const auto streams = bounds.get_streams();
+		const auto chunk_count = (visible.size() + k_cull_grain_size - 1) / k_cull_grain_size;
+
+		// Chunks compact in place inside their own range, which never overtakes the entries still to be read
+		m_chunk_counts.assign(chunk_count, 0);
+		job_system.parallel_for(0, chunk_count, 1, [&](const size_type chunk_begin, const size_type chunk_end)
+		{
+			for (auto chunk = chunk_begin; chunk < chunk_end; ++chunk)
+			{
+				const auto begin = chunk * k_cull_grain_size;
+				const auto end = std::min(begin + k_cull_grain_size, visible.size());
+				size_type count = 0;
+				for (auto entry = begin; entry < end; ++entry)
+				{
+					const auto index = visible[entry];
+					const Vector3 center{ streams.center_x[index], streams.center_y[index], streams.center_z[index] };
+					const Vector3 extents{ streams.extent_x[index], streams.extent_y[index], streams.extent_z[index] };
+					const Aabb box{
+						{ center.x - extents.x, center.y - extents.y, center.z - extents.z },
+						{ center.x + extents.x, center.y + extents.y, center.z + extents.z }
+					};
+					if (is_visible(box))
+					{
+						visible[begin + count++] = index;
+					}
+				}
+				m_chunk_counts[chunk] = count;
+			}
+		});
+
+		size_type size = 0;
+		for (size_type chunk = 0; chunk < chunk_count; ++chunk)
+		{
+			std::memmove(visible.data() + size, visible.data() + chunk * k_cull_grain_size, m_chunk_counts[chunk] * sizeof(UInt32));
+			size += m_chunk_counts[chunk];
+		}
+		visible.resize(size);
+	}
+
+	OcclusionBuffer::size_type OcclusionBuffer::get_width() const noexcept
+	{
+		return m_width;
+	}
+
+	OcclusionBuffer::size_type OcclusionBuffer::get_height() const noexcept
+	{
+		return m_height;
+	}
+
+	Float OcclusionBuffer::get_depth(const size_type x, const size_type y) const noexcept
+	{
+		return m_depth[y * m_width + x];
+	}
+
+	OcclusionBuffer::ScreenVertex OcclusionBuffer::project(const Vector3& point) const noexcept
+	{
+		const auto& m = m_view_projection;
+		const auto x = point.x * m._11 + point.y * m._21 + point.z * m._31 + m._41;
+		const auto y = point.x * m._12 + point.y * m._22 + point.z * m._32 + m._42;
+		const auto z = point.x * m._13 + point.y * m._23 + point.z * m._33 + m._43;
+		const auto w = point.x * m._14 + point.y * m._24 + point.z * m._34 + m._44;
+		if (w < k_min_w)
+		{
+			return { 0.0f, 0.0f, 0.0f, w };
+		}
+
+		const auto inverse_w = 1.0f / w;
+		return {
+			(x * inverse_w * 0.5f + 0.5f) * static_cast<Float>(m_width),
+			(0.5f - y * inverse_w * 0.5f) * static_cast<Float>(m_height),
+			z * inverse_w,
+			w
+		};
+	}
+
+	void OcclusionBuffer::rasterize(const ScreenVertex& a, const ScreenVertex& b, const ScreenVertex& c) noexcept
+	{
+		if (a.w < k_min_w || b.w < k_min_w || c.w < k_min_w)
+		{
+			return;
+		}
+
+		const auto area = get_edge(a.x, a.y, b.x, b.y, c.x, c.y);
+		if (std::abs(area) < 1e-8f)
+		{
+			return;
+		}
+
+		const auto min_x = std::min({ a.x, b.x, c.x });
+		const auto min_y = std::min({ a.y, b.y, c.y });
+		const auto max_x = std::max({ a.x, b.x, c.x });
+		const auto max_y = std::max({ a.y, b.y, c.y });
+		if (max_x < 0.0f || max_y < 0.0f || min_x >= static_cast<Float>(m_width) || min_y >= static_cast<Float>(m_height))
+		{
+			return;
+		}
+
+		// Both windings are accepted, the sign of the area orients the edge functions
+		const auto orientation = area < 0.0f ? -1.0f : 1.0f;
+		const auto inverse_area = 1.0f / std::abs(area);
+		const auto first_x = static_cast<size_type>(std::max(min_x, 0.0f));
+		const auto first_y = static_cast<size_type>(std::max(min_y, 0.0f));
+		const auto last_x = std::min(static_cast<size_type>(max_x), m_width - 1);
+		const auto last_y = std::min(static_cast<size_type>(max_y), m_height - 1);
+
+		for (auto y = first_y; y <= last_y; ++y)
+		{
+			const auto sample_y = static_cast<Float>(y) + 0.5f;
+			const auto row = m_depth.data() + y * m_width;
+			for (auto x = first_x; x <= last_x; ++x)
+			{
+				const auto sample_x = static_cast<Float>(x) + 0.5f;
+				const auto weight_a = get_edge(b.x, b.y, c.x, c.y, sample_x, sample_y) * orientation;
+				const auto weight_b = get_edge(c.x, c.y, a.x, a.y, sample_x, sample_y) * orientation;
+				const auto weight_c = get_edge(a.x, a.y, b.x, b.y, sample_x, sample_y) * orientation;
+				if (weight_a < 0.0f || weight_b < 0.0f || weight_c < 0.0f)
+				{
+					continue;
+				}
+
+				const auto depth = (weight_a * a.z + weight_b * b.z + weight_c * c.z) * inverse_area;
+				row[x] = std::min(row[x], depth);
+			}
+		}
+	}
+}
\ No newline at end of file
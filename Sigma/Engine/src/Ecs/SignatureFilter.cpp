@@ -0,0 +1,114 @@
+#include "Sigma/Engine/Ecs/SignatureFilter.hpp"
+
+#include <bit>
+#include <cassert>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace sigma
+{
+	namespace
+	{
+		[[nodiscard]] bool matches(const UInt64* signature, const std::size_t word_count, const UInt64* include, const UInt64* exclude) noexcept
+		{
+			UInt64 rejected = 0;
+			for (std::size_t word = 0; word < word_count; ++word)
+			{
+				rejected |= ((signature[word] & include[word]) ^ include[word]) | (signature[word] & exclude[word]);
+			}
+			return rejected == 0;
+		}
+
+#if defined(__AVX2__)
+		// Repeats the word_count words of a mask across the four lanes of a register
+		[[nodiscard]] __m256i broadcast_mask(const UInt64* mask, const std::size_t word_count) noexcept
+		{
+			const auto lane = [&](const std::size_t index) { return static_cast<long long>(mask[index % word_count]); };
+			return _mm256_set_epi64x(lane(3), lane(2), lane(1), lane(0));
+		}
+
+		// Collapses the per-lane compare results of one register into one bit per entity
+		template <std::size_t WordCount>
+		[[nodiscard]] UInt32 get_entity_bits(const int lanes) noexcept
+		{
+			const auto bits = static_cast<UInt32>(lanes);
+			if constexpr (WordCount == 1)
+			{
+				return bits;
+			}
+			else if constexpr (WordCount == 2)
+			{
+				const auto pairs = bits & (bits >> 1);
+				return (pairs & 1) | ((pairs >> 1) & 2);
+			}
+			else
+			{
+				return bits == 0xF ? 1u : 0u;
+			}
+		}
+
+		template <std::size_t WordCount>
+		[[nodiscard]] Entity filter_range(const UInt64* signatures, const UInt64* include, const UInt64* exclude, Entity entity, const Entity end,
+			Entity* output, std::size_t& count) noexcept
+		{
+			constexpr std::size_t k_entities_per_register = 4 / WordCount;
+			constexpr std::size_t k_entities_per_block = 16;
+
+			const auto include_lanes = broadcast_mask(include, WordCount);
+			const auto exclude_lanes = broadcast_mask(exclude, WordCount);
+			const auto zero = _mm256_setzero_si256();
+			for (; entity + k_entities_per_block <= end; entity += k_entities_per_block)
+			{
+				// One bit per entity of the block, so blocks without matches cost no stores
+				UInt32 matched = 0;
+				for (std::size_t slot = 0; slot < k_entities_per_block; slot += k_entities_per_register)
+				{
+					// signatures is not aligned to the entity range, so the loads stay unaligned
+					const auto signature = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(signatures + (entity + slot) * WordCount));
+					const auto missing = _mm256_xor_si256(_mm256_and_si256(signature, include_lanes), include_lanes);
+					const auto rejected = _mm256_or_si256(missing, _mm256_and_si256(signature, exclude_lanes));
+					const auto lanes = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(rejected, zero)));
+					matched |= get_entity_bits<WordCount>(lanes) << slot;
+				}
+
+				for (; matched != 0; matched &= matched - 1)
+				{
+					output[count++] = entity + static_cast<Entity>(std::countr_zero(matched));
+				}
+			}
+			return entity;
+		}
+#endif
+	}
+
+	std::size_t filter_signatures(const UInt64* signatures, const std::size_t word_count, const UInt64* include, const UInt64* exclude,
+		Entity entity, const Entity end, Entity* output) noexcept
+	{
+		assert(word_count == 1 || word_count == 2 || word_count == 4);
+
+		std::size_t count = 0;
+#if defined(__AVX2__)
+		switch (word_count)
+		{
+		case 1:
+			entity = filter_range<1>(signatures, include, exclude, entity, end, output, count);
+			break;
+		case 2:
+			entity = filter_range<2>(signatures, include, exclude, entity, end, output, count);
+			break;
+		default:
+			entity = filter_range<4>(signatures, include, exclude, entity, end, output, count);
+			break;
+		}
+#endif
+
+		for (; entity < end; ++entity)
+		{
+			output[count] = entity;
+			count += matches(signatures + entity * word_count, word_count, include, exclude) ? 1u : 0u;
+		}
+		return count;
+	}
+}
\ No newline at end of file
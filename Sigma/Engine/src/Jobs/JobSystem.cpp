@@ -0,0 +1,108 @@
+#include "Sigma/Engine/Jobs/JobSystem.hpp"
+
+#include <chrono>
+
+namespace sigma
+{
+	JobSystem::JobSystem()
+		: JobSystem(default_worker_count()) {}
+
+	JobSystem::JobSystem(const size_type worker_count)
+		: m_worker_statistics{ std::make_unique<WorkerStatistics[]>(worker_count) }
+	{
+		m_workers.reserve(worker_count);
+		for (size_type worker = 0; worker < worker_count; ++worker)
+		{
+			m_workers.emplace_back([this, worker](const std::stop_token& stop_token)
+			{
+				worker_loop(stop_token, worker);
+			});
+		}
+	}
+
+	JobSystem::~JobSystem()
+	{
+		for (auto& worker : m_workers)
+		{
+			worker.request_stop();
+		}
+		m_condition.notify_all();
+	}
+
+	void JobSystem::submit(job_type job)
+	{
+		if (m_workers.empty())
+		{
+			job();
+			return;
+		}
+
+		{
+			std::scoped_lock lock{ m_mutex };
+			m_jobs.emplace_back(std::move(job));
+		}
+		m_condition.notify_one();
+	}
+
+	JobSystem::size_type JobSystem::worker_count() const noexcept
+	{
+		return m_workers.size();
+	}
+
+	UInt64 JobSystem::get_worker_busy_nanoseconds(const size_type worker) const noexcept
+	{
+		return m_worker_statistics[worker].busy_nanoseconds.load(std::memory_order_relaxed);
+	}
+
+	UInt64 JobSystem::get_worker_job_count(const size_type worker) const noexcept
+	{
+		return m_worker_statistics[worker].job_count.load(std::memory_order_relaxed);
+	}
+
+	JobSystem::size_type JobSystem::default_worker_count() noexcept
+	{
+		const auto hardware_threads = static_cast<size_type>(std::thread::hardware_concurrency());
+		return hardware_threads > 1 ? hardware_threads - 1 : 0;
+	}
+
+	bool JobSystem::try_run_pending_job()
+	{
+		job_type job{};
+		{
+			std::scoped_lock lock{ m_mutex };
+			if (m_jobs.empty())
+			{
+				return false;
+			}
+			job = std::move(m_jobs.front());
+			m_jobs.pop_front();
+		}
+
+		job();
+		return true;
+	}
+
+	void JobSystem::worker_loop(const std::stop_token& stop_token, const size_type worker)
+	{
+		auto& statistics = m_worker_statistics[worker];
+		while (true)
+		{
+			job_type job{};
+			{
+				std::unique_lock lock{ m_mutex };
+				if (!m_condition.wait(lock, stop_token, [this]() { return !m_jobs.empty(); }))
+				{
+					return;
+				}
+				job = std::move(m_jobs.front());
+				m_jobs.pop_front();
+			}
+
+			const auto begin = std::chrono::steady_clock::now();
+			job();
+			const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin);
+			statistics.busy_nanoseconds.fetch_add(static_cast<UInt64>(elapsed.count()), std::memory_order_relaxed);
+			statistics.job_count.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+}
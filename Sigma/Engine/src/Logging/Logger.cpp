@@ -0,0 +1,316 @@
+#include "Sigma/Engine/Logging/Logger.hpp"
+
+#include <bit>
+#include <exception>
+
+namespace sigma
+{
+	namespace
+	{
+		std::atomic<UInt64> g_next_logger_id{ 0 };
+
+		struct ThreadBufferCache
+		{
+			UInt64 logger_id{ static_cast<UInt64>(-1) };
+			void* buffer{};
+		};
+
+		thread_local ThreadBufferCache t_buffer_cache{};
+
+		constexpr std::string_view k_level_names[] = { "trace", "debug", "info", "warning", "error" };
+	}
+
+	// Positions only grow, the ring offset is the position masked by the capacity. A record never wraps: when it does
+	// not fit before the end, the rest of the ring is skipped and it starts over at the front.
+	struct Logger::ThreadBuffer
+	{
+		explicit ThreadBuffer(const size_type buffer_capacity, const UInt32 index)
+			: storage{ std::make_unique<std::byte[]>(buffer_capacity) }
+			, capacity{ buffer_capacity }
+			, thread_index{ index }
+			, thread_id{ std::this_thread::get_id() }
+		{
+		}
+
+		std::unique_ptr<std::byte[]> storage;
+		const size_type capacity;
+		const UInt32 thread_index;
+		const std::thread::id thread_id;
+
+		alignas(64) std::atomic<size_type> head{};
+		size_type cached_tail{};
+		size_type reserved{};
+		std::atomic<UInt64> dropped_count{};
+
+		alignas(64) std::atomic<size_type> tail{};
+		UInt64 reported_dropped_count{};
+	};
+
+	Logger::Logger(const size_type buffer_size)
+		: m_id{ g_next_logger_id.fetch_add(1, std::memory_order_relaxed) }
+		, m_buffer_size{ std::bit_ceil(std::max(buffer_size, size_type{ 256 })) }
+	{
+	}
+
+	Logger::~Logger()
+	{
+		close();
+	}
+
+	bool Logger::open(const std::filesystem::path& path)
+	{
+		close();
+		m_file.open(path, std::ios::binary | std::ios::trunc);
+		if (!m_file)
+		{
+			return false;
+		}
+
+		m_thread = std::jthread{ [this](const std::stop_token& stop_token) { run(stop_token); } };
+		return true;
+	}
+
+	void Logger::close()
+	{
+		if (m_thread.joinable())
+		{
+			m_thread.request_stop();
+			m_thread.join();
+		}
+		if (m_file.is_open())
+		{
+			m_file.close();
+		}
+	}
+
+	bool Logger::is_open() const noexcept
+	{
+		return m_file.is_open();
+	}
+
+	void Logger::set_level(const LogLevel level) noexcept
+	{
+		m_level.store(level, std::memory_order_relaxed);
+	}
+
+	LogLevel Logger::get_level() const noexcept
+	{
+		return m_level.load(std::memory_order_relaxed);
+	}
+
+	void Logger::flush()
+	{
+		if (!m_thread.joinable())
+		{
+			return;
+		}
+
+		std::vector<std::pair<const ThreadBuffer*, size_type>> targets{};
+		{
+			const std::scoped_lock lock{ m_buffers_mutex };
+			for (const auto& buffer : m_buffers)
+			{
+				targets.emplace_back(buffer.get(), buffer->head.load(std::memory_order_acquire));
+			}
+		}
+
+		for (const auto& [buffer, head] : targets)
+		{
+			while (buffer->tail.load(std::memory_order_acquire) < head)
+			{
+				std::this_thread::sleep_for(k_poll_interval);
+			}
+		}
+
+		const std::scoped_lock lock{ m_drain_mutex };
+		m_file.flush();
+	}
+
+	UInt64 Logger::get_written_count() const noexcept
+	{
+		return m_written_count.load(std::memory_order_relaxed);
+	}
+
+	UInt64 Logger::get_dropped_count() const noexcept
+	{
+		const std::scoped_lock lock{ m_buffers_mutex };
+		auto count = m_unbuffered_dropped_count.load(std::memory_order_relaxed);
+		for (const auto& buffer : m_buffers)
+		{
+			count += buffer->dropped_count.load(std::memory_order_relaxed);
+		}
+		return count;
+	}
+
+	void Logger::append_until_placeholder(std::string& text, std::string_view& format)
+	{
+		const auto position = format.find("{}");
+		text += format.substr(0, position);
+		format.remove_prefix(position + 2);
+	}
+
+	Logger::ThreadBuffer* Logger::get_thread_buffer() noexcept
+	{
+		auto& cache = t_buffer_cache;
+		if (cache.logger_id == m_id)
+		{
+			return static_cast<ThreadBuffer*>(cache.buffer);
+		}
+
+		// Only the first record of a thread, or one after it logged to another logger, gets here
+		try
+		{
+			const std::scoped_lock lock{ m_buffers_mutex };
+			const auto thread_id = std::this_thread::get_id();
+			auto found = std::find_if(m_buffers.begin(), m_buffers.end(), [&](const auto& buffer) { return buffer->thread_id == thread_id; });
+			if (found == m_buffers.end())
+			{
+				m_buffers.push_back(std::make_unique<ThreadBuffer>(m_buffer_size, static_cast<UInt32>(m_buffers.size())));
+				found = std::prev(m_buffers.end());
+			}
+
+			cache = { m_id, found->get() };
+			return found->get();
+		}
+		catch (const std::exception&)
+		{
+			// Allocating the ring or locking failed, the record is dropped and the next one tries again
+			m_unbuffered_dropped_count.fetch_add(1, std::memory_order_relaxed);
+			return nullptr;
+		}
+	}
+
+	std::byte* Logger::try_reserve(ThreadBuffer& buffer, const size_type size) noexcept
+	{
+		const auto head = buffer.head.load(std::memory_order_relaxed);
+		const auto offset = head & (buffer.capacity - 1);
+		const auto skipped = offset + size > buffer.capacity ? buffer.capacity - offset : 0;
+		const auto required = skipped + size;
+
+		if (required > buffer.capacity - (head - buffer.cached_tail))
+		{
+			buffer.cached_tail = buffer.tail.load(std::memory_order_acquire);
+			if (required > buffer.capacity - (head - buffer.cached_tail))
+			{
+				buffer.dropped_count.fetch_add(1, std::memory_order_relaxed);
+				return nullptr;
+			}
+		}
+
+		if (skipped >= sizeof(RecordHeader))
+		{
+			const RecordHeader skip{};
+			std::memcpy(buffer.storage.get() + offset, &skip, sizeof(skip));
+		}
+		buffer.reserved = required;
+		return buffer.storage.get() + (offset + skipped) % buffer.capacity;
+	}
+
+	void Logger::commit(ThreadBuffer& buffer) noexcept
+	{
+		buffer.head.store(buffer.head.load(std::memory_order_relaxed) + buffer.reserved, std::memory_order_release);
+	}
+
+	void Logger::run(const std::stop_token& stop_token)
+	{
+		while (!stop_token.stop_requested())
+		{
+			if (!drain())
+			{
+				std::this_thread::sleep_for(k_poll_interval);
+			}
+		}
+
+		// Everything the producers committed before close is still written
+		drain();
+		const std::scoped_lock lock{ m_drain_mutex };
+		m_file.flush();
+	}
+
+	bool Logger::drain()
+	{
+		const std::scoped_lock drain_lock{ m_drain_mutex };
+
+		// Buffers are never removed, so the list is copied and the lock released before any formatting or file I/O.
+		// A thread logging its first record only waits for the copy.
+		{
+			const std::scoped_lock buffers_lock{ m_buffers_mutex };
+			m_drain_buffers.clear();
+			for (const auto& buffer : m_buffers)
+			{
+				m_drain_buffers.push_back(buffer.get());
+			}
+		}
+
+		auto drained = false;
+		for (auto* buffer : m_drain_buffers)
+		{
+			const auto dropped_count = buffer->dropped_count.load(std::memory_order_relaxed);
+			if (dropped_count != buffer->reported_dropped_count)
+			{
+				m_line.clear();
+				m_line += "[logger] ";
+				detail::LogArgument<UInt64>::append_value(m_line, dropped_count - buffer->reported_dropped_count);
+				m_line += " records dropped on thread ";
+				detail::LogArgument<UInt32>::append_value(m_line, buffer->thread_index);
+				m_line += '\n';
+				m_file.write(m_line.data(), static_cast<std::streamsize>(m_line.size()));
+				buffer->reported_dropped_count = dropped_count;
+			}
+
+			const auto head = buffer->head.load(std::memory_order_acquire);
+			auto tail = buffer->tail.load(std::memory_order_relaxed);
+			if (tail == head)
+			{
+				continue;
+			}
+
+			m_line.clear();
+			while (tail != head)
+			{
+				const auto offset = tail & (buffer->capacity - 1);
+				const auto remaining = buffer->capacity - offset;
+				RecordHeader header{};
+				if (remaining >= sizeof(RecordHeader))
+				{
+					std::memcpy(&header, buffer->storage.get() + offset, sizeof(header));
+				}
+				if (header.site == nullptr)
+				{
+					tail += remaining;
+					continue;
+				}
+
+				write_record(*buffer, header, buffer->storage.get() + offset + sizeof(header));
+				tail += header.size;
+			}
+
+			m_file.write(m_line.data(), static_cast<std::streamsize>(m_line.size()));
+			buffer->tail.store(tail, std::memory_order_release);
+			drained = true;
+		}
+		return drained;
+	}
+
+	void Logger::write_record(const ThreadBuffer& buffer, const RecordHeader& header, const std::byte* arguments)
+	{
+		// Seconds with microseconds since the logger was created, then level and thread
+		const auto microseconds = header.timestamp / 1000;
+		char fraction[8];
+		const auto fraction_end = std::to_chars(std::begin(fraction), std::end(fraction), microseconds % 1000000).ptr;
+
+		m_line += '[';
+		detail::LogArgument<UInt64>::append_value(m_line, microseconds / 1000000);
+		m_line += '.';
+		m_line.append(static_cast<size_type>(6 - (fraction_end - fraction)), '0');
+		m_line.append(fraction, fraction_end);
+		m_line += "] [";
+		m_line += k_level_names[static_cast<std::size_t>(header.level)];
+		m_line += "] [";
+		detail::LogArgument<UInt32>::append_value(m_line, buffer.thread_index);
+		m_line += "] ";
+		header.site->append_message(m_line, header.site->format, arguments);
+		m_line += '\n';
+		m_written_count.fetch_add(1, std::memory_order_relaxed);
+	}
+}
\ No newline at end of file
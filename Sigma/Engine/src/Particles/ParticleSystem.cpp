@@ -0,0 +1,235 @@
+#include "Sigma/Engine/Particles/ParticleSystem.hpp"
+
+#include <algorithm>
+#include <initializer_list>
+#include <utility>
+
+#include "Sigma/Engine/Jobs/ChunkedCompaction.hpp"
+
+#if defined(_XM_SSE_INTRINSICS_)
+#include <immintrin.h>
+#endif
+
+namespace sigma
+{
+	namespace
+	{
+		// PCG output hash, cheap enough to draw every random value of a particle from its index
+		[[nodiscard]] UInt32 hash(UInt32 value) noexcept
+		{
+			value = value * 747796405u + 2891336453u;
+			const auto word = ((value >> ((value >> 28u) + 4u)) ^ value) * 277803737u;
+			return (word >> 22u) ^ word;
+		}
+
+		// Uniform in [-1, 1)
+		[[nodiscard]] Float get_signed_unit(const UInt32 value) noexcept
+		{
+			return static_cast<Float>(hash(value) >> 8) / 8388608.0f - 1.0f;
+		}
+
+		void integrate_axis(Float* position, Float* velocity, const Float gravity, const Float time_step, std::size_t index, const std::size_t end) noexcept
+		{
+#if defined(__AVX__)
+			{
+				const auto step = _mm256_set1_ps(time_step);
+				const auto acceleration = _mm256_set1_ps(gravity * time_step);
+				for (; index + 8 <= end; index += 8)
+				{
+					const auto new_velocity = _mm256_add_ps(_mm256_loadu_ps(velocity + index), acceleration);
+					_mm256_storeu_ps(velocity + index, new_velocity);
+					_mm256_storeu_ps(position + index, _mm256_add_ps(_mm256_loadu_ps(position + index), _mm256_mul_ps(new_velocity, step)));
+				}
+			}
+#endif
+
+#if defined(_XM_SSE_INTRINSICS_)
+			{
+				const auto step = _mm_set1_ps(time_step);
+				const auto acceleration = _mm_set1_ps(gravity * time_step);
+				for (; index + 4 <= end; index += 4)
+				{
+					const auto new_velocity = _mm_add_ps(_mm_loadu_ps(velocity + index), acceleration);
+					_mm_storeu_ps(velocity + index, new_velocity);
+					_mm_storeu_ps(position + index, _mm_add_ps(_mm_loadu_ps(position + index), _mm_mul_ps(new_velocity, step)));
+				}
+			}
+#endif
+
+			for (; index < end; ++index)
+			{
+				velocity[index] += gravity * time_step;
+				position[index] += velocity[index] * time_step;
+			}
+		}
+
+		void advance(Float* age, const Float time_step, std::size_t index, const std::size_t end) noexcept
+		{
+#if defined(__AVX__)
+			for (; index + 8 <= end; index += 8)
+			{
+				_mm256_storeu_ps(age + index, _mm256_add_ps(_mm256_loadu_ps(age + index), _mm256_set1_ps(time_step)));
+			}
+#endif
+
+#if defined(_XM_SSE_INTRINSICS_)
+			for (; index + 4 <= end; index += 4)
+			{
+				_mm_storeu_ps(age + index, _mm_add_ps(_mm_loadu_ps(age + index), _mm_set1_ps(time_step)));
+			}
+#endif
+
+			for (; index < end; ++index)
+			{
+				age[index] += time_step;
+			}
+		}
+	}
+
+	ParticleSystem::ParticleSystem(const size_type capacity)
+		: m_capacity{ capacity }
+	{
+		for (auto* streams : { &m_current, &m_next })
+		{
+			for (auto& stream : streams->floats)
+			{
+				stream.resize(capacity);
+			}
+			streams->color.resize(capacity);
+		}
+		m_survivors.resize(capacity);
+	}
+
+	ParticleSystem::size_type ParticleSystem::emit(const ParticleEmitter& emitter, size_type count, const UInt32 seed, JobSystem& job_system)
+	{
+		count = std::min(count, m_capacity - m_size);
+		const auto first = m_size;
+		auto& floats = m_current.floats;
+		const auto base = hash(seed);
+		job_system.parallel_for(first, first + count, k_chunk_size, [&](const size_type begin, const size_type end)
+		{
+			for (auto index = begin; index < end; ++index)
+			{
+				const auto key = base + static_cast<UInt32>(index - first) * 8u;
+				floats[position_x][index] = emitter.position.x + get_signed_unit(key) * emitter.spread;
+				floats[position_y][index] = emitter.position.y + get_signed_unit(key + 1) * emitter.spread;
+				floats[position_z][index] = emitter.position.z + get_signed_unit(key + 2) * emitter.spread;
+				floats[velocity_x][index] = emitter.velocity.x + get_signed_unit(key + 3) * emitter.velocity_spread;
+				floats[velocity_y][index] = emitter.velocity.y + get_signed_unit(key + 4) * emitter.velocity_spread;
+				floats[velocity_z][index] = emitter.velocity.z + get_signed_unit(key + 5) * emitter.velocity_spread;
+				floats[age][index] = 0.0f;
+				floats[lifetime][index] = emitter.lifetime + get_signed_unit(key + 6) * emitter.lifetime_spread;
+				m_current.color[index] = emitter.color;
+			}
+		});
+
+		m_size += count;
+		return count;
+	}
+
+	void ParticleSystem::update(const Float time_step, const Vector3& gravity, JobSystem& job_system)
+	{
+		// Survivors are listed right after integration, while the chunk is still in cache
+		const auto survivor_count = detail::list_chunks(job_system, m_size, k_chunk_size, m_chunk_offsets, [&](size_type, const size_type begin, const size_type end)
+		{
+			integrate(time_step, gravity, begin, end);
+			return list_survivors(begin, end, m_survivors.data() + begin);
+		});
+
+		compact(survivor_count, job_system);
+	}
+
+	void ParticleSystem::clear() noexcept
+	{
+		m_size = 0;
+	}
+
+	ParticleSystem::size_type ParticleSystem::size() const noexcept
+	{
+		return m_size;
+	}
+
+	ParticleSystem::size_type ParticleSystem::capacity() const noexcept
+	{
+		return m_capacity;
+	}
+
+	ParticleStreams ParticleSystem::get_streams() const noexcept
+	{
+		const auto& floats = m_current.floats;
+		return {
+			floats[position_x].data(), floats[position_y].data(), floats[position_z].data(),
+			floats[velocity_x].data(), floats[velocity_y].data(), floats[velocity_z].data(),
+			floats[age].data(), floats[lifetime].data(), m_current.color.data(), m_size
+		};
+	}
+
+	void ParticleSystem::integrate(const Float time_step, const Vector3& gravity, const size_type begin, const size_type end) noexcept
+	{
+		auto& floats = m_current.floats;
+		integrate_axis(floats[position_x].data(), floats[velocity_x].data(), gravity.x, time_step, begin, end);
+		integrate_axis(floats[position_y].data(), floats[velocity_y].data(), gravity.y, time_step, begin, end);
+		integrate_axis(floats[position_z].data(), floats[velocity_z].data(), gravity.z, time_step, begin, end);
+		advance(floats[age].data(), time_step, begin, end);
+	}
+
+	ParticleSystem::size_type ParticleSystem::list_survivors(size_type index, const size_type end, UInt32* output) const noexcept
+	{
+		const auto* ages = m_current.floats[age].data();
+		const auto* lifetimes = m_current.floats[lifetime].data();
+		size_type count = 0;
+
+#if defined(__AVX__)
+		for (; index + 8 <= end; index += 8)
+		{
+			const auto alive = _mm256_cmp_ps(_mm256_loadu_ps(ages + index), _mm256_loadu_ps(lifetimes + index), _CMP_LT_OQ);
+			count = detail::append_lanes<8>(index, _mm256_movemask_ps(alive), output, count);
+		}
+#endif
+
+#if defined(_XM_SSE_INTRINSICS_)
+		for (; index + 4 <= end; index += 4)
+		{
+			const auto alive = _mm_cmplt_ps(_mm_loadu_ps(ages + index), _mm_loadu_ps(lifetimes + index));
+			count = detail::append_lanes<4>(index, _mm_movemask_ps(alive), output, count);
+		}
+#endif
+
+		for (; index < end; ++index)
+		{
+			output[count] = static_cast<UInt32>(index);
+			count += ages[index] < lifetimes[index] ? 1u : 0u;
+		}
+		return count;
+	}
+
+	void ParticleSystem::compact(const size_type survivor_count, JobSystem& job_system)
+	{
+		if (survivor_count == m_size)
+		{
+			return;
+		}
+
+		// Gathering into the other streams lets every chunk write its window without waiting on the chunks before it
+		detail::gather_chunks(job_system, m_chunk_offsets, [&](const size_type chunk, const size_type output, const size_type count)
+		{
+			const auto* survivors = m_survivors.data() + chunk * k_chunk_size;
+			for (size_type stream = 0; stream < stream_count; ++stream)
+			{
+				const auto* source = m_current.floats[stream].data();
+				auto* destination = m_next.floats[stream].data() + output;
+				for (size_type survivor = 0; survivor < count; ++survivor)
+				{
+					destination[survivor] = source[survivors[survivor]];
+				}
+			}
+			for (size_type survivor = 0; survivor < count; ++survivor)
+			{
+				m_next.color[output + survivor] = m_current.color[survivors[survivor]];
+			}
+		});
+
+		std::swap(m_current, m_next);
+		m_size = survivor_count;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,224 @@
+#include "Sigma/Engine/Physics/RigidBodies.hpp"
+
+#include <cmath>
+#include <initializer_list>
+
+#if defined(_XM_SSE_INTRINSICS_)
+#include <immintrin.h>
+#endif
+
+namespace sigma
+{
+	namespace
+	{
+		// One axis at a time, so every stream is walked linearly and the vector paths only need the one gravity lane
+		void integrate_axis(Float* position, Float* velocity, Float* force, const Float* inverse_mass, const Float gravity, const Float time_step, std::size_t index, const std::size_t end) noexcept
+		{
+#if defined(__AVX__)
+			{
+				const auto step = _mm256_set1_ps(time_step);
+				const auto gravity_lanes = _mm256_set1_ps(gravity);
+				for (; index + 8 <= end; index += 8)
+				{
+					const auto inverse = _mm256_loadu_ps(inverse_mass + index);
+					const auto dynamic = _mm256_cmp_ps(inverse, _mm256_setzero_ps(), _CMP_GT_OQ);
+					const auto acceleration = _mm256_add_ps(_mm256_and_ps(dynamic, gravity_lanes), _mm256_mul_ps(_mm256_loadu_ps(force + index), inverse));
+					const auto new_velocity = _mm256_add_ps(_mm256_loadu_ps(velocity + index), _mm256_mul_ps(acceleration, step));
+					_mm256_storeu_ps(velocity + index, new_velocity);
+					_mm256_storeu_ps(position + index, _mm256_add_ps(_mm256_loadu_ps(position + index), _mm256_mul_ps(new_velocity, step)));
+					_mm256_storeu_ps(force + index, _mm256_setzero_ps());
+				}
+			}
+#endif
+
+#if defined(_XM_SSE_INTRINSICS_)
+			{
+				const auto step = _mm_set1_ps(time_step);
+				const auto gravity_lanes = _mm_set1_ps(gravity);
+				for (; index + 4 <= end; index += 4)
+				{
+					const auto inverse = _mm_loadu_ps(inverse_mass + index);
+					const auto dynamic = _mm_cmpgt_ps(inverse, _mm_setzero_ps());
+					const auto acceleration = _mm_add_ps(_mm_and_ps(dynamic, gravity_lanes), _mm_mul_ps(_mm_loadu_ps(force + index), inverse));
+					const auto new_velocity = _mm_add_ps(_mm_loadu_ps(velocity + index), _mm_mul_ps(acceleration, step));
+					_mm_storeu_ps(velocity + index, new_velocity);
+					_mm_storeu_ps(position + index, _mm_add_ps(_mm_loadu_ps(position + index), _mm_mul_ps(new_velocity, step)));
+					_mm_storeu_ps(force + index, _mm_setzero_ps());
+				}
+			}
+#endif
+
+			for (; index < end; ++index)
+			{
+				const auto acceleration = (inverse_mass[index] > 0.0f ? gravity : 0.0f) + force[index] * inverse_mass[index];
+				velocity[index] += acceleration * time_step;
+				position[index] += velocity[index] * time_step;
+				force[index] = 0.0f;
+			}
+		}
+	}
+
+	RigidBodies::RigidBodies(const size_type capacity)
+		: m_slots{ capacity }
+	{
+		m_entities.reserve(capacity);
+		for (auto* stream : { &m_position_x, &m_position_y, &m_position_z, &m_velocity_x, &m_velocity_y, &m_velocity_z,
+			&m_force_x, &m_force_y, &m_force_z, &m_inverse_mass, &m_extent_x, &m_extent_y, &m_extent_z, &m_radius })
+		{
+			stream->reserve(capacity);
+		}
+	}
+
+	void RigidBodies::add(const Entity entity, const RigidBodyDesc& desc)
+	{
+		if (!contains(entity))
+		{
+			m_slots.emplace(entity, static_cast<UInt32>(m_entities.size()));
+			m_entities.push_back(entity);
+			for (auto* stream : { &m_position_x, &m_position_y, &m_position_z, &m_velocity_x, &m_velocity_y, &m_velocity_z,
+				&m_force_x, &m_force_y, &m_force_z, &m_inverse_mass, &m_extent_x, &m_extent_y, &m_extent_z, &m_radius })
+			{
+				stream->emplace_back();
+			}
+			++m_version;
+		}
+
+		const auto slot = m_slots[entity];
+		m_position_x[slot] = desc.position.x;
+		m_position_y[slot] = desc.position.y;
+		m_position_z[slot] = desc.position.z;
+		m_velocity_x[slot] = desc.velocity.x;
+		m_velocity_y[slot] = desc.velocity.y;
+		m_velocity_z[slot] = desc.velocity.z;
+		m_force_x[slot] = 0.0f;
+		m_force_y[slot] = 0.0f;
+		m_force_z[slot] = 0.0f;
+		m_inverse_mass[slot] = desc.mass > 0.0f ? 1.0f / desc.mass : 0.0f;
+		m_extent_x[slot] = desc.half_extents.x;
+		m_extent_y[slot] = desc.half_extents.y;
+		m_extent_z[slot] = desc.half_extents.z;
+		m_radius[slot] = std::sqrt(desc.half_extents.x * desc.half_extents.x + desc.half_extents.y * desc.half_extents.y + desc.half_extents.z * desc.half_extents.z);
+	}
+
+	void RigidBodies::erase(const Entity entity)
+	{
+		if (!contains(entity))
+		{
+			return;
+		}
+
+		const auto slot = m_slots[entity];
+		const auto last = m_entities.size() - 1;
+		for (auto* stream : { &m_position_x, &m_position_y, &m_position_z, &m_velocity_x, &m_velocity_y, &m_velocity_z,
+			&m_force_x, &m_force_y, &m_force_z, &m_inverse_mass, &m_extent_x, &m_extent_y, &m_extent_z, &m_radius })
+		{
+			(*stream)[slot] = stream->back();
+			stream->pop_back();
+		}
+
+		m_entities[slot] = m_entities[last];
+		m_entities.pop_back();
+		if (slot != last)
+		{
+			m_slots[m_entities[slot]] = slot;
+		}
+		m_slots.erase(entity);
+		++m_version;
+	}
+
+	RigidBodies::size_type RigidBodies::size() const noexcept
+	{
+		return m_entities.size();
+	}
+
+	bool RigidBodies::contains(const Entity entity) const noexcept
+	{
+		return m_slots.has_element(entity);
+	}
+
+	Entity RigidBodies::get_entity(const size_type index) const noexcept
+	{
+		return m_entities[index];
+	}
+
+	const std::vector<Entity>& RigidBodies::get_entities() const noexcept
+	{
+		return m_entities;
+	}
+
+	UInt64 RigidBodies::get_version() const noexcept
+	{
+		return m_version;
+	}
+
+	Vector3 RigidBodies::get_position(const Entity entity) const noexcept
+	{
+		const auto slot = m_slots[entity];
+		return { m_position_x[slot], m_position_y[slot], m_position_z[slot] };
+	}
+
+	Vector3 RigidBodies::get_velocity(const Entity entity) const noexcept
+	{
+		const auto slot = m_slots[entity];
+		return { m_velocity_x[slot], m_velocity_y[slot], m_velocity_z[slot] };
+	}
+
+	void RigidBodies::set_velocity(const Entity entity, const Vector3& velocity) noexcept
+	{
+		const auto slot = m_slots[entity];
+		m_velocity_x[slot] = velocity.x;
+		m_velocity_y[slot] = velocity.y;
+		m_velocity_z[slot] = velocity.z;
+	}
+
+	void RigidBodies::apply_force(const Entity entity, const Vector3& force) noexcept
+	{
+		const auto slot = m_slots[entity];
+		m_force_x[slot] += force.x;
+		m_force_y[slot] += force.y;
+		m_force_z[slot] += force.z;
+	}
+
+	Aabb RigidBodies::get_bounds(const Entity entity) const noexcept
+	{
+		const auto slot = m_slots[entity];
+		return {
+			{ m_position_x[slot] - m_extent_x[slot], m_position_y[slot] - m_extent_y[slot], m_position_z[slot] - m_extent_z[slot] },
+			{ m_position_x[slot] + m_extent_x[slot], m_position_y[slot] + m_extent_y[slot], m_position_z[slot] + m_extent_z[slot] }
+		};
+	}
+
+	RigidBodyStreams RigidBodies::get_streams() noexcept
+	{
+		return {
+			m_position_x.data(), m_position_y.data(), m_position_z.data(),
+			m_velocity_x.data(), m_velocity_y.data(), m_velocity_z.data(),
+			m_force_x.data(), m_force_y.data(), m_force_z.data(),
+			m_inverse_mass.data(), m_entities.size()
+		};
+	}
+
+	BoundsStreams RigidBodies::get_bounds_streams() const noexcept
+	{
+		return {
+			m_position_x.data(), m_position_y.data(), m_position_z.data(), m_radius.data(),
+			m_extent_x.data(), m_extent_y.data(), m_extent_z.data(), m_entities.size()
+		};
+	}
+
+	void RigidBodies::integrate(const Float time_step, const Vector3& gravity, JobSystem& job_system)
+	{
+		const auto streams = get_streams();
+		job_system.parallel_for(0, streams.size, k_chunk_size, [&](const size_type begin, const size_type end)
+		{
+			integrate(streams, time_step, gravity, begin, end);
+		});
+	}
+
+	void RigidBodies::integrate(const RigidBodyStreams& streams, const Float time_step, const Vector3& gravity, const size_type begin, const size_type end) noexcept
+	{
+		integrate_axis(streams.position_x, streams.velocity_x, streams.force_x, streams.inverse_mass, gravity.x, time_step, begin, end);
+		integrate_axis(streams.position_y, streams.velocity_y, streams.force_y, streams.inverse_mass, gravity.y, time_step, begin, end);
+		integrate_axis(streams.position_z, streams.velocity_z, streams.force_z, streams.inverse_mass, gravity.z, time_step, begin, end);
+	}
+}
\ No newline at end of file
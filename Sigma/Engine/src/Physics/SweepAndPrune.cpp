@@ -0,0 +1,170 @@
+#include "Sigma/Engine/Physics/SweepAndPrune.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <initializer_list>
+#include <numeric>
+
+#include "Sigma/Engine/Jobs/ChunkedCompaction.hpp"
+
+#if defined(_XM_SSE_INTRINSICS_)
+#include <immintrin.h>
+#endif
+
+namespace sigma
+{
+	namespace
+	{
+		// Returns false once the budget runs out, with order still a permutation but only partly sorted
+		[[nodiscard]] bool insertion_sort(std::vector<UInt32>& order, const std::vector<Float>& keys, std::size_t budget) noexcept
+		{
+			for (std::size_t position = 1; position < order.size(); ++position)
+			{
+				const auto slot = order[position];
+				const auto key = keys[slot];
+				auto target = position;
+				for (; target > 0 && keys[order[target - 1]] > key; --target)
+				{
+					order[target] = order[target - 1];
+					if (budget-- == 0)
+					{
+						order[target - 1] = slot;
+						return false;
+					}
+				}
+				order[target] = slot;
+			}
+			return true;
+		}
+	}
+
+	void SweepAndPrune::update(const RigidBodies& bodies, std::vector<ContactPair>& pairs, JobSystem& job_system)
+	{
+		const auto streams = bodies.get_bounds_streams();
+
+		m_keys.resize(streams.size);
+		job_system.parallel_for(0, streams.size, k_chunk_size * 8, [&](const size_type begin, const size_type end)
+		{
+			for (auto slot = begin; slot < end; ++slot)
+			{
+				m_keys[slot] = streams.center_x[slot] - streams.extent_x[slot];
+			}
+		});
+		sort(streams, bodies.get_version());
+
+		// Boxes in sweep order, so the inner loop reads consecutive floats instead of chasing slots
+		for (auto* stream : { &m_min_x, &m_max_x, &m_min_y, &m_max_y, &m_min_z, &m_max_z })
+		{
+			stream->resize(streams.size);
+		}
+		job_system.parallel_for(0, streams.size, k_chunk_size * 8, [&](const size_type begin, const size_type end)
+		{
+			for (auto position = begin; position < end; ++position)
+			{
+				const auto slot = m_order[position];
+				m_min_x[position] = m_keys[slot];
+				m_max_x[position] = streams.center_x[slot] + streams.extent_x[slot];
+				m_min_y[position] = streams.center_y[slot] - streams.extent_y[slot];
+				m_max_y[position] = streams.center_y[slot] + streams.extent_y[slot];
+				m_min_z[position] = streams.center_z[slot] - streams.extent_z[slot];
+				m_max_z[position] = streams.center_z[slot] + streams.extent_z[slot];
+			}
+		});
+
+		m_chunk_pairs.resize((streams.size + k_chunk_size - 1) / k_chunk_size);
+		const auto pair_count = detail::list_chunks(job_system, streams.size, k_chunk_size, m_chunk_offsets, [&](const size_type chunk, const size_type begin, const size_type end)
+		{
+			auto& chunk_pairs = m_chunk_pairs[chunk];
+			chunk_pairs.clear();
+			sweep_chunk(bodies, begin, end, chunk_pairs);
+			return chunk_pairs.size();
+		});
+
+		pairs.resize(pair_count);
+		detail::gather_chunks(job_system, m_chunk_offsets, [&](const size_type chunk, const size_type output, const size_type count)
+		{
+			std::memcpy(pairs.data() + output, m_chunk_pairs[chunk].data(), count * sizeof(ContactPair));
+		});
+	}
+
+	bool SweepAndPrune::was_fully_sorted() const noexcept
+	{
+		return m_fully_sorted;
+	}
+
+	void SweepAndPrune::sort(const BoundsStreams& streams, const UInt64 version)
+	{
+		// Erasing moves bodies between slots, so the previous order is only a good guess while the set is unchanged
+		m_fully_sorted = version != m_version || m_order.size() != streams.size;
+		if (m_fully_sorted)
+		{
+			m_order.resize(streams.size);
+			std::iota(m_order.begin(), m_order.end(), UInt32{ 0 });
+			m_version = version;
+		}
+		else if (!insertion_sort(m_order, m_keys, m_order.size() * k_resort_move_budget))
+		{
+			m_fully_sorted = true;
+		}
+
+		if (m_fully_sorted)
+		{
+			std::sort(m_order.begin(), m_order.end(), [&](const UInt32 lhs, const UInt32 rhs) { return m_keys[lhs] < m_keys[rhs]; });
+		}
+	}
+
+	void SweepAndPrune::sweep_chunk(const RigidBodies& bodies, const size_type begin, const size_type end, std::vector<ContactPair>& pairs) const
+	{
+		const auto count = m_min_x.size();
+		const auto& entities = bodies.get_entities();
+		const auto add_pair = [&](const size_type first, const size_type second)
+		{
+			pairs.push_back({ entities[m_order[first]], entities[m_order[second]] });
+		};
+
+		for (auto position = begin; position < end; ++position)
+		{
+			const auto max_x = m_max_x[position];
+			const auto min_y = m_min_y[position];
+			const auto max_y = m_max_y[position];
+			const auto min_z = m_min_z[position];
+			const auto max_z = m_max_z[position];
+			auto other = position + 1;
+
+#if defined(_XM_SSE_INTRINSICS_)
+			const auto max_x_lanes = _mm_set1_ps(max_x);
+			const auto min_y_lanes = _mm_set1_ps(min_y);
+			const auto max_y_lanes = _mm_set1_ps(max_y);
+			const auto min_z_lanes = _mm_set1_ps(min_z);
+			const auto max_z_lanes = _mm_set1_ps(max_z);
+			for (; other + 4 <= count; other += 4)
+			{
+				// Lanes past the end of the x range are also past it in every later lane, the boxes are sorted
+				const auto in_range = _mm_cmple_ps(_mm_loadu_ps(m_min_x.data() + other), max_x_lanes);
+				const auto overlap = _mm_and_ps(_mm_and_ps(in_range,
+					_mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(m_min_y.data() + other), max_y_lanes), _mm_cmpge_ps(_mm_loadu_ps(m_max_y.data() + other), min_y_lanes))),
+					_mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(m_min_z.data() + other), max_z_lanes), _mm_cmpge_ps(_mm_loadu_ps(m_max_z.data() + other), min_z_lanes)));
+
+				for (auto bits = static_cast<unsigned>(_mm_movemask_ps(overlap)); bits != 0; bits &= bits - 1)
+				{
+					add_pair(position, other + static_cast<size_type>(std::countr_zero(bits)));
+				}
+				if (_mm_movemask_ps(in_range) != 0xF)
+				{
+					other = count;
+					break;
+				}
+			}
+#endif
+
+			for (; other < count && m_min_x[other] <= max_x; ++other)
+			{
+				if (m_min_y[other] <= max_y && m_max_y[other] >= min_y && m_min_z[other] <= max_z && m_max_z[other] >= min_z)
+				{
+					add_pair(position, other);
+				}
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+#include "Sigma/Engine/Profiling/Profiler.hpp"
+
+namespace sigma
+{
+	namespace
+	{
+		[[nodiscard]] UInt64 to_nanoseconds(const Profiler::clock::duration duration) noexcept
+		{
+			return static_cast<UInt64>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+		}
+	}
+
+	Profiler::Profiler(const size_type capacity)
+		: m_samples{ capacity }
+	{
+	}
+
+	void Profiler::end_frame(const JobSystem& job_system)
+	{
+		const auto frame = m_frame_index.load(std::memory_order_relaxed);
+		const auto thread = get_thread_index();
+		const auto now = clock::now();
+		push({ ProfileSampleType::frame, thread, "Frame", frame, to_nanoseconds(now - m_frame_begin) });
+		m_frame_begin = now;
+
+		m_worker_busy_at_begin.resize(job_system.worker_count(), 0);
+		for (size_type worker = 0; worker < job_system.worker_count(); ++worker)
+		{
+			const auto busy = job_system.get_worker_busy_nanoseconds(worker);
+			// The worker index goes in the thread field so the consumer can tell the workers apart
+			push({ ProfileSampleType::worker, static_cast<UInt32>(worker), "Worker", frame, busy - m_worker_busy_at_begin[worker] });
+			m_worker_busy_at_begin[worker] = busy;
+		}
+
+		m_frame_index.store(frame + 1, std::memory_order_relaxed);
+	}
+
+	void Profiler::record_scope(const char* name, const clock::duration duration) noexcept
+	{
+		push({ ProfileSampleType::scope, get_thread_index(), name, m_frame_index.load(std::memory_order_relaxed), to_nanoseconds(duration) });
+	}
+
+	void Profiler::record_memory(const char* name, const size_type bytes) noexcept
+	{
+		push({ ProfileSampleType::memory, get_thread_index(), name, m_frame_index.load(std::memory_order_relaxed), bytes });
+	}
+
+	bool Profiler::try_pop(ProfileSample& sample) noexcept
+	{
+		return m_samples.try_pop(sample);
+	}
+
+	UInt64 Profiler::get_frame_index() const noexcept
+	{
+		return m_frame_index.load(std::memory_order_relaxed);
+	}
+
+	UInt64 Profiler::get_dropped_count() const noexcept
+	{
+		return m_dropped_count.load(std::memory_order_relaxed);
+	}
+
+	UInt32 Profiler::get_thread_index() noexcept
+	{
+		static std::atomic<UInt32> next_index{};
+		thread_local const auto index = next_index.fetch_add(1, std::memory_order_relaxed);
+		return index;
+	}
+
+	void Profiler::push(const ProfileSample& sample) noexcept
+	{
+		if (!m_samples.try_push(sample))
+		{
+			m_dropped_count.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	ProfileScope::ProfileScope(Profiler& profiler, const char* name) noexcept
+		: m_profiler{ profiler }
+		, m_name{ name }
+		, m_begin{ Profiler::clock::now() }
+	{
+	}
+
+	ProfileScope::~ProfileScope()
+	{
+		m_profiler.record_scope(m_name, Profiler::clock::now() - m_begin);
+	}
+}
\ No newline at end of file
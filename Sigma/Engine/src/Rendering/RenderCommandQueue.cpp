@@ -0,0 +1,89 @@
+#include "Sigma/Engine/Rendering/RenderCommandQueue.hpp"
+
+namespace sigma
+{
+	RenderFrame* RenderCommandQueue::begin_frame()
+	{
+		std::unique_lock lock{ m_mutex };
+		m_condition.wait(lock, [this]() { return m_closed || m_states[m_write_slot] == FrameState::free; });
+		if (m_closed)
+		{
+			return nullptr;
+		}
+
+		m_states[m_write_slot] = FrameState::building;
+		auto& frame = m_frames[m_write_slot];
+		frame.clear();
+		frame.set_frame_index(m_next_frame_index++);
+		return &frame;
+	}
+
+	void RenderCommandQueue::submit_frame()
+	{
+		{
+			const std::scoped_lock lock{ m_mutex };
+			m_states[m_write_slot] = FrameState::ready;
+			m_write_slot = (m_write_slot + 1) % k_frame_count;
+		}
+		m_condition.notify_all();
+	}
+
+	RenderFrame* RenderCommandQueue::acquire_frame()
+	{
+		std::unique_lock lock{ m_mutex };
+		m_condition.wait(lock, [this]() { return m_closed || m_states[m_read_slot] == FrameState::ready; });
+		if (m_states[m_read_slot] != FrameState::ready)
+		{
+			return nullptr;
+		}
+
+		m_states[m_read_slot] = FrameState::rendering;
+		return &m_frames[m_read_slot];
+	}
+
+	void RenderCommandQueue::release_frame()
+	{
+		{
+			const std::scoped_lock lock{ m_mutex };
+			m_states[m_read_slot] = FrameState::free;
+			m_read_slot = (m_read_slot + 1) % k_frame_count;
+		}
+		m_condition.notify_all();
+	}
+
+	void RenderCommandQueue::close()
+	{
+		{
+			const std::scoped_lock lock{ m_mutex };
+			m_closed = true;
+		}
+		m_condition.notify_all();
+	}
+
+	bool RenderCommandQueue::is_closed() const
+	{
+		const std::scoped_lock lock{ m_mutex };
+		return m_closed;
+	}
+
+	RenderThread::RenderThread(RenderCommandQueue& queue, callback_type callback)
+		: m_queue{ queue }, m_callback{ std::move(callback) }
+	{
+		m_thread = std::jthread{ [this]() { run(); } };
+	}
+
+	RenderThread::~RenderThread()
+	{
+		m_queue.close();
+	}
+
+	void RenderThread::run()
+	{
+		while (auto* frame = m_queue.acquire_frame())
+		{
+			frame->sort();
+			m_callback(*frame);
+			m_queue.release_frame();
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,101 @@
+#include "Sigma/Engine/Rendering/RenderFrame.hpp"
+
+#include <algorithm>
+#include <array>
+#include <span>
+
+namespace sigma
+{
+	void RenderFrame::clear() noexcept
+	{
+		m_commands.clear();
+		m_payloads.clear();
+	}
+
+	void RenderFrame::sort()
+	{
+		constexpr size_type k_radix = 256;
+		constexpr size_type k_pass_count = sizeof(UInt64);
+
+		// One read of the keys builds the histograms of all eight passes
+		std::array<std::array<size_type, k_radix>, k_pass_count> histograms{};
+		for (const auto& command : m_commands)
+		{
+			for (size_type pass = 0; pass < k_pass_count; ++pass)
+			{
+				++histograms[pass][(command.key >> (pass * 8)) & 0xFF];
+			}
+		}
+
+		m_sort_scratch.resize(m_commands.size());
+		auto* source = m_commands.data();
+		auto* destination = m_sort_scratch.data();
+		for (size_type pass = 0; pass < k_pass_count; ++pass)
+		{
+			auto& offsets = histograms[pass];
+			if (std::find(offsets.begin(), offsets.end(), m_commands.size()) != offsets.end())
+			{
+				continue;
+			}
+
+			size_type total = 0;
+			for (auto& offset : offsets)
+			{
+				const auto count = offset;
+				offset = total;
+				total += count;
+			}
+
+			const auto shift = pass * 8;
+			for (size_type index = 0; index < m_commands.size(); ++index)
+			{
+				destination[offsets[(source[index].key >> shift) & 0xFF]++] = source[index];
+			}
+			std::swap(source, destination);
+		}
+
+		if (source != m_commands.data())
+		{
+			m_commands.swap(m_sort_scratch);
+		}
+	}
+
+	RenderFrame::size_type RenderFrame::size() const noexcept
+	{
+		return m_commands.size();
+	}
+
+	const std::vector<RenderCommand>& RenderFrame::get_commands() const noexcept
+	{
+		return m_commands;
+	}
+
+	UInt64 RenderFrame::get_frame_index() const noexcept
+	{
+		return m_frame_index;
+	}
+
+	void RenderFrame::set_frame_index(const UInt64 frame_index) noexcept
+	{
+		m_frame_index = frame_index;
+	}
+
+	void draw(const RenderFrame& frame, SoftwareRasterizer& rasterizer)
+	{
+		for (const auto& command : frame.get_commands())
+		{
+			switch (command.type)
+			{
+			case RenderCommandType::draw_mesh:
+			{
+				const auto payload = frame.get_payload<DrawMeshCommand>(command);
+				rasterizer.draw(
+					std::span<const RasterVertex>{ payload.vertices, payload.vertex_count },
+					std::span<const UInt32>{ payload.indices, payload.index_count },
+					payload.world_view_projection);
+				break;
+			}
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+#include "Sigma/Engine/Rendering/RenderTarget.hpp"
+
+#include <fstream>
+#include <string>
+
+namespace sigma
+{
+	RenderTarget::RenderTarget(const size_type width, const size_type height)
+	{
+		resize(width, height);
+	}
+
+	void RenderTarget::resize(const size_type width, const size_type height)
+	{
+		m_width = width;
+		m_height = height;
+		m_stride = (width + k_alignment - 1) / k_alignment * k_alignment;
+		m_padded_height = (height + k_alignment - 1) / k_alignment * k_alignment;
+		m_color.assign(m_stride * m_padded_height, 0);
+		m_depth.assign(m_stride * m_padded_height, 1.0f);
+	}
+
+	RenderTarget::size_type RenderTarget::get_width() const noexcept
+	{
+		return m_width;
+	}
+
+	RenderTarget::size_type RenderTarget::get_height() const noexcept
+	{
+		return m_height;
+	}
+
+	RenderTarget::size_type RenderTarget::get_stride() const noexcept
+	{
+		return m_stride;
+	}
+
+	RenderTarget::size_type RenderTarget::get_padded_height() const noexcept
+	{
+		return m_padded_height;
+	}
+
+	UInt32* RenderTarget::get_color_data() noexcept
+	{
+		return m_color.data();
+	}
+
+	const UInt32* RenderTarget::get_color_data() const noexcept
+	{
+		return m_color.data();
+	}
+
+	Float* RenderTarget::get_depth_data() noexcept
+	{
+		return m_depth.data();
+	}
+
+	const Float* RenderTarget::get_depth_data() const noexcept
+	{
+		return m_depth.data();
+	}
+
+	UInt32 RenderTarget::get_color(const size_type x, const size_type y) const noexcept
+	{
+		return m_color[y * m_stride + x];
+	}
+
+	Float RenderTarget::get_depth(const size_type x, const size_type y) const noexcept
+	{
+		return m_depth[y * m_stride + x];
+	}
+
+	bool RenderTarget::save_ppm(const std::filesystem::path& path) const
+	{
+		std::ofstream file{ path, std::ios::binary };
+		if (!file)
+		{
+			return false;
+		}
+
+		file << "P6\n" << m_width << ' ' << m_height << "\n255\n";
+
+		std::string row(m_width * 3, '\0');
+		for (size_type y = 0; y < m_height; ++y)
+		{
+			for (size_type x = 0; x < m_width; ++x)
+			{
+				const auto color = get_color(x, y);
+				row[x * 3] = static_cast<char>((color >> 16) & 0xFF);
+				row[x * 3 + 1] = static_cast<char>((color >> 8) & 0xFF);
+				row[x * 3 + 2] = static_cast<char>(color & 0xFF);
+			}
+			file.write(row.data(), static_cast<std::streamsize>(row.size()));
+		}
+		return static_cast<bool>(file);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,461 @@
+#include "Sigma/Engine/Rendering/SoftwareRasterizer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#if defined(_XM_SSE_INTRINSICS_)
+#include <emmintrin.h>
+#endif
+
+namespace sigma
+{
+	namespace
+	{
+		// Screen positions are snapped to 1/16 of a pixel; the guard band keeps them small enough that the edge
+		// functions of a tile never leave the 32 bit range once their row start value is clamped
+		constexpr Int64 k_subpixel_bits = 4;
+		constexpr Int64 k_subpixel_scale = Int64{ 1 } << k_subpixel_bits;
+		constexpr Float k_guard_band_pixels = 8192.0f;
+		constexpr Int64 k_edge_limit = Int64{ 1 } << 30;
+		constexpr std::size_t k_max_clip_vertices = 9;
+
+		struct ClipPlane
+		{
+			Float x{};
+			Float y{};
+			Float z{};
+			Float w{};
+		};
+
+		[[nodiscard]] Float get_distance(const ClipPlane& plane, const Vector4& position) noexcept
+		{
+			return plane.x * position.x + plane.y * position.y + plane.z * position.z + plane.w * position.w;
+		}
+
+		[[nodiscard]] Vector4 lerp(const Vector4& a, const Vector4& b, const Float t) noexcept
+		{
+			return { a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t, a.z + (b.z - a.z) * t, a.w + (b.w - a.w) * t };
+		}
+
+		[[nodiscard]] Vector3 lerp(const Vector3& a, const Vector3& b, const Float t) noexcept
+		{
+			return { a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t, a.z + (b.z - a.z) * t };
+		}
+
+#if !defined(_XM_SSE_INTRINSICS_)
+		[[nodiscard]] UInt32 pack_color(const Float red, const Float green, const Float blue) noexcept
+		{
+			const auto to_byte = [](const Float value)
+			{
+				return static_cast<UInt32>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+			};
+			return 0xFF000000 | to_byte(red) << 16 | to_byte(green) << 8 | to_byte(blue);
+		}
+#endif
+
+		[[nodiscard]] Int32 clamp_edge(const Int64 value) noexcept
+		{
+			return static_cast<Int32>(std::clamp(value, -k_edge_limit, k_edge_limit));
+		}
+	}
+
+	void SoftwareRasterizer::set_cull_mode(const CullMode cull_mode) noexcept
+	{
+		m_cull_mode = cull_mode;
+	}
+
+	void SoftwareRasterizer::set_clear_color(const UInt32 color) noexcept
+	{
+		m_clear_color = color;
+	}
+
+	void SoftwareRasterizer::begin_frame()
+	{
+		m_draws.clear();
+		m_vertices.clear();
+		m_indices.clear();
+	}
+
+	void SoftwareRasterizer::draw(std::span<const RasterVertex> vertices, std::span<const UInt32> indices, const Matrix4x4& world_view_projection)
+	{
+		const auto first_vertex = m_vertices.size();
+		m_draws.push_back({ world_view_projection, first_vertex, vertices.size() });
+		m_vertices.insert(m_vertices.end(), vertices.begin(), vertices.end());
+
+		const auto first_index = m_indices.size();
+		m_indices.resize(first_index + indices.size() / 3 * 3);
+		for (size_type index = first_index; index < m_indices.size(); ++index)
+		{
+			m_indices[index] = static_cast<UInt32>(first_vertex + indices[index - first_index]);
+		}
+	}
+
+	void SoftwareRasterizer::render(RenderTarget& target, JobSystem& job_system)
+	{
+		m_tile_columns = target.get_stride() / k_tile_size;
+		m_tile_rows = target.get_padded_height() / k_tile_size;
+		m_guard_band = 2.0f * k_guard_band_pixels / static_cast<Float>(std::max<size_type>({ target.get_width(), target.get_height(), 1 }));
+
+		transform_vertices(job_system);
+
+		// Each chunk bins a contiguous range of triangles; tiles walk the chunks in order, which keeps submission order
+		const auto triangle_count = m_indices.size() / 3;
+		const auto chunk_count = std::max<size_type>(1, std::min(triangle_count / 256 + 1, (job_system.worker_count() + 1) * 4));
+		m_chunks.resize(chunk_count);
+		job_system.parallel_for(0, chunk_count, 1, [&](const size_type chunk_begin, const size_type chunk_end)
+		{
+			for (auto chunk = chunk_begin; chunk < chunk_end; ++chunk)
+			{
+				setup_triangles(m_chunks[chunk], triangle_count * chunk / chunk_count, triangle_count * (chunk + 1) / chunk_count, target);
+			}
+		});
+
+		job_system.parallel_for(0, m_tile_columns * m_tile_rows, 1, [&](const size_type tile_begin, const size_type tile_end)
+		{
+			for (auto tile = tile_begin; tile < tile_end; ++tile)
+			{
+				rasterize_tile(tile, target);
+			}
+		});
+	}
+
+	SoftwareRasterizer::size_type SoftwareRasterizer::get_triangle_count() const noexcept
+	{
+		size_type count = 0;
+		for (const auto& chunk : m_chunks)
+		{
+			count += chunk.triangles.size();
+		}
+		return count;
+	}
+
+	void SoftwareRasterizer::transform_vertices(JobSystem& job_system)
+	{
+		m_clip_vertices.resize(m_vertices.size());
+		job_system.parallel_for(0, m_vertices.size(), k_vertex_grain_size, [&](const size_type begin, const size_type end)
+		{
+			auto draw = std::upper_bound(m_draws.begin(), m_draws.end(), begin, [](const size_type vertex, const Draw& candidate)
+			{
+				return vertex < candidate.first_vertex;
+			}) - 1;
+
+			auto matrix = DirectX::XMLoadFloat4x4(&draw->world_view_projection);
+			for (auto vertex = begin; vertex < end; ++vertex)
+			{
+				while (vertex >= draw->first_vertex + draw->vertex_count)
+				{
+					++draw;
+					matrix = DirectX::XMLoadFloat4x4(&draw->world_view_projection);
+				}
+
+				const auto& source = m_vertices[vertex];
+				DirectX::XMStoreFloat4(&m_clip_vertices[vertex].position, DirectX::XMVector3Transform(DirectX::XMLoadFloat3(&source.position), matrix));
+				m_clip_vertices[vertex].color = source.color;
+			}
+		});
+	}
+
+	void SoftwareRasterizer::setup_triangles(BinningChunk& chunk, const size_type first_triangle, const size_type last_triangle, const RenderTarget& target)
+	{
+		chunk.triangles.clear();
+		chunk.bins.resize(m_tile_columns * m_tile_rows);
+		for (auto& bin : chunk.bins)
+		{
+			bin.clear();
+		}
+
+		const std::array<ClipPlane, 6> rejection_planes{ {
+			{ 1.0f, 0.0f, 0.0f, 1.0f }, { -1.0f, 0.0f, 0.0f, 1.0f },
+			{ 0.0f, 1.0f, 0.0f, 1.0f }, { 0.0f, -1.0f, 0.0f, 1.0f },
+			{ 0.0f, 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, -1.0f, 1.0f }
+		} };
+		const std::array<ClipPlane, 6> clip_planes{ {
+			{ 0.0f, 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, -1.0f, 1.0f },
+			{ 1.0f, 0.0f, 0.0f, m_guard_band }, { -1.0f, 0.0f, 0.0f, m_guard_band },
+			{ 0.0f, 1.0f, 0.0f, m_guard_band }, { 0.0f, -1.0f, 0.0f, m_guard_band }
+		} };
+
+		for (auto triangle = first_triangle; triangle < last_triangle; ++triangle)
+		{
+			const std::array<ClipVertex, 3> corners{
+				m_clip_vertices[m_indices[triangle * 3]], m_clip_vertices[m_indices[triangle * 3 + 1]], m_clip_vertices[m_indices[triangle * 3 + 2]]
+			};
+
+			const auto is_outside = [&](const ClipPlane& plane)
+			{
+				return std::all_of(corners.begin(), corners.end(), [&](const ClipVertex& corner) { return get_distance(plane, corner.position) < 0.0f; });
+			};
+			if (std::any_of(rejection_planes.begin(), rejection_planes.end(), is_outside))
+			{
+				continue;
+			}
+
+			const auto needs_clipping = std::any_of(clip_planes.begin(), clip_planes.end(), [&](const ClipPlane& plane)
+			{
+				return std::any_of(corners.begin(), corners.end(), [&](const ClipVertex& corner) { return get_distance(plane, corner.position) < 0.0f; });
+			});
+			if (!needs_clipping)
+			{
+				setup_triangle(chunk, corners[0], corners[1], corners[2], target);
+				continue;
+			}
+
+			// Sutherland-Hodgman against the near, far and guard band planes, then fan the polygon back into triangles
+			std::array<ClipVertex, k_max_clip_vertices> polygon{ corners[0], corners[1], corners[2] };
+			std::array<ClipVertex, k_max_clip_vertices> clipped{};
+			size_type polygon_size = 3;
+			for (const auto& plane : clip_planes)
+			{
+				size_type clipped_size = 0;
+				for (size_type current = 0; current < polygon_size; ++current)
+				{
+					const auto& from = polygon[current];
+					const auto& to = polygon[(current + 1) % polygon_size];
+					const auto from_distance = get_distance(plane, from.position);
+					const auto to_distance = get_distance(plane, to.position);
+					if (from_distance >= 0.0f)
+					{
+						clipped[clipped_size++] = from;
+					}
+					if ((from_distance >= 0.0f) != (to_distance >= 0.0f))
+					{
+						const auto t = from_distance / (from_distance - to_distance);
+						clipped[clipped_size++] = { lerp(from.position, to.position, t), lerp(from.color, to.color, t) };
+					}
+				}
+				polygon = clipped;
+				polygon_size = clipped_size;
+				if (polygon_size < 3)
+				{
+					break;
+				}
+			}
+
+			for (size_type vertex = 2; vertex < polygon_size; ++vertex)
+			{
+				setup_triangle(chunk, polygon[0], polygon[vertex - 1], polygon[vertex], target);
+			}
+		}
+	}
+
+	void SoftwareRasterizer::setup_triangle(BinningChunk& chunk, const ClipVertex& a, const ClipVertex& b, const ClipVertex& c, const RenderTarget& target)
+	{
+		struct ScreenVertex
+		{
+			Int64 x{};
+			Int64 y{};
+			Float attributes[5]{};
+		};
+
+		const auto width = static_cast<Float>(target.get_width());
+		const auto height = static_cast<Float>(target.get_height());
+		const auto to_screen = [&](const ClipVertex& vertex)
+		{
+			const auto inverse_w = 1.0f / vertex.position.w;
+			const auto x = (vertex.position.x * inverse_w * 0.5f + 0.5f) * width;
+			const auto y = (0.5f - vertex.position.y * inverse_w * 0.5f) * height;
+			return ScreenVertex{
+				std::llround(x * static_cast<Float>(k_subpixel_scale)), std::llround(y * static_cast<Float>(k_subpixel_scale)),
+				{ vertex.position.z * inverse_w, inverse_w, vertex.color.x * inverse_w, vertex.color.y * inverse_w, vertex.color.z * inverse_w }
+			};
+		};
+
+		auto v0 = to_screen(a);
+		auto v1 = to_screen(b);
+		auto v2 = to_screen(c);
+
+		auto area = (v1.x - v0.x) * (v2.y - v0.y) - (v1.y - v0.y) * (v2.x - v0.x);
+		if (area == 0 || (area < 0 && m_cull_mode == CullMode::back))
+		{
+			return;
+		}
+		if (area < 0)
+		{
+			std::swap(v1, v2);
+			area = -area;
+		}
+
+		ScreenTriangle triangle{};
+		triangle.min_x = static_cast<Int32>(std::max<Int64>(std::min({ v0.x, v1.x, v2.x }) >> k_subpixel_bits, 0));
+		triangle.min_y = static_cast<Int32>(std::max<Int64>(std::min({ v0.y, v1.y, v2.y }) >> k_subpixel_bits, 0));
+		triangle.max_x = static_cast<Int32>(std::min<Int64>(std::max({ v0.x, v1.x, v2.x }) >> k_subpixel_bits, static_cast<Int64>(target.get_width()) - 1));
+		triangle.max_y = static_cast<Int32>(std::min<Int64>(std::max({ v0.y, v1.y, v2.y }) >> k_subpixel_bits, static_cast<Int64>(target.get_height()) - 1));
+		if (triangle.min_x > triangle.max_x || triangle.min_y > triangle.max_y)
+		{
+			return;
+		}
+
+		// Top-left fill rule: pixels exactly on an edge belong to the triangle only for top and left edges
+		const auto make_edge = [](const ScreenVertex& from, const ScreenVertex& to)
+		{
+			const auto step_x = from.y - to.y;
+			const auto step_y = to.x - from.x;
+			const auto is_top_left = step_x > 0 || (step_x == 0 && step_y > 0);
+			return Edge{ step_x, step_y, from.x, from.y, is_top_left ? 0 : -1 };
+		};
+		triangle.edges[0] = make_edge(v1, v2);
+		triangle.edges[1] = make_edge(v2, v0);
+		triangle.edges[2] = make_edge(v0, v1);
+
+		const auto scale = 1.0f / static_cast<Float>(k_subpixel_scale);
+		const auto x1 = static_cast<Float>(v1.x - v0.x) * scale;
+		const auto y1 = static_cast<Float>(v1.y - v0.y) * scale;
+		const auto x2 = static_cast<Float>(v2.x - v0.x) * scale;
+		const auto y2 = static_cast<Float>(v2.y - v0.y) * scale;
+		const auto inverse_area = 1.0f / (x1 * y2 - y1 * x2);
+		triangle.origin_x = static_cast<Float>(v0.x) * scale;
+		triangle.origin_y = static_cast<Float>(v0.y) * scale;
+		for (size_type attribute = 0; attribute < 5; ++attribute)
+		{
+			const auto delta1 = v1.attributes[attribute] - v0.attributes[attribute];
+			const auto delta2 = v2.attributes[attribute] - v0.attributes[attribute];
+			triangle.planes[attribute] = {
+				v0.attributes[attribute],
+				(delta1 * y2 - delta2 * y1) * inverse_area,
+				(delta2 * x1 - delta1 * x2) * inverse_area
+			};
+		}
+
+		const auto index = static_cast<UInt32>(chunk.triangles.size());
+		chunk.triangles.push_back(triangle);
+		for (auto tile_y = static_cast<size_type>(triangle.min_y) / k_tile_size; tile_y <= static_cast<size_type>(triangle.max_y) / k_tile_size; ++tile_y)
+		{
+			for (auto tile_x = static_cast<size_type>(triangle.min_x) / k_tile_size; tile_x <= static_cast<size_type>(triangle.max_x) / k_tile_size; ++tile_x)
+			{
+				chunk.bins[tile_y * m_tile_columns + tile_x].push_back(index);
+			}
+		}
+	}
+
+	void SoftwareRasterizer::rasterize_tile(const size_type tile, RenderTarget& target) const
+	{
+		const auto stride = target.get_stride();
+		const auto tile_x = static_cast<Int32>(tile % m_tile_columns * k_tile_size);
+		const auto tile_y = static_cast<Int32>(tile / m_tile_columns * k_tile_size);
+		const auto tile_extent = static_cast<Int32>(k_tile_size);
+
+		for (auto y = tile_y; y < tile_y + tile_extent; ++y)
+		{
+			const auto offset = static_cast<size_type>(y) * stride + static_cast<size_type>(tile_x);
+			std::fill_n(target.get_color_data() + offset, k_tile_size, m_clear_color);
+			std::fill_n(target.get_depth_data() + offset, k_tile_size, 1.0f);
+		}
+
+		for (const auto& chunk : m_chunks)
+		{
+			for (const auto index : chunk.bins[tile])
+			{
+				const auto& triangle = chunk.triangles[index];
+				// Quads start on a multiple of four so they never straddle a tile
+				const auto min_x = std::max(triangle.min_x, tile_x) & ~Int32{ 3 };
+				const auto max_x = std::min(triangle.max_x, tile_x + tile_extent - 1);
+				const auto min_y = std::max(triangle.min_y, tile_y);
+				const auto max_y = std::min(triangle.max_y, tile_y + tile_extent - 1);
+
+				for (auto y = min_y; y <= max_y; ++y)
+				{
+					const auto sample_x = Int64{ min_x } * k_subpixel_scale + k_subpixel_scale / 2;
+					const auto sample_y = Int64{ y } * k_subpixel_scale + k_subpixel_scale / 2;
+					Int32 row_edges[3]{};
+					Int32 edge_steps[3]{};
+					for (size_type edge = 0; edge < 3; ++edge)
+					{
+						const auto& setup = triangle.edges[edge];
+						row_edges[edge] = clamp_edge(setup.a * (sample_x - setup.origin_x) + setup.b * (sample_y - setup.origin_y) + setup.bias);
+						edge_steps[edge] = static_cast<Int32>(setup.a * k_subpixel_scale);
+					}
+
+					const auto delta_x = static_cast<Float>(min_x) + 0.5f - triangle.origin_x;
+					const auto delta_y = static_cast<Float>(y) + 0.5f - triangle.origin_y;
+					Float row_values[5]{};
+					for (size_type attribute = 0; attribute < 5; ++attribute)
+					{
+						const auto& plane = triangle.planes[attribute];
+						row_values[attribute] = plane.origin + plane.step_x * delta_x + plane.step_y * delta_y;
+					}
+
+					auto* color_row = target.get_color_data() + static_cast<size_type>(y) * stride;
+					auto* depth_row = target.get_depth_data() + static_cast<size_type>(y) * stride;
+
+#if defined(_XM_SSE_INTRINSICS_)
+					const auto float_lanes = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+					const auto minus_one = _mm_set1_epi32(-1);
+					__m128i edges[3];
+					__m128i quad_steps[3];
+					for (size_type edge = 0; edge < 3; ++edge)
+					{
+						const auto step = edge_steps[edge];
+						edges[edge] = _mm_setr_epi32(row_edges[edge], row_edges[edge] + step, row_edges[edge] + 2 * step, row_edges[edge] + 3 * step);
+						quad_steps[edge] = _mm_set1_epi32(4 * step);
+					}
+					__m128 values[5];
+					__m128 value_steps[5];
+					for (size_type attribute = 0; attribute < 5; ++attribute)
+					{
+						const auto step = _mm_set1_ps(triangle.planes[attribute].step_x);
+						values[attribute] = _mm_add_ps(_mm_set1_ps(row_values[attribute]), _mm_mul_ps(float_lanes, step));
+						value_steps[attribute] = _mm_mul_ps(step, _mm_set1_ps(4.0f));
+					}
+
+					for (auto x = min_x; x <= max_x; x += 4)
+					{
+						const auto covered = _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi32(edges[0], minus_one), _mm_cmpgt_epi32(edges[1], minus_one)), _mm_cmpgt_epi32(edges[2], minus_one));
+						if (_mm_movemask_epi8(covered) != 0)
+						{
+							auto* depth = depth_row + x;
+							const auto old_depth = _mm_loadu_ps(depth);
+							const auto pass = _mm_and_ps(_mm_castsi128_ps(covered), _mm_cmplt_ps(values[0], old_depth));
+							if (_mm_movemask_ps(pass) != 0)
+							{
+								_mm_storeu_ps(depth, _mm_or_ps(_mm_and_ps(pass, values[0]), _mm_andnot_ps(pass, old_depth)));
+
+								const auto w = _mm_div_ps(_mm_set1_ps(1.0f), values[1]);
+								const auto to_channel = [&](const __m128 value)
+								{
+									const auto channel = _mm_min_ps(_mm_max_ps(_mm_mul_ps(value, w), _mm_setzero_ps()), _mm_set1_ps(1.0f));
+									return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(channel, _mm_set1_ps(255.0f)), _mm_set1_ps(0.5f)));
+								};
+								const auto color = _mm_or_si128(_mm_or_si128(_mm_set1_epi32(static_cast<Int32>(0xFF000000)), _mm_slli_epi32(to_channel(values[2]), 16)),
+									_mm_or_si128(_mm_slli_epi32(to_channel(values[3]), 8), to_channel(values[4])));
+
+								auto* destination = reinterpret_cast<__m128i*>(color_row + x);
+								const auto pass_mask = _mm_castps_si128(pass);
+								_mm_storeu_si128(destination, _mm_or_si128(_mm_and_si128(pass_mask, color), _mm_andnot_si128(pass_mask, _mm_loadu_si128(destination))));
+							}
+						}
+
+						for (size_type edge = 0; edge < 3; ++edge)
+						{
+							edges[edge] = _mm_add_epi32(edges[edge], quad_steps[edge]);
+						}
+						for (size_type attribute = 0; attribute < 5; ++attribute)
+						{
+							values[attribute] = _mm_add_ps(values[attribute], value_steps[attribute]);
+						}
+					}
+#else
+					for (auto x = min_x; x <= max_x; ++x)
+					{
+						const auto lane = x - min_x;
+						const auto inside = row_edges[0] + edge_steps[0] * lane > -1 && row_edges[1] + edge_steps[1] * lane > -1 && row_edges[2] + edge_steps[2] * lane > -1;
+						const auto offset = static_cast<Float>(lane);
+						const auto depth = row_values[0] + triangle.planes[0].step_x * offset;
+						if (!inside || depth >= depth_row[x])
+						{
+							continue;
+						}
+
+						depth_row[x] = depth;
+						const auto w = 1.0f / (row_values[1] + triangle.planes[1].step_x * offset);
+						color_row[x] = pack_color(
+							(row_values[2] + triangle.planes[2].step_x * offset) * w,
+							(row_values[3] + triangle.planes[3].step_x * offset) * w,
+							(row_values[4] + triangle.planes[4].step_x * offset) * w);
+					}
+#endif
+				}
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,368 @@
+#include "Sigma/Engine/Scene/TransformHierarchy.hpp"
+
+#include <atomic>
+
+namespace sigma
+{
+	TransformHierarchy::TransformHierarchy(const size_type capacity)
+	{
+		reserve(capacity);
+	}
+
+	void TransformHierarchy::reserve(const size_type capacity)
+	{
+		m_nodes.reserve(capacity);
+		m_local.reserve(capacity);
+		m_world.reserve(capacity);
+		m_ticks.reserve(capacity);
+		m_links.reserve(capacity);
+	}
+
+	void TransformHierarchy::emplace(const Entity entity, const Matrix4x4& local, const Entity parent)
+	{
+		assert(!has_node(entity));
+		assert(parent == k_null_entity || has_node(parent));
+
+		m_nodes.emplace(entity, TransformNode{ entity, parent, k_no_slot, 0 });
+		m_local.emplace(entity, local);
+		m_world.emplace(entity, local);
+		m_ticks.emplace(entity, TransformTicks{ m_tick, 0 });
+		link_child(entity, parent);
+
+		m_structure_dirty = true;
+	}
+
+	void TransformHierarchy::erase(const Entity entity)
+	{
+		if (!has_node(entity))
+		{
+			return;
+		}
+
+		// Erasing a node takes its whole subtree with it
+		unlink_child(entity, m_nodes[entity].parent);
+		std::vector<Entity> subtree{ entity };
+		for (size_type visited = 0; visited < subtree.size(); ++visited)
+		{
+			for (auto child = m_links[subtree[visited]].first_child; child != k_null_entity; child = m_links[child].next_sibling)
+			{
+				subtree.push_back(child);
+			}
+		}
+
+		// One batch per pool, so a large subtree costs a few passes rather than one search per node
+		m_nodes.erase(subtree);
+		m_local.erase(subtree);
+		m_world.erase(subtree);
+		m_ticks.erase(subtree);
+		for (const auto removed : subtree)
+		{
+			m_links[removed] = ChildLinks{};
+		}
+
+		m_structure_dirty = true;
+	}
+
+	void TransformHierarchy::set_parent(const Entity entity, const Entity parent)
+	{
+		assert(has_node(entity));
+		assert(parent == k_null_entity || has_node(parent));
+
+		for (auto ancestor = parent; ancestor != k_null_entity; ancestor = m_nodes[ancestor].parent)
+		{
+			assert(ancestor != entity && "set_parent would create a cycle");
+		}
+
+		unlink_child(entity, m_nodes[entity].parent);
+		link_child(entity, parent);
+		m_nodes[entity].parent = parent;
+		m_ticks[entity].local_changed = m_tick;
+		m_structure_dirty = true;
+	}
+
+	void TransformHierarchy::set_local(const Entity entity, const Matrix4x4& local)
+	{
+		m_local[entity] = local;
+		mark_dirty(entity);
+	}
+
+	template <typename LevelFunction>
+	void TransformHierarchy::propagate(LevelFunction&& update_level)
+	{
+		if (m_structure_dirty)
+		{
+			sort_breadth_first();
+		}
+
+		// Levels above the shallowest change are skipped outright. Below the deepest local change, a level in which
+		// nothing was recomputed means every subtree underneath is unchanged as well.
+		for (auto depth = m_first_dirty_depth; depth < level_count(); ++depth)
+		{
+			const auto updated = update_level(m_level_offsets[depth], m_level_offsets[depth + 1]);
+			if (updated == 0 && depth >= m_last_dirty_depth)
+			{
+				break;
+			}
+		}
+
+		m_first_dirty_depth = k_no_slot;
+		m_last_dirty_depth = 0;
+		++m_tick;
+	}
+
+	void TransformHierarchy::update()
+	{
+		propagate([this](const size_type begin, const size_type end)
+		{
+			return update_range(begin, end);
+		});
+	}
+
+	void TransformHierarchy::update(JobSystem& job_system)
+	{
+		propagate([&](const size_type begin, const size_type end)
+		{
+			std::atomic<size_type> updated{};
+			job_system.parallel_for(begin, end, k_update_grain_size,
+				[&](const size_type chunk_begin, const size_type chunk_end)
+				{
+					updated.fetch_add(update_range(chunk_begin, chunk_end), std::memory_order_relaxed);
+				}
+			);
+			return updated.load(std::memory_order_relaxed);
+		});
+	}
+
+	TransformHierarchy::size_type TransformHierarchy::size() const noexcept
+	{
+		return m_nodes.size();
+	}
+
+	TransformHierarchy::size_type TransformHierarchy::level_count() const noexcept
+	{
+		return m_level_offsets.empty() ? 0 : m_level_offsets.size() - 1;
+	}
+
+	UInt64 TransformHierarchy::get_tick() const noexcept
+	{
+		return m_tick;
+	}
+
+	UInt64 TransformHierarchy::get_structure_tick() const noexcept
+	{
+		return m_structure_tick;
+	}
+
+	bool TransformHierarchy::has_node(const Entity entity) const noexcept
+	{
+		return m_nodes.has_element(entity);
+	}
+
+	Entity TransformHierarchy::get_parent(const Entity entity) const noexcept
+	{
+		return m_nodes[entity].parent;
+	}
+
+	const Matrix4x4& TransformHierarchy::get_local(const Entity entity) const noexcept
+	{
+		return m_local[entity];
+	}
+
+	const Matrix4x4& TransformHierarchy::get_world(const Entity entity) const noexcept
+	{
+		return m_world[entity];
+	}
+
+	UInt64 TransformHierarchy::get_world_change_tick(const Entity entity) const noexcept
+	{
+		return m_ticks[entity].world_changed;
+	}
+
+	const SparseSet<TransformNode>& TransformHierarchy::get_nodes() const noexcept
+	{
+		return m_nodes;
+	}
+
+	const SparseSet<Matrix4x4>& TransformHierarchy::get_world_pool() const noexcept
+	{
+		return m_world;
+	}
+
+	const SparseSet<TransformTicks>& TransformHierarchy::get_ticks() const noexcept
+	{
+		return m_ticks;
+	}
+
+	void TransformHierarchy::link_child(const Entity entity, const Entity parent)
+	{
+		// The parent was emplaced before, so it already has links
+		if (m_links.size() <= entity)
+		{
+			m_links.resize(entity + 1);
+		}
+		if (parent == k_null_entity)
+		{
+			return;
+		}
+
+		auto& links = m_links[entity];
+		links.previous_sibling = k_null_entity;
+		links.next_sibling = m_links[parent].first_child;
+		if (links.next_sibling != k_null_entity)
+		{
+			m_links[links.next_sibling].previous_sibling = entity;
+		}
+		m_links[parent].first_child = entity;
+	}
+
+	void TransformHierarchy::unlink_child(const Entity entity, const Entity parent) noexcept
+	{
+		if (parent == k_null_entity)
+		{
+			return;
+		}
+
+		auto& links = m_links[entity];
+		if (links.previous_sibling == k_null_entity)
+		{
+			m_links[parent].first_child = links.next_sibling;
+		}
+		else
+		{
+			m_links[links.previous_sibling].next_sibling = links.next_sibling;
+		}
+		if (links.next_sibling != k_null_entity)
+		{
+			m_links[links.next_sibling].previous_sibling = links.previous_sibling;
+		}
+		links.next_sibling = k_null_entity;
+		links.previous_sibling = k_null_entity;
+	}
+
+	void TransformHierarchy::mark_dirty(const Entity entity) noexcept
+	{
+		m_ticks[entity].local_changed = m_tick;
+
+		if (!m_structure_dirty)
+		{
+			const size_type depth = m_nodes[entity].depth;
+			m_first_dirty_depth = std::min(m_first_dirty_depth, depth);
+			m_last_dirty_depth = std::max(m_last_dirty_depth, depth);
+		}
+	}
+
+	void TransformHierarchy::sort_breadth_first()
+	{
+		const auto count = m_nodes.size();
+		const auto nodes = m_nodes.data();
+
+		// Children of every dense slot, laid out contiguously (compressed sparse rows)
+		std::vector<size_type> child_offsets(count + 1, 0);
+		for (size_type slot = 0; slot < count; ++slot)
+		{
+			if (nodes[slot].parent != k_null_entity)
+			{
+				++child_offsets[m_nodes.get_dense_index(nodes[slot].parent) + 1];
+			}
+		}
+		std::partial_sum(child_offsets.begin(), child_offsets.end(), child_offsets.begin());
+
+		std::vector<size_type> children(count);
+		std::vector<size_type> fill_positions(child_offsets.begin(), child_offsets.end() - 1);
+		for (size_type slot = 0; slot < count; ++slot)
+		{
+			if (nodes[slot].parent != k_null_entity)
+			{
+				children[fill_positions[m_nodes.get_dense_index(nodes[slot].parent)]++] = slot;
+			}
+		}
+
+		std::vector<size_type> order{};
+		order.reserve(count);
+		for (size_type slot = 0; slot < count; ++slot)
+		{
+			if (nodes[slot].parent == k_null_entity)
+			{
+				nodes[slot].depth = 0;
+				order.push_back(slot);
+			}
+		}
+
+		for (size_type visited = 0; visited < order.size(); ++visited)
+		{
+			const auto slot = order[visited];
+			for (auto child = child_offsets[slot]; child < child_offsets[slot + 1]; ++child)
+			{
+				nodes[children[child]].depth = nodes[slot].depth + 1;
+				order.push_back(children[child]);
+			}
+		}
+		assert(order.size() == count && "transform hierarchy contains a cycle");
+
+		m_nodes.reorder(order);
+		m_local.reorder(order);
+		m_world.reorder(order);
+		m_ticks.reorder(order);
+
+		m_level_offsets.clear();
+		m_first_dirty_depth = k_no_slot;
+		m_last_dirty_depth = 0;
+
+		const auto sorted_nodes = m_nodes.data();
+		const auto ticks = m_ticks.data();
+		for (size_type slot = 0; slot < count; ++slot)
+		{
+			auto& node = sorted_nodes[slot];
+			node.parent_slot = node.parent == k_null_entity ? k_no_slot : m_nodes.get_dense_index(node.parent);
+
+			if (node.depth == m_level_offsets.size())
+			{
+				m_level_offsets.push_back(slot);
+			}
+
+			if (ticks[slot].local_changed == m_tick)
+			{
+				m_first_dirty_depth = std::min<size_type>(m_first_dirty_depth, node.depth);
+				m_last_dirty_depth = std::max<size_type>(m_last_dirty_depth, node.depth);
+			}
+		}
+		m_level_offsets.push_back(count);
+
+		m_structure_dirty = false;
+		m_structure_tick = m_tick;
+	}
+
+	TransformHierarchy::size_type TransformHierarchy::update_range(const size_type begin, const size_type end) noexcept
+	{
+		const auto nodes = m_nodes.data();
+		const auto local = m_local.data();
+		const auto world = m_world.data();
+		const auto ticks = m_ticks.data();
+
+		size_type updated = 0;
+		for (auto slot = begin; slot < end; ++slot)
+		{
+			const auto parent_slot = nodes[slot].parent_slot;
+			const auto parent_changed = parent_slot != k_no_slot && ticks[parent_slot].world_changed == m_tick;
+			if (!parent_changed && ticks[slot].local_changed != m_tick)
+			{
+				continue;
+			}
+
+			if (parent_slot == k_no_slot)
+			{
+				world[slot] = local[slot];
+			}
+			else
+			{
+				const auto local_matrix = DirectX::XMLoadFloat4x4(&local[slot]);
+				const auto parent_matrix = DirectX::XMLoadFloat4x4(&world[parent_slot]);
+				DirectX::XMStoreFloat4x4(&world[slot], DirectX::XMMatrixMultiply(local_matrix, parent_matrix));
+			}
+
+			ticks[slot].world_changed = m_tick;
+			++updated;
+		}
+		return updated;
+	}
+}
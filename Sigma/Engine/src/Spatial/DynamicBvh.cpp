@@ -0,0 +1,566 @@
+#include "Sigma/Engine/Spatial/DynamicBvh.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+
+namespace sigma
+{
+	namespace
+	{
+		constexpr Float k_quantization_steps = 65535.0f;
+
+		UInt16 quantize_down(const Float value)
+		{
+			return static_cast<UInt16>(std::clamp(std::floor(value), 0.0f, k_quantization_steps));
+		}
+
+		UInt16 quantize_up(const Float value)
+		{
+			return static_cast<UInt16>(std::clamp(std::ceil(value), 0.0f, k_quantization_steps));
+		}
+	}
+
+	DynamicBvh::DynamicBvh(const Aabb& world_bounds, const Float margin, const size_type capacity)
+		: m_leaves{ capacity }, m_bounds{ capacity }, m_world_bounds{ world_bounds }, m_margin{ margin }
+	{
+		const auto extent = [](const Float min, const Float max)
+		{
+			return std::max(max - min, std::numeric_limits<Float>::epsilon());
+		};
+
+		m_scale = {
+			extent(world_bounds.min.x, world_bounds.max.x) / k_quantization_steps,
+			extent(world_bounds.min.y, world_bounds.max.y) / k_quantization_steps,
+			extent(world_bounds.min.z, world_bounds.max.z) / k_quantization_steps
+		};
+		m_inverse_scale = { 1.0f / m_scale.x, 1.0f / m_scale.y, 1.0f / m_scale.z };
+
+		m_nodes.reserve(capacity * 2);
+	}
+
+	void DynamicBvh::insert(const Entity entity, const Aabb& bounds)
+	{
+		assert(!contains(entity));
+		assert(entity < std::numeric_limits<UInt32>::max());
+
+		m_bounds.emplace(entity, bounds);
+		if (!sigma::contains(m_world_bounds, bounds))
+		{
+			m_leaves.emplace(entity, k_null_node);
+			m_outside.push_back(entity);
+			return;
+		}
+
+		const auto leaf = allocate_node();
+		m_nodes[leaf] = { quantize(expand(bounds, m_margin)), k_null_node, { k_null_node, k_null_node }, 0, static_cast<UInt32>(entity) };
+
+		m_leaves.emplace(entity, leaf);
+		insert_leaf(leaf);
+	}
+
+	void DynamicBvh::update(const Entity entity, const Aabb& bounds)
+	{
+		assert(contains(entity));
+		m_bounds[entity] = bounds;
+
+		auto& leaf = m_leaves[entity];
+		const auto is_inside = sigma::contains(m_world_bounds, bounds);
+		if (leaf == k_null_node)
+		{
+			if (!is_inside)
+			{
+				return;
+			}
+
+			erase_outside(entity);
+			leaf = allocate_node();
+			m_nodes[leaf] = { quantize(expand(bounds, m_margin)), k_null_node, { k_null_node, k_null_node }, 0, static_cast<UInt32>(entity) };
+			insert_leaf(leaf);
+			return;
+		}
+
+		// The fattened leaf still encloses the object, so the tree does not need to change
+		if (sigma::contains(dequantize(m_nodes[leaf].bounds), bounds))
+		{
+			return;
+		}
+
+		remove_leaf(leaf);
+		if (!is_inside)
+		{
+			free_node(leaf);
+			leaf = k_null_node;
+			m_outside.push_back(entity);
+			return;
+		}
+
+		m_nodes[leaf].bounds = quantize(expand(bounds, m_margin));
+		insert_leaf(leaf);
+	}
+
+	void DynamicBvh::erase(const Entity entity)
+	{
+		if (!contains(entity))
+		{
+			return;
+		}
+
+		if (const auto leaf = m_leaves[entity]; leaf == k_null_node)
+		{
+			erase_outside(entity);
+		}
+		else
+		{
+			remove_leaf(leaf);
+			free_node(leaf);
+		}
+
+		m_leaves.erase(entity);
+		m_bounds.erase(entity);
+	}
+
+	DynamicBvh::size_type DynamicBvh::size() const noexcept
+	{
+		return m_leaves.size();
+	}
+
+	bool DynamicBvh::contains(const Entity entity) const noexcept
+	{
+		return m_leaves.has_element(entity);
+	}
+
+	const Aabb& DynamicBvh::get_bounds(const Entity entity) const noexcept
+	{
+		return m_bounds[entity];
+	}
+
+	Int32 DynamicBvh::get_height() const noexcept
+	{
+		return m_root == k_null_node ? 0 : m_nodes[m_root].height;
+	}
+
+	Float DynamicBvh::get_total_surface_area() const noexcept
+	{
+		auto total = 0.0f;
+		for (const auto& node : m_nodes)
+		{
+			if (node.height > 0)
+			{
+				total += get_cost(node.bounds);
+			}
+		}
+		return total;
+	}
+
+	void DynamicBvh::query(const Aabb& bounds, std::vector<Entity>& result) const
+	{
+		visit(bounds, [&](const Entity entity, const Aabb&)
+		{
+			result.push_back(entity);
+		});
+	}
+
+	void DynamicBvh::query(const Sphere& sphere, std::vector<Entity>& result) const
+	{
+		visit(make_aabb(sphere), [&](const Entity entity, const Aabb& bounds)
+		{
+			if (intersects(bounds, sphere))
+			{
+				result.push_back(entity);
+			}
+		});
+	}
+
+	RayHit DynamicBvh::raycast(const Ray& ray) const
+	{
+		RayHit hit{};
+		for (const auto entity : m_outside)
+		{
+			const auto distance = intersect(m_bounds[entity], ray);
+			if (distance >= 0.0f && distance < hit.distance)
+			{
+				hit = { entity, distance };
+			}
+		}
+
+		if (m_root == k_null_node)
+		{
+			return hit;
+		}
+
+		TraversalStack stack{};
+		stack.push(m_root);
+
+		while (!stack.is_empty())
+		{
+			const auto& node = m_nodes[stack.pop()];
+			const auto node_distance = intersect(dequantize(node.bounds), ray);
+			if (node_distance < 0.0f || node_distance >= hit.distance)
+			{
+				continue;
+			}
+
+			if (node.children[0] == k_null_node)
+			{
+				const auto distance = intersect(m_bounds[node.entity], ray);
+				if (distance >= 0.0f && distance < hit.distance)
+				{
+					hit = { static_cast<Entity>(node.entity), distance };
+				}
+				continue;
+			}
+
+			stack.push(node.children[0]);
+			stack.push(node.children[1]);
+		}
+
+		return hit;
+	}
+
+	void DynamicBvh::query_nearest(const Vector3& point, const size_type count, std::vector<Entity>& result) const
+	{
+		if (count == 0 || size() == 0)
+		{
+			return;
+		}
+
+		using Candidate = std::pair<Float, UInt32>;
+		std::priority_queue<Candidate, std::vector<Candidate>, std::greater<>> nodes{};
+		std::priority_queue<std::pair<Float, Entity>> nearest{};
+
+		const auto consider = [&](const Entity entity)
+		{
+			const auto distance = get_distance_squared(m_bounds[entity], point);
+			if (nearest.size() < count)
+			{
+				nearest.emplace(distance, entity);
+			}
+			else if (distance < nearest.top().first)
+			{
+				nearest.pop();
+				nearest.emplace(distance, entity);
+			}
+		};
+
+		// Outside objects seed the candidates, which also lets the traversal stop earlier
+		for (const auto entity : m_outside)
+		{
+			consider(entity);
+		}
+
+		if (m_root != k_null_node)
+		{
+			nodes.emplace(get_distance_squared(dequantize(m_nodes[m_root].bounds), point), m_root);
+		}
+		while (!nodes.empty())
+		{
+			const auto [node_distance, index] = nodes.top();
+			nodes.pop();
+			if (nearest.size() == count && node_distance > nearest.top().first)
+			{
+				break;
+			}
+
+			const auto& node = m_nodes[index];
+			if (node.children[0] == k_null_node)
+			{
+				consider(static_cast<Entity>(node.entity));
+				continue;
+			}
+
+			for (const auto child : node.children)
+			{
+				nodes.emplace(get_distance_squared(dequantize(m_nodes[child].bounds), point), child);
+			}
+		}
+
+		const auto first = result.size();
+		result.resize(first + nearest.size());
+		for (auto position = result.size(); position > first; --position)
+		{
+			result[position - 1] = nearest.top().second;
+			nearest.pop();
+		}
+	}
+
+	void DynamicBvh::erase_outside(const Entity entity) noexcept
+	{
+		// Objects rarely leave the world, so a linear search over the few outside ones is enough
+		const auto position = std::find(m_outside.begin(), m_outside.end(), entity);
+		assert(position != m_outside.end());
+		*position = m_outside.back();
+		m_outside.pop_back();
+	}
+
+	void DynamicBvh::TraversalStack::push(const UInt32 node)
+	{
+		if (m_size < m_inline.size())
+		{
+			m_inline[m_size] = node;
+		}
+		else
+		{
+			m_overflow.push_back(node);
+		}
+		++m_size;
+	}
+
+	UInt32 DynamicBvh::TraversalStack::pop() noexcept
+	{
+		--m_size;
+		if (m_size < m_inline.size())
+		{
+			return m_inline[m_size];
+		}
+
+		const auto node = m_overflow.back();
+		m_overflow.pop_back();
+		return node;
+	}
+
+	bool DynamicBvh::TraversalStack::is_empty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	QuantizedAabb DynamicBvh::quantize(const Aabb& bounds) const noexcept
+	{
+		return {
+			{
+				quantize_down((bounds.min.x - m_world_bounds.min.x) * m_inverse_scale.x),
+				quantize_down((bounds.min.y - m_world_bounds.min.y) * m_inverse_scale.y),
+				quantize_down((bounds.min.z - m_world_bounds.min.z) * m_inverse_scale.z)
+			},
+			{
+				quantize_up((bounds.max.x - m_world_bounds.min.x) * m_inverse_scale.x),
+				quantize_up((bounds.max.y - m_world_bounds.min.y) * m_inverse_scale.y),
+				quantize_up((bounds.max.z - m_world_bounds.min.z) * m_inverse_scale.z)
+			}
+		};
+	}
+
+	Aabb DynamicBvh::dequantize(const QuantizedAabb& bounds) const noexcept
+	{
+		return {
+			{
+				m_world_bounds.min.x + static_cast<Float>(bounds.min[0]) * m_scale.x,
+				m_world_bounds.min.y + static_cast<Float>(bounds.min[1]) * m_scale.y,
+				m_world_bounds.min.z + static_cast<Float>(bounds.min[2]) * m_scale.z
+			},
+			{
+				m_world_bounds.min.x + static_cast<Float>(bounds.max[0]) * m_scale.x,
+				m_world_bounds.min.y + static_cast<Float>(bounds.max[1]) * m_scale.y,
+				m_world_bounds.min.z + static_cast<Float>(bounds.max[2]) * m_scale.z
+			}
+		};
+	}
+
+	Float DynamicBvh::get_cost(const QuantizedAabb& bounds) const noexcept
+	{
+		const auto x = static_cast<Float>(bounds.max[0] - bounds.min[0]) * m_scale.x;
+		const auto y = static_cast<Float>(bounds.max[1] - bounds.min[1]) * m_scale.y;
+		const auto z = static_cast<Float>(bounds.max[2] - bounds.min[2]) * m_scale.z;
+		return 2.0f * (x * y + y * z + z * x);
+	}
+
+	QuantizedAabb DynamicBvh::merge(const QuantizedAabb& lhs, const QuantizedAabb& rhs) noexcept
+	{
+		return {
+			{ std::min(lhs.min[0], rhs.min[0]), std::min(lhs.min[1], rhs.min[1]), std::min(lhs.min[2], rhs.min[2]) },
+			{ std::max(lhs.max[0], rhs.max[0]), std::max(lhs.max[1], rhs.max[1]), std::max(lhs.max[2], rhs.max[2]) }
+		};
+	}
+
+	bool DynamicBvh::overlaps(const QuantizedAabb& lhs, const QuantizedAabb& rhs) noexcept
+	{
+		return lhs.min[0] <= rhs.max[0] && lhs.max[0] >= rhs.min[0] &&
+			lhs.min[1] <= rhs.max[1] && lhs.max[1] >= rhs.min[1] &&
+			lhs.min[2] <= rhs.max[2] && lhs.max[2] >= rhs.min[2];
+	}
+
+	bool DynamicBvh::is_leaf(const UInt32 node) const noexcept
+	{
+		return m_nodes[node].children[0] == k_null_node;
+	}
+
+	UInt32 DynamicBvh::allocate_node()
+	{
+		if (m_free_list == k_null_node)
+		{
+			m_nodes.emplace_back();
+			return static_cast<UInt32>(m_nodes.size() - 1);
+		}
+
+		const auto node = m_free_list;
+		m_free_list = m_nodes[node].parent;
+		return node;
+	}
+
+	void DynamicBvh::free_node(const UInt32 node) noexcept
+	{
+		m_nodes[node].parent = m_free_list;
+		m_nodes[node].height = -1;
+		m_free_list = node;
+	}
+
+	void DynamicBvh::insert_leaf(const UInt32 leaf)
+	{
+		if (m_root == k_null_node)
+		{
+			m_root = leaf;
+			m_nodes[leaf].parent = k_null_node;
+			return;
+		}
+
+		// Descend towards the sibling that minimises the added surface area, counting the growth inherited by
+		// every ancestor on the way
+		const auto leaf_bounds = m_nodes[leaf].bounds;
+		auto sibling = m_root;
+		while (!is_leaf(sibling))
+		{
+			const auto& node = m_nodes[sibling];
+			const auto area = get_cost(node.bounds);
+			const auto combined_area = get_cost(merge(node.bounds, leaf_bounds));
+
+			const auto pair_cost = 2.0f * combined_area;
+			const auto inheritance_cost = 2.0f * (combined_area - area);
+
+			const auto child_cost = [&](const UInt32 child)
+			{
+				const auto& child_bounds = m_nodes[child].bounds;
+				const auto merged_area = get_cost(merge(child_bounds, leaf_bounds));
+				return is_leaf(child) ? merged_area + inheritance_cost : merged_area - get_cost(child_bounds) + inheritance_cost;
+			};
+
+			const auto left_cost = child_cost(node.children[0]);
+			const auto right_cost = child_cost(node.children[1]);
+			if (pair_cost < left_cost && pair_cost < right_cost)
+			{
+				break;
+			}
+			sibling = left_cost < right_cost ? node.children[0] : node.children[1];
+		}
+
+		const auto old_parent = m_nodes[sibling].parent;
+		const auto new_parent = allocate_node();
+		m_nodes[new_parent] = {
+			merge(leaf_bounds, m_nodes[sibling].bounds), old_parent, { sibling, leaf }, m_nodes[sibling].height + 1, 0
+		};
+
+		if (old_parent == k_null_node)
+		{
+			m_root = new_parent;
+		}
+		else
+		{
+			auto& children = m_nodes[old_parent].children;
+			children[children[0] == sibling ? 0 : 1] = new_parent;
+		}
+
+		m_nodes[sibling].parent = new_parent;
+		m_nodes[leaf].parent = new_parent;
+		refit(new_parent);
+	}
+
+	void DynamicBvh::remove_leaf(const UInt32 leaf) noexcept
+	{
+		if (leaf == m_root)
+		{
+			m_root = k_null_node;
+			return;
+		}
+
+		const auto parent = m_nodes[leaf].parent;
+		const auto grandparent = m_nodes[parent].parent;
+		const auto& parent_children = m_nodes[parent].children;
+		const auto sibling = parent_children[0] == leaf ? parent_children[1] : parent_children[0];
+
+		free_node(parent);
+		m_nodes[sibling].parent = grandparent;
+
+		if (grandparent == k_null_node)
+		{
+			m_root = sibling;
+			return;
+		}
+
+		auto& children = m_nodes[grandparent].children;
+		children[children[0] == parent ? 0 : 1] = sibling;
+		refit(grandparent);
+	}
+
+	void DynamicBvh::refit(UInt32 node) noexcept
+	{
+		while (node != k_null_node)
+		{
+			auto& current = m_nodes[node];
+			const auto& left = m_nodes[current.children[0]];
+			const auto& right = m_nodes[current.children[1]];
+			current.bounds = merge(left.bounds, right.bounds);
+			current.height = 1 + std::max(left.height, right.height);
+
+			rotate(node);
+			node = current.parent;
+		}
+	}
+
+	void DynamicBvh::rotate(const UInt32 node) noexcept
+	{
+		// Swapping a child with a grandchild on the other side keeps this node's bounds and only changes the surface
+		// area of the grandchild's parent. Pick the swap that shrinks it the most.
+		auto& current = m_nodes[node];
+		const auto left = current.children[0];
+		const auto right = current.children[1];
+
+		struct Rotation
+		{
+			UInt32 child{};
+			UInt32 inner{};
+			UInt32 grandchild_slot{};
+			Float gain{};
+		};
+		Rotation best{ k_null_node, k_null_node, 0, 0.0f };
+
+		const auto consider = [&](const UInt32 child, const UInt32 inner)
+		{
+			if (is_leaf(inner))
+			{
+				return;
+			}
+
+			const auto& inner_node = m_nodes[inner];
+			const auto inner_cost = get_cost(inner_node.bounds);
+			for (UInt32 slot = 0; slot < 2; ++slot)
+			{
+				const auto kept = inner_node.children[1 - slot];
+				const auto gain = inner_cost - get_cost(merge(m_nodes[child].bounds, m_nodes[kept].bounds));
+				if (gain > best.gain)
+				{
+					best = { child, inner, slot, gain };
+				}
+			}
+		};
+
+		consider(left, right);
+		consider(right, left);
+		if (best.child == k_null_node)
+		{
+			return;
+		}
+
+		auto& inner = m_nodes[best.inner];
+		const auto grandchild = inner.children[best.grandchild_slot];
+		const auto kept = inner.children[1 - best.grandchild_slot];
+
+		current.children[current.children[0] == best.child ? 0 : 1] = grandchild;
+		m_nodes[grandchild].parent = node;
+
+		inner.children[best.grandchild_slot] = best.child;
+		m_nodes[best.child].parent = best.inner;
+		inner.bounds = merge(m_nodes[best.child].bounds, m_nodes[kept].bounds);
+		inner.height = 1 + std::max(m_nodes[best.child].height, m_nodes[kept].height);
+
+		current.height = 1 + std::max(m_nodes[grandchild].height, inner.height);
+	}
+}
@@ -0,0 +1,361 @@
+#include "Sigma/Engine/Spatial/LooseGrid.hpp"
+
+#include <queue>
+
+namespace sigma
+{
+	namespace
+	{
+		constexpr Int32 k_coordinate_bias = 1 << 20;
+		constexpr Int32 k_coordinate_limit = k_coordinate_bias - 1;
+
+		using NearestCandidate = std::pair<Float, Entity>;
+		using NearestHeap = std::priority_queue<NearestCandidate>;
+
+		void offer(NearestHeap& heap, const LooseGrid::size_type count, const Float distance_squared, const Entity entity)
+		{
+			if (heap.size() < count)
+			{
+				heap.emplace(distance_squared, entity);
+			}
+			else if (distance_squared < heap.top().first)
+			{
+				heap.pop();
+				heap.emplace(distance_squared, entity);
+			}
+		}
+	}
+
+	LooseGrid::LooseGrid(const Float cell_size, const size_type capacity)
+		: m_entries{ capacity }, m_cell_size{ cell_size }, m_inverse_cell_size{ 1.0f / cell_size }
+	{
+		assert(cell_size > 0.0f);
+	}
+
+	void LooseGrid::insert(const Entity entity, const Aabb& bounds)
+	{
+		assert(!contains(entity));
+
+		const auto cell_key = get_cell_key(bounds);
+		m_entries.emplace(entity, Entry{ cell_key, 0 });
+		add_to_cell(entity, cell_key, bounds);
+	}
+
+	void LooseGrid::update(const Entity entity, const Aabb& bounds)
+	{
+		auto& entry = m_entries[entity];
+		const auto cell_key = get_cell_key(bounds);
+
+		if (cell_key == entry.cell_key)
+		{
+			auto& cell = cell_key == k_oversized_key ? m_oversized : m_cells.find(cell_key)->second;
+			cell.bounds[entry.slot] = bounds;
+			return;
+		}
+
+		remove_from_cell(entry);
+		entry.cell_key = cell_key;
+		add_to_cell(entity, cell_key, bounds);
+	}
+
+	void LooseGrid::erase(const Entity entity)
+	{
+		if (!contains(entity))
+		{
+			return;
+		}
+
+		remove_from_cell(m_entries[entity]);
+		m_entries.erase(entity);
+	}
+
+	LooseGrid::size_type LooseGrid::size() const noexcept
+	{
+		return m_entries.size();
+	}
+
+	bool LooseGrid::contains(const Entity entity) const noexcept
+	{
+		return m_entries.has_element(entity);
+	}
+
+	const Aabb& LooseGrid::get_bounds(const Entity entity) const noexcept
+	{
+		const auto& entry = m_entries[entity];
+		const auto& cell = entry.cell_key == k_oversized_key ? m_oversized : m_cells.find(entry.cell_key)->second;
+		return cell.bounds[entry.slot];
+	}
+
+	Float LooseGrid::get_cell_size() const noexcept
+	{
+		return m_cell_size;
+	}
+
+	LooseGrid::size_type LooseGrid::get_cell_count() const noexcept
+	{
+		return m_cells.size();
+	}
+
+	void LooseGrid::query(const Aabb& bounds, std::vector<Entity>& result) const
+	{
+		visit(bounds, [&](const Entity entity, const Aabb&)
+		{
+			result.push_back(entity);
+		});
+	}
+
+	void LooseGrid::query(const Sphere& sphere, std::vector<Entity>& result) const
+	{
+		visit(make_aabb(sphere), [&](const Entity entity, const Aabb& bounds)
+		{
+			if (intersects(bounds, sphere))
+			{
+				result.push_back(entity);
+			}
+		});
+	}
+
+	RayHit LooseGrid::raycast(const Ray& ray) const
+	{
+		RayHit hit{};
+
+		const auto test_cell = [&](const Cell& cell)
+		{
+			for (size_type slot = 0; slot < cell.entities.size(); ++slot)
+			{
+				const auto distance = intersect(cell.bounds[slot], ray);
+				if (distance >= 0.0f && distance < hit.distance)
+				{
+					hit = { cell.entities[slot], distance };
+				}
+			}
+		};
+
+		test_cell(m_oversized);
+		if (m_cells.empty())
+		{
+			return hit;
+		}
+
+		const auto half_cell = m_cell_size * 0.5f;
+		const Aabb occupied{
+			{ static_cast<Float>(m_occupied_min.x) * m_cell_size - half_cell, static_cast<Float>(m_occupied_min.y) * m_cell_size - half_cell, static_cast<Float>(m_occupied_min.z) * m_cell_size - half_cell },
+			{ static_cast<Float>(m_occupied_max.x + 1) * m_cell_size + half_cell, static_cast<Float>(m_occupied_max.y + 1) * m_cell_size + half_cell, static_cast<Float>(m_occupied_max.z + 1) * m_cell_size + half_cell }
+		};
+		const auto start_distance = intersect(occupied, ray);
+		if (start_distance < 0.0f)
+		{
+			return hit;
+		}
+
+		// Amanatides-Woo traversal. Every visited cell has its whole 3x3x3 neighbourhood tested, which covers every
+		// loose cell overlapping it; a step only needs the 3x3 slab that comes into range along the stepped axis.
+		const Float origin[3]{
+			ray.origin.x + ray.direction.x * start_distance,
+			ray.origin.y + ray.direction.y * start_distance,
+			ray.origin.z + ray.direction.z * start_distance
+		};
+		const Float direction[3]{ ray.direction.x, ray.direction.y, ray.direction.z };
+		const auto start = get_coordinates({ origin[0], origin[1], origin[2] });
+		Int32 cell[3]{ start.x, start.y, start.z };
+		const Int32 first[3]{ m_occupied_min.x - 1, m_occupied_min.y - 1, m_occupied_min.z - 1 };
+		const Int32 last[3]{ m_occupied_max.x + 1, m_occupied_max.y + 1, m_occupied_max.z + 1 };
+
+		Int32 step[3]{};
+		Float next_boundary[3]{};
+		Float boundary_spacing[3]{};
+		for (auto axis = 0; axis < 3; ++axis)
+		{
+			step[axis] = direction[axis] > 0.0f ? 1 : (direction[axis] < 0.0f ? -1 : 0);
+			if (step[axis] == 0)
+			{
+				next_boundary[axis] = std::numeric_limits<Float>::max();
+				boundary_spacing[axis] = std::numeric_limits<Float>::max();
+				continue;
+			}
+
+			const auto boundary = static_cast<Float>(cell[axis] + (step[axis] > 0 ? 1 : 0)) * m_cell_size;
+			next_boundary[axis] = start_distance + (boundary - origin[axis]) / direction[axis];
+			boundary_spacing[axis] = m_cell_size / std::abs(direction[axis]);
+		}
+
+		const auto visit_neighbourhood = [&](const CellCoordinates& low, const CellCoordinates& high)
+		{
+			visit_cells(low, high, test_cell);
+		};
+		visit_neighbourhood({ cell[0] - 1, cell[1] - 1, cell[2] - 1 }, { cell[0] + 1, cell[1] + 1, cell[2] + 1 });
+
+		while (true)
+		{
+			const auto axis = next_boundary[0] < next_boundary[1] ?
+				(next_boundary[0] < next_boundary[2] ? 0 : 2) :
+				(next_boundary[1] < next_boundary[2] ? 1 : 2);
+
+			// Anything not yet tested can only be hit after the ray leaves the current cell
+			const auto exit_distance = next_boundary[axis];
+			if (hit.distance <= exit_distance || exit_distance > ray.max_distance || step[axis] == 0)
+			{
+				break;
+			}
+
+			cell[axis] += step[axis];
+			next_boundary[axis] += boundary_spacing[axis];
+			if (cell[axis] < first[axis] || cell[axis] > last[axis])
+			{
+				break;
+			}
+
+			Int32 low[3]{ cell[0] - 1, cell[1] - 1, cell[2] - 1 };
+			Int32 high[3]{ cell[0] + 1, cell[1] + 1, cell[2] + 1 };
+			low[axis] = high[axis] = cell[axis] + step[axis];
+			visit_neighbourhood({ low[0], low[1], low[2] }, { high[0], high[1], high[2] });
+		}
+
+		return hit;
+	}
+
+	void LooseGrid::query_nearest(const Vector3& point, const size_type count, std::vector<Entity>& result) const
+	{
+		if (count == 0)
+		{
+			return;
+		}
+
+		NearestHeap heap{};
+		const auto test_cell = [&](const Cell& cell)
+		{
+			for (size_type slot = 0; slot < cell.entities.size(); ++slot)
+			{
+				offer(heap, count, get_distance_squared(cell.bounds[slot], point), cell.entities[slot]);
+			}
+		};
+
+		test_cell(m_oversized);
+
+		if (!m_cells.empty())
+		{
+			const auto center = get_coordinates(point);
+			const auto max_ring = std::max({
+				std::abs(center.x - m_occupied_min.x), std::abs(center.x - m_occupied_max.x),
+				std::abs(center.y - m_occupied_min.y), std::abs(center.y - m_occupied_max.y),
+				std::abs(center.z - m_occupied_min.z), std::abs(center.z - m_occupied_max.z)
+			});
+
+			for (Int32 ring = 0; ring <= max_ring; ++ring)
+			{
+				for (auto x = center.x - ring; x <= center.x + ring; ++x)
+				{
+					for (auto y = center.y - ring; y <= center.y + ring; ++y)
+					{
+						if (std::abs(x - center.x) == ring || std::abs(y - center.y) == ring)
+						{
+							visit_cells({ x, y, center.z - ring }, { x, y, center.z + ring }, test_cell);
+						}
+						else
+						{
+							visit_cells({ x, y, center.z - ring }, { x, y, center.z - ring }, test_cell);
+							visit_cells({ x, y, center.z + ring }, { x, y, center.z + ring }, test_cell);
+						}
+					}
+				}
+
+				// Objects binned outside the searched rings are at least this far away
+				const auto unsearched_distance = (static_cast<Float>(ring) - 0.5f) * m_cell_size;
+				if (heap.size() == count && unsearched_distance > 0.0f &&
+					heap.top().first <= unsearched_distance * unsearched_distance)
+				{
+					break;
+				}
+			}
+		}
+
+		const auto first = result.size();
+		result.resize(first + heap.size());
+		for (auto position = result.size(); position > first; --position)
+		{
+			result[position - 1] = heap.top().second;
+			heap.pop();
+		}
+	}
+
+	LooseGrid::CellCoordinates LooseGrid::get_coordinates(const Vector3& point) const noexcept
+	{
+		const auto to_cell = [&](const Float value)
+		{
+			const auto scaled = std::floor(value * m_inverse_cell_size);
+			return static_cast<Int32>(std::clamp(scaled, static_cast<Float>(-k_coordinate_limit), static_cast<Float>(k_coordinate_limit)));
+		};
+		return { to_cell(point.x), to_cell(point.y), to_cell(point.z) };
+	}
+
+	UInt64 LooseGrid::get_cell_key(const Aabb& bounds) const noexcept
+	{
+		const auto largest_extent = std::max({ bounds.max.x - bounds.min.x, bounds.max.y - bounds.min.y, bounds.max.z - bounds.min.z });
+		if (largest_extent > m_cell_size)
+		{
+			return k_oversized_key;
+		}
+		return pack(get_coordinates(get_center(bounds)));
+	}
+
+	UInt64 LooseGrid::pack(const CellCoordinates& coordinates) noexcept
+	{
+		const auto to_bits = [](const Int32 value)
+		{
+			return static_cast<UInt64>(static_cast<UInt32>(value + k_coordinate_bias)) & 0x1FFFFF;
+		};
+		return (to_bits(coordinates.x) << 42) | (to_bits(coordinates.y) << 21) | to_bits(coordinates.z);
+	}
+
+	LooseGrid::CellCoordinates LooseGrid::unpack(const UInt64 key) noexcept
+	{
+		const auto from_bits = [](const UInt64 bits)
+		{
+			return static_cast<Int32>(bits & 0x1FFFFF) - k_coordinate_bias;
+		};
+		return { from_bits(key >> 42), from_bits(key >> 21), from_bits(key) };
+	}
+
+	void LooseGrid::add_to_cell(const Entity entity, const UInt64 cell_key, const Aabb& bounds)
+	{
+		auto& cell = cell_key == k_oversized_key ? m_oversized : m_cells[cell_key];
+		m_entries[entity].slot = static_cast<UInt32>(cell.entities.size());
+		cell.entities.push_back(entity);
+		cell.bounds.push_back(bounds);
+
+		if (cell_key != k_oversized_key)
+		{
+			const auto coordinates = unpack(cell_key);
+			m_occupied_min = { std::min(m_occupied_min.x, coordinates.x), std::min(m_occupied_min.y, coordinates.y), std::min(m_occupied_min.z, coordinates.z) };
+			m_occupied_max = { std::max(m_occupied_max.x, coordinates.x), std::max(m_occupied_max.y, coordinates.y), std::max(m_occupied_max.z, coordinates.z) };
+		}
+	}
+
+	void LooseGrid::remove_from_cell(const Entry& entry) noexcept
+	{
+		if (entry.cell_key == k_oversized_key)
+		{
+			remove_from_cell(m_oversized, entry.slot);
+			return;
+		}
+
+		// Empty cells are dropped, otherwise moving objects leave a trail of them for the occupied cell walk
+		const auto found = m_cells.find(entry.cell_key);
+		remove_from_cell(found->second, entry.slot);
+		if (found->second.entities.empty())
+		{
+			m_cells.erase(found);
+		}
+	}
+
+	void LooseGrid::remove_from_cell(Cell& cell, const UInt32 slot) noexcept
+	{
+		const auto moved = cell.entities.back();
+		cell.entities[slot] = moved;
+		cell.bounds[slot] = cell.bounds.back();
+		cell.entities.pop_back();
+		cell.bounds.pop_back();
+
+		m_entries[moved].slot = slot;
+	}
+}
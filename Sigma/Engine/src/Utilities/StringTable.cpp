@@ -0,0 +1,60 @@
+#include "Sigma/Engine/utilities/StringTable.hpp"
+
+#include <mutex>
+
+namespace sigma
+{
+	HashedString StringTable::intern(const std::string_view text)
+	{
+		const HashedString name{ text };
+		{
+			const std::shared_lock lock{ m_mutex };
+			const auto found = m_strings.find(name);
+			if (found != m_strings.end())
+			{
+#if !defined(NDEBUG)
+				if (found->second != text)
+				{
+					m_collision_count.fetch_add(1, std::memory_order_relaxed);
+				}
+#endif
+				return name;
+			}
+		}
+
+		// Another thread may have interned it since the lookup, the first string stays
+		const std::scoped_lock lock{ m_mutex };
+		[[maybe_unused]] const auto [found, inserted] = m_strings.try_emplace(name, text);
+#if !defined(NDEBUG)
+		if (!inserted && found->second != text)
+		{
+			m_collision_count.fetch_add(1, std::memory_order_relaxed);
+		}
+#endif
+		return name;
+	}
+
+	std::string_view StringTable::find(const HashedString name) const
+	{
+		const std::shared_lock lock{ m_mutex };
+		const auto found = m_strings.find(name);
+		return found != m_strings.end() ? std::string_view{ found->second } : std::string_view{};
+	}
+
+	bool StringTable::contains(const HashedString name) const
+	{
+		const std::shared_lock lock{ m_mutex };
+		return m_strings.contains(name);
+	}
+
+	std::size_t StringTable::size() const
+	{
+		const std::shared_lock lock{ m_mutex };
+		return m_strings.size();
+	}
+
+	std::size_t StringTable::get_collision_count() const noexcept
+	{
+		return m_collision_count.load(std::memory_order_relaxed);
+	}
+}
\ No newline at end of file
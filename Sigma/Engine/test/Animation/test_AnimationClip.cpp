@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <Sigma/Engine/Animation/AnimationClip.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	Vector4 make_rotation(const Float angle)
+	{
+		return { 0.0f, 0.0f, std::sin(angle * 0.5f), std::cos(angle * 0.5f) };
+	}
+}
+
+TEST(AnimationClip, quantization_round_trip)
+{
+	std::mt19937 generator{ 5 };
+	std::normal_distribution<float> component{};
+	for (auto sample = 0; sample < 1000; ++sample)
+	{
+		Vector4 rotation{ component(generator), component(generator), component(generator), component(generator) };
+		const auto length = std::sqrt(rotation.x * rotation.x + rotation.y * rotation.y + rotation.z * rotation.z + rotation.w * rotation.w);
+		rotation = { rotation.x / length, rotation.y / length, rotation.z / length, rotation.w / length };
+
+		const auto decoded = dequantize_rotation(quantize_rotation(rotation));
+		// Equal up to sign, q and -q are the same rotation
+		const auto dot = rotation.x * decoded.x + rotation.y * decoded.y + rotation.z * decoded.z + rotation.w * decoded.w;
+		ASSERT_GT(std::abs(dot), 0.99999f);
+	}
+	static_assert(sizeof(QuantizedRotation) == 6);
+}
+
+TEST(AnimationClip, sample_interpolates_and_loops)
+{
+	std::vector<BoneTransform> frames{};
+	for (auto frame = 0; frame < 4; ++frame)
+	{
+		frames.push_back({ make_rotation(static_cast<Float>(frame) * 0.2f), { static_cast<Float>(frame), 0.0f, 0.0f } });
+		frames.push_back({ make_rotation(0.0f), { 0.0f, static_cast<Float>(frame) * 2.0f, 0.0f } });
+	}
+	const AnimationClip clip{ 2, 10.0f, frames };
+	ASSERT_EQ(clip.get_frame_count(), 4);
+	ASSERT_FLOAT_EQ(clip.get_duration(), 0.4f);
+
+	Pose pose{};
+	Pose scratch{};
+	clip.sample(0.15f, pose, scratch);
+	ASSERT_EQ(pose.size(), 2);
+	ASSERT_NEAR(pose.get_bone(0).translation.x, 1.5f, 1e-4f);
+	ASSERT_NEAR(pose.get_bone(1).translation.y, 3.0f, 1e-4f);
+	ASSERT_NEAR(pose.get_bone(0).rotation.z, std::sin(0.15f), 1e-3f);
+
+	// Halfway through the last frame the clip blends back to the first
+	clip.sample(0.35f, pose, scratch);
+	ASSERT_NEAR(pose.get_bone(0).translation.x, 1.5f, 1e-4f);
+	clip.sample(0.55f, pose, scratch);
+	ASSERT_NEAR(pose.get_bone(0).translation.x, 1.5f, 1e-4f);
+}
\ No newline at end of file
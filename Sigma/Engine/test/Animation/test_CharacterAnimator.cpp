@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <Sigma/Engine/Animation/CharacterAnimator.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	Matrix4x4 make_identity()
+	{
+		Matrix4x4 result{};
+		DirectX::XMStoreFloat4x4(&result, DirectX::XMMatrixIdentity());
+		return result;
+	}
+
+	AnimationClip make_slide(const Float distance)
+	{
+		const std::vector<BoneTransform> frames{
+			{ { 0.0f, 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, 0.0f } },
+			{ { 0.0f, 0.0f, 0.0f, 1.0f }, { distance, 0.0f, 0.0f } }
+		};
+		return AnimationClip{ 1, 1.0f, frames };
+	}
+}
+
+TEST(CharacterAnimator, updates_every_character)
+{
+	const Skeleton skeleton{ { Skeleton::k_no_parent }, { make_identity() } };
+	const auto walk = make_slide(2.0f);
+	const auto run = make_slide(6.0f);
+	const std::vector<SkinnedVertex> mesh{ { { 0.0f, 1.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0, 0, 0, 0 }, { 1.0f, 0.0f, 0.0f, 0.0f } } };
+
+	JobSystem job_system{ 2 };
+	CharacterAnimator animator{};
+	constexpr std::size_t k_characters = 100;
+	for (std::size_t character = 0; character < k_characters; ++character)
+	{
+		CharacterAnimation animation{ &skeleton, &walk, 0.5f };
+		if (character % 2 == 1)
+		{
+			animation.blend_clip = &run;
+			animation.blend_time = 0.5f;
+			animation.blend_weight = 0.5f;
+			animation.mesh = mesh;
+		}
+		ASSERT_EQ(animator.add(animation), character);
+	}
+
+	animator.update(job_system);
+	for (std::size_t character = 0; character < k_characters; ++character)
+	{
+		const auto palette = animator.get_palette(character);
+		ASSERT_EQ(palette.size(), 1);
+		// Walk samples halfway to 2, run halfway to 6, blended evenly
+		const auto expected = character % 2 == 1 ? 2.0f : 1.0f;
+		ASSERT_NEAR(palette[0]._14, expected, 1e-4f);
+
+		const auto positions = animator.get_skinned_positions(character);
+		ASSERT_EQ(positions.size(), character % 2 == 1 ? 1u : 0u);
+		if (!positions.empty())
+		{
+			ASSERT_NEAR(positions[0].x, expected, 1e-4f);
+			ASSERT_NEAR(positions[0].y, 1.0f, 1e-4f);
+		}
+	}
+}
\ No newline at end of file
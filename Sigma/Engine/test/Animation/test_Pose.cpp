@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <Sigma/Engine/Animation/Pose.hpp>
+
+using namespace sigma;
+
+TEST(Pose, resize_starts_at_identity)
+{
+	const Pose pose{ 3 };
+	const auto bone = pose.get_bone(2);
+	ASSERT_FLOAT_EQ(bone.rotation.w, 1.0f);
+	ASSERT_FLOAT_EQ(bone.rotation.x, 0.0f);
+	ASSERT_FLOAT_EQ(bone.scale.y, 1.0f);
+	ASSERT_FLOAT_EQ(bone.translation.z, 0.0f);
+}
+
+TEST(Pose, blend_matches_scalar_nlerp)
+{
+	constexpr std::size_t k_bones = 11;
+	Pose from{ k_bones };
+	Pose to{ k_bones };
+	for (std::size_t bone = 0; bone < k_bones; ++bone)
+	{
+		const auto angle = static_cast<Float>(bone) * 0.13f;
+		from.set_bone(bone, { { 0.0f, 0.0f, 0.0f, 1.0f }, { static_cast<Float>(bone), 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f } });
+		// Odd bones store the negated quaternion, which must still blend along the shorter arc
+		const auto sign = bone % 2 == 0 ? 1.0f : -1.0f;
+		to.set_bone(bone, { { 0.0f, std::sin(angle) * sign, 0.0f, std::cos(angle) * sign }, { 0.0f, 2.0f, 0.0f }, { 3.0f, 3.0f, 3.0f } });
+	}
+
+	Pose result{};
+	Pose::blend(from, to, 0.5f, result);
+	for (std::size_t bone = 0; bone < k_bones; ++bone)
+	{
+		const auto angle = static_cast<Float>(bone) * 0.13f;
+		const auto transform = result.get_bone(bone);
+		ASSERT_NEAR(transform.rotation.y, std::sin(angle * 0.5f), 1e-5f);
+		ASSERT_NEAR(transform.rotation.w, std::cos(angle * 0.5f), 1e-5f);
+		ASSERT_FLOAT_EQ(transform.translation.x, static_cast<Float>(bone) * 0.5f);
+		ASSERT_FLOAT_EQ(transform.translation.y, 1.0f);
+		ASSERT_FLOAT_EQ(transform.scale.z, 2.0f);
+	}
+}
\ No newline at end of file
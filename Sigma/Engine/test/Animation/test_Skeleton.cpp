@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include <Sigma/Engine/Animation/Skeleton.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	Matrix4x4 make_translation(const Float x, const Float y, const Float z)
+	{
+		Matrix4x4 result{};
+		DirectX::XMStoreFloat4x4(&result, DirectX::XMMatrixTranslation(x, y, z));
+		return result;
+	}
+
+	// A two bone chain along x, bound with the child one unit from its parent
+	Skeleton make_chain()
+	{
+		return Skeleton{ { Skeleton::k_no_parent, 0 }, { make_translation(0.0f, 0.0f, 0.0f), make_translation(-1.0f, 0.0f, 0.0f) } };
+	}
+}
+
+TEST(Skeleton, bind_pose_palette_is_identity)
+{
+	const auto skeleton = make_chain();
+	Pose pose{ 2 };
+	pose.set_bone(1, { { 0.0f, 0.0f, 0.0f, 1.0f }, { 1.0f, 0.0f, 0.0f } });
+
+	std::vector<Matrix4x4> model(2);
+	std::vector<Matrix3x4> palette(2);
+	skeleton.build_palette(pose, model, palette);
+	for (const auto& matrix : palette)
+	{
+		for (std::size_t row = 0; row < 3; ++row)
+		{
+			for (std::size_t column = 0; column < 4; ++column)
+			{
+				ASSERT_NEAR(matrix.m[row][column], row == column ? 1.0f : 0.0f, 1e-6f);
+			}
+		}
+	}
+	ASSERT_FLOAT_EQ(model[1]._41, 1.0f);
+}
+
+TEST(Skeleton, palette_follows_parent_rotation)
+{
+	const auto skeleton = make_chain();
+	Pose pose{ 2 };
+	// Quarter turn of the root around z carries the child from +x to +y
+	const auto half_angle = DirectX::XM_PIDIV2 * 0.5f;
+	pose.set_bone(0, { { 0.0f, 0.0f, std::sin(half_angle), std::cos(half_angle) } });
+	pose.set_bone(1, { { 0.0f, 0.0f, 0.0f, 1.0f }, { 1.0f, 0.0f, 0.0f } });
+
+	std::vector<Matrix4x4> model(2);
+	std::vector<Matrix3x4> palette(2);
+	skeleton.build_palette(pose, model, palette);
+	ASSERT_NEAR(model[1]._41, 0.0f, 1e-6f);
+	ASSERT_NEAR(model[1]._42, 1.0f, 1e-6f);
+
+	// A vertex bound at the child moves with it, a vertex split between both bones lands between them
+	const std::vector<SkinnedVertex> vertices{
+		{ { 1.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }, { 1, 0, 0, 0 }, { 1.0f, 0.0f, 0.0f, 0.0f } },
+		{ { 2.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }, { 0, 1, 0, 0 }, { 0.5f, 0.5f, 0.0f, 0.0f } }
+	};
+	std::vector<Vector3> positions(2);
+	std::vector<Vector3> normals(2);
+	skin_vertices(vertices, palette, positions, normals);
+	ASSERT_NEAR(positions[0].x, 0.0f, 1e-6f);
+	ASSERT_NEAR(positions[0].y, 1.0f, 1e-6f);
+	ASSERT_NEAR(normals[0].y, 1.0f, 1e-6f);
+	ASSERT_NEAR(positions[1].x, 0.0f, 1e-6f);
+	ASSERT_NEAR(positions[1].y, 2.0f, 1e-6f);
+	ASSERT_NEAR(normals[1].z, 1.0f, 1e-6f);
+}
\ No newline at end of file
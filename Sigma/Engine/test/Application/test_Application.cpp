@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include <Sigma/Engine/Application/Application.hpp>
+#include <Sigma/Engine/Application/Interpolated.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	class TestApplication final : public Application
+	{
+	public:
+		using Application::Application;
+
+		UInt64 exit_after_steps{ 0 };
+		UInt64 exit_after_frames{ 0 };
+		std::chrono::milliseconds step_duration{};
+		// Time only advances while waiting for the next frame, so the loop does not depend on the machine's speed
+		bool manual_clock{};
+		clock::time_point now{};
+		bool started{};
+		bool stopped{};
+		std::vector<Double> alphas{};
+		std::vector<Double> timesteps{};
+	protected:
+		void on_start() override
+		{
+			started = true;
+		}
+
+		void on_simulate(const Double timestep) override
+		{
+			timesteps.push_back(timestep);
+			if (step_duration.count() > 0)
+			{
+				std::this_thread::sleep_for(step_duration);
+			}
+			if (exit_after_steps != 0 && timesteps.size() >= exit_after_steps)
+			{
+				request_exit();
+			}
+		}
+
+		void on_render(const Double interpolation) override
+		{
+			alphas.push_back(interpolation);
+			if (exit_after_frames != 0 && alphas.size() >= exit_after_frames)
+			{
+				request_exit();
+			}
+		}
+
+		void on_stop() override
+		{
+			stopped = true;
+		}
+
+		[[nodiscard]] clock::time_point get_time() const override
+		{
+			return manual_clock ? now : Application::get_time();
+		}
+
+		void wait_until(const clock::time_point deadline) override
+		{
+			if (manual_clock)
+			{
+				now = std::max(now, deadline);
+				return;
+			}
+			Application::wait_until(deadline);
+		}
+	};
+}
+
+TEST(Application, fixed_timestep)
+{
+	TestApplication application{ ApplicationSettings{ 1.0 / 200.0, 0.25, 8, 100.0, false, false } };
+	application.manual_clock = true;
+	application.exit_after_steps = 20;
+	application.run();
+
+	ASSERT_TRUE(application.started);
+	ASSERT_TRUE(application.stopped);
+	ASSERT_EQ(application.get_step_count(), 20);
+	ASSERT_DOUBLE_EQ(application.get_simulation_time(), 0.1);
+	for (const auto timestep : application.timesteps)
+	{
+		ASSERT_DOUBLE_EQ(timestep, 1.0 / 200.0);
+	}
+	for (const auto alpha : application.alphas)
+	{
+		ASSERT_GE(alpha, 0.0);
+		ASSERT_LT(alpha, 1.0);
+	}
+	// Rendering at 100 Hz against a 200 Hz simulation takes two steps per frame after the first, and the frame whose
+	// step asked to exit is not rendered
+	ASSERT_EQ(application.get_frame_count(), 10);
+	ASSERT_EQ(application.alphas.size(), 10);
+}
+
+TEST(Application, render_rate_independent_of_simulation)
+{
+	TestApplication application{ ApplicationSettings{ 1.0 / 20.0, 0.25, 8, 200.0, false, false } };
+	application.manual_clock = true;
+	application.exit_after_frames = 20;
+	application.run();
+
+	// 20 frames at 200 Hz span 95 ms, one step of a 20 Hz simulation
+	ASSERT_EQ(application.get_frame_count(), 20);
+	ASSERT_EQ(application.get_step_count(), 1);
+	ASSERT_LT(application.alphas.front(), application.alphas.back());
+}
+
+TEST(Application, headless)
+{
+	TestApplication application{ ApplicationSettings{ 1.0 / 500.0, 0.25, 8, 60.0, true, false } };
+	application.exit_after_steps = 10;
+
+	const auto start = Application::clock::now();
+	application.run();
+
+	ASSERT_TRUE(application.alphas.empty());
+	ASSERT_EQ(application.get_step_count(), 10);
+	ASSERT_GE(Application::clock::now() - start, std::chrono::milliseconds{ 18 });
+}
+
+TEST(Application, uncapped)
+{
+	TestApplication application{ ApplicationSettings{ 1.0, 0.25, 8, 60.0, true, true } };
+	application.exit_after_steps = 1000;
+
+	const auto start = Application::clock::now();
+	application.run();
+
+	ASSERT_EQ(application.get_step_count(), 1000);
+	ASSERT_DOUBLE_EQ(application.get_simulation_time(), 1000.0);
+	ASSERT_LT(Application::clock::now() - start, std::chrono::seconds{ 1 });
+}
+
+TEST(Application, spiral_of_death_protection)
+{
+	TestApplication application{ ApplicationSettings{ 1.0 / 1000.0, 0.05, 4, 0.0, false, false } };
+	application.step_duration = std::chrono::milliseconds{ 3 };
+	application.exit_after_steps = 40;
+	application.run();
+
+	ASSERT_LE(application.get_step_count(), application.get_frame_count() * 4);
+	ASSERT_GT(application.get_dropped_step_count(), 0);
+}
+
+TEST(Interpolated, get)
+{
+	Interpolated<Vector3> position{ { 0.0f, 0.0f, 0.0f } };
+	position.set({ 2.0f, 4.0f, 6.0f });
+
+	const auto middle = position.get(0.5);
+	ASSERT_FLOAT_EQ(middle.x, 1.0f);
+	ASSERT_FLOAT_EQ(middle.y, 2.0f);
+	ASSERT_FLOAT_EQ(middle.z, 3.0f);
+
+	position.set({ 4.0f, 4.0f, 6.0f });
+	ASSERT_FLOAT_EQ(position.get(0.0).x, 2.0f);
+	ASSERT_FLOAT_EQ(position.get(1.0).x, 4.0f);
+
+	position.reset({ 9.0f, 0.0f, 0.0f });
+	ASSERT_FLOAT_EQ(position.get(0.25).x, 9.0f);
+}
\ No newline at end of file
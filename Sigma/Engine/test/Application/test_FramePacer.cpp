@@ -0,0 +1,26 @@
+#include <gtest/gtest.h>
+
+#include <Sigma/Engine/Application/FramePacer.hpp>
+
+using namespace sigma;
+
+TEST(FramePacer, wait_until)
+{
+	FramePacer pacer{};
+	for (auto frame = 0; frame < 5; ++frame)
+	{
+		const auto deadline = FramePacer::clock::now() + std::chrono::milliseconds{ 4 };
+		pacer.wait_until(deadline);
+		ASSERT_GE(FramePacer::clock::now(), deadline);
+	}
+	ASSERT_GT(pacer.get_sleep_estimate(), 0.0);
+}
+
+TEST(FramePacer, wait_until_past_deadline)
+{
+	FramePacer pacer{};
+	const auto start = FramePacer::clock::now();
+	pacer.wait_until(start - std::chrono::milliseconds{ 10 });
+
+	ASSERT_LT(FramePacer::clock::now() - start, std::chrono::milliseconds{ 5 });
+}
\ No newline at end of file
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <fstream>
+#include <string_view>
+
+#include <Sigma/Engine/Assets/AssetArchive.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	std::span<const std::byte> as_bytes(const std::string_view text)
+	{
+		return std::as_bytes(std::span{ text.data(), text.size() });
+	}
+
+	std::string_view as_text(const AssetData& data)
+	{
+		const auto bytes = data.get_bytes();
+		return { reinterpret_cast<const char*>(bytes.data()), bytes.size() };
+	}
+
+	std::filesystem::path get_archive_path(const std::string_view name)
+	{
+		return std::filesystem::temp_directory_path() / name;
+	}
+
+	const std::string k_compressible(2000, 'x');
+}
+
+TEST(AssetArchive, make_asset_id)
+{
+	static_assert(make_asset_id("") == 14695981039346656037ull);
+	ASSERT_EQ(make_asset_id("textures/stone.png"), make_asset_id("textures\\stone.png"));
+	ASSERT_NE(make_asset_id("textures/stone.png"), make_asset_id("textures/stone.jpg"));
+}
+
+TEST(AssetArchive, write_and_load)
+{
+	AssetArchiveWriter writer{};
+	ASSERT_TRUE(writer.add(make_asset_id("a.txt"), as_bytes("first")));
+	ASSERT_TRUE(writer.add(make_asset_id("b.txt"), as_bytes(k_compressible), Compression::lz4));
+	ASSERT_TRUE(writer.add(make_asset_id("empty.txt"), {}));
+	const auto path = get_archive_path("sigma_test_archive.sgar");
+	ASSERT_TRUE(writer.write(path));
+
+	AssetArchive archive{};
+	ASSERT_TRUE(archive.open(path));
+	ASSERT_EQ(archive.get_entries().size(), 3);
+
+	AssetData data{};
+	ASSERT_EQ(archive.load(make_asset_id("a.txt"), data), AssetStatus::loaded);
+	ASSERT_EQ(as_text(data), "first");
+	ASSERT_TRUE(data.is_zero_copy());
+
+	ASSERT_EQ(archive.load(make_asset_id("b.txt"), data), AssetStatus::loaded);
+	ASSERT_EQ(as_text(data), k_compressible);
+	ASSERT_FALSE(data.is_zero_copy());
+	ASSERT_LT(archive.find(make_asset_id("b.txt"))->stored_size, k_compressible.size());
+
+	ASSERT_EQ(archive.load(make_asset_id("empty.txt"), data), AssetStatus::loaded);
+	ASSERT_TRUE(data.get_bytes().empty());
+
+	ASSERT_EQ(archive.load(make_asset_id("missing.txt"), data), AssetStatus::not_found);
+}
+
+TEST(AssetArchive, entries_are_aligned_and_sorted)
+{
+	AssetArchiveWriter writer{ 256 };
+	for (UInt32 index = 0; index < 20; ++index)
+	{
+		const std::string name = "asset_" + std::to_string(index);
+		ASSERT_TRUE(writer.add(make_asset_id(name), as_bytes(name)));
+	}
+	const auto path = get_archive_path("sigma_test_archive_aligned.sgar");
+	ASSERT_TRUE(writer.write(path));
+
+	AssetArchive archive{};
+	ASSERT_TRUE(archive.open(path));
+	const auto& entries = archive.get_entries();
+	for (std::size_t index = 0; index < entries.size(); ++index)
+	{
+		ASSERT_EQ(entries[index].offset % 256, 0);
+		ASSERT_EQ(reinterpret_cast<std::uintptr_t>(archive.get_stored_bytes(entries[index]).data()) % 256, 0);
+		if (index > 0)
+		{
+			ASSERT_LT(entries[index - 1].id, entries[index].id);
+		}
+	}
+}
+
+TEST(AssetArchive, incompressible_entries_are_stored)
+{
+	AssetArchiveWriter writer{};
+	ASSERT_TRUE(writer.add(make_asset_id("short"), as_bytes("abc"), Compression::lz4));
+	const auto path = get_archive_path("sigma_test_archive_stored.sgar");
+	ASSERT_TRUE(writer.write(path));
+
+	AssetArchive archive{};
+	ASSERT_TRUE(archive.open(path));
+	ASSERT_EQ(archive.find(make_asset_id("short"))->compression, Compression::none);
+}
+
+TEST(AssetArchive, rejects_duplicates)
+{
+	AssetArchiveWriter writer{};
+	ASSERT_TRUE(writer.add(make_asset_id("a"), as_bytes("1")));
+	ASSERT_TRUE(writer.add(make_asset_id("a"), as_bytes("2")));
+	ASSERT_FALSE(writer.write(get_archive_path("sigma_test_archive_duplicate.sgar")));
+}
+
+TEST(AssetArchive, rejects_invalid_files)
+{
+	AssetArchive archive{};
+	ASSERT_FALSE(archive.open(get_archive_path("sigma_test_archive_does_not_exist.sgar")));
+
+	const auto path = get_archive_path("sigma_test_archive_invalid.sgar");
+	{
+		std::ofstream file{ path, std::ios::binary };
+		file << "definitely not an archive";
+	}
+	ASSERT_FALSE(archive.open(path));
+	ASSERT_FALSE(archive.is_open());
+
+	// Valid header but a truncated file
+	AssetArchiveWriter writer{};
+	ASSERT_TRUE(writer.add(make_asset_id("a"), as_bytes(k_compressible)));
+	ASSERT_TRUE(writer.write(path));
+	std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+	ASSERT_FALSE(archive.open(path));
+}
\ No newline at end of file
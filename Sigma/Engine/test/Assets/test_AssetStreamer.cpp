@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+
+#include <Sigma/Engine/Assets/AssetStreamer.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	constexpr UInt32 k_asset_count = 200;
+
+	std::string make_content(const UInt32 index)
+	{
+		return std::string(64 + index * 16, static_cast<char>('a' + index % 26));
+	}
+
+	AssetArchive make_archive()
+	{
+		AssetArchiveWriter writer{};
+		for (UInt32 index = 0; index < k_asset_count; ++index)
+		{
+			const auto content = make_content(index);
+			const auto compression = index % 2 == 0 ? Compression::none : Compression::lz4;
+			EXPECT_TRUE(writer.add(index, std::as_bytes(std::span{ content.data(), content.size() }), compression));
+		}
+		const auto path = std::filesystem::temp_directory_path() / "sigma_test_streamer.sgar";
+		EXPECT_TRUE(writer.write(path));
+
+		AssetArchive archive{};
+		EXPECT_TRUE(archive.open(path));
+		return archive;
+	}
+}
+
+TEST(AssetStreamer, loads_every_request)
+{
+	const auto archive = make_archive();
+	JobSystem job_system{ 2 };
+	AssetStreamer streamer{ archive, job_system };
+
+	std::mutex mutex{};
+	std::vector<UInt32> loaded(k_asset_count, 0);
+	UInt32 zero_copy_count = 0;
+	for (UInt32 index = 0; index < k_asset_count; ++index)
+	{
+		streamer.request(index, index % 4, [&](const AssetId id, const AssetStatus status, const AssetData data)
+		{
+			const auto bytes = data.get_bytes();
+			const auto content = make_content(static_cast<UInt32>(id));
+			const auto matches = status == AssetStatus::loaded &&
+				std::string_view{ reinterpret_cast<const char*>(bytes.data()), bytes.size() } == content;
+
+			std::lock_guard lock{ mutex };
+			loaded[id] += matches ? 1u : 0u;
+			zero_copy_count += data.is_zero_copy() ? 1u : 0u;
+		});
+	}
+	streamer.wait_idle();
+
+	ASSERT_EQ(streamer.get_pending_count(), 0);
+	for (const auto count : loaded)
+	{
+		ASSERT_EQ(count, 1);
+	}
+	ASSERT_EQ(zero_copy_count, k_asset_count / 2);
+}
+
+TEST(AssetStreamer, reports_missing_assets)
+{
+	const auto archive = make_archive();
+	JobSystem job_system{ 0 };
+	AssetStreamer streamer{ archive, job_system, 1 };
+
+	auto status = AssetStatus::loaded;
+	streamer.request(k_asset_count + 1, 0, [&](AssetId, const AssetStatus result, AssetData) { status = result; });
+	streamer.wait_idle();
+	ASSERT_EQ(status, AssetStatus::not_found);
+}
+
+TEST(AssetStreamer, higher_priority_first)
+{
+	const auto archive = make_archive();
+	JobSystem job_system{ 0 };
+	AssetStreamer streamer{ archive, job_system, 1 };
+
+	// The first request holds the only I/O thread until the rest have been queued
+	std::mutex gate{};
+	std::unique_lock gate_lock{ gate };
+	std::vector<AssetId> order{};
+	std::atomic<bool> started{ false };
+	streamer.request(0, 0, [&](const AssetId id, AssetStatus, AssetData)
+	{
+		started.store(true);
+		std::lock_guard lock{ gate };
+		order.push_back(id);
+	});
+	while (!started.load())
+	{
+		std::this_thread::yield();
+	}
+
+	const auto record = [&](const AssetId id, AssetStatus, AssetData) { order.push_back(id); };
+	streamer.request(2, 1, record);
+	streamer.request(4, 5, record);
+	streamer.request(6, 1, record);
+	streamer.request(8, 3, record);
+	gate_lock.unlock();
+	streamer.wait_idle();
+
+	ASSERT_EQ(order, (std::vector<AssetId>{ 0, 4, 8, 2, 6 }));
+}
\ No newline at end of file
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include <Sigma/Engine/Assets/Compression.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	std::vector<std::byte> make_repetitive_data(const std::size_t size)
+	{
+		std::vector<std::byte> data(size);
+		std::mt19937 random{ 7 };
+		for (std::size_t index = 0; index < size; ++index)
+		{
+			// Runs of text-like bytes with occasional noise
+			data[index] = index % 97 < 80 ? static_cast<std::byte>('a' + index % 13) : static_cast<std::byte>(random() & 0xFF);
+		}
+		return data;
+	}
+
+	std::vector<std::byte> round_trip(const Compression compression, const std::vector<std::byte>& data)
+	{
+		std::vector<std::byte> compressed{};
+		EXPECT_TRUE(compress(compression, data, compressed));
+
+		std::vector<std::byte> decompressed(data.size());
+		EXPECT_TRUE(decompress(compression, compressed, decompressed));
+		return decompressed;
+	}
+}
+
+TEST(Compression, lz4_round_trip)
+{
+	for (const std::size_t size : { 0u, 1u, 12u, 13u, 100u, 4096u, 300000u })
+	{
+		const auto data = make_repetitive_data(size);
+		ASSERT_EQ(round_trip(Compression::lz4, data), data);
+	}
+}
+
+TEST(Compression, lz4_shrinks_repetitive_data)
+{
+	const auto data = make_repetitive_data(65536);
+	std::vector<std::byte> compressed{};
+	ASSERT_TRUE(compress(Compression::lz4, data, compressed));
+	ASSERT_LT(compressed.size(), data.size() / 2);
+}
+
+TEST(Compression, lz4_long_matches_and_literals)
+{
+	// One long literal run followed by a single overlapping match over a constant block
+	std::vector<std::byte> data{};
+	std::mt19937 random{ 3 };
+	for (std::size_t index = 0; index < 1000; ++index)
+	{
+		data.push_back(static_cast<std::byte>(random() & 0xFF));
+	}
+	data.insert(data.end(), 5000, std::byte{ 42 });
+
+	ASSERT_EQ(round_trip(Compression::lz4, data), data);
+}
+
+TEST(Compression, lz4_decodes_reference_block)
+{
+	// "abcabcabcabcabcabc" as emitted by the reference encoder: 3 literals, then a 15 byte match at offset 3
+	const std::vector<std::byte> block{
+		std::byte{ 0x3B }, std::byte{ 'a' }, std::byte{ 'b' }, std::byte{ 'c' }, std::byte{ 0x03 }, std::byte{ 0x00 },
+		std::byte{ 0x00 } };
+	std::vector<std::byte> decompressed(18);
+	ASSERT_TRUE(decompress(Compression::lz4, block, decompressed));
+	for (std::size_t index = 0; index < decompressed.size(); ++index)
+	{
+		ASSERT_EQ(decompressed[index], static_cast<std::byte>('a' + index % 3));
+	}
+}
+
+TEST(Compression, lz4_rejects_malformed_input)
+{
+	const auto data = make_repetitive_data(4096);
+	std::vector<std::byte> compressed{};
+	ASSERT_TRUE(compress(Compression::lz4, data, compressed));
+
+	std::vector<std::byte> decompressed(data.size());
+	const std::vector<std::byte> truncated(compressed.begin(), compressed.begin() + static_cast<std::ptrdiff_t>(compressed.size() / 2));
+	ASSERT_FALSE(decompress(Compression::lz4, truncated, decompressed));
+
+	std::vector<std::byte> too_small(data.size() - 1);
+	ASSERT_FALSE(decompress(Compression::lz4, compressed, too_small));
+
+	// Offset pointing before the start of the output
+	const std::vector<std::byte> bad_offset{ std::byte{ 0x10 }, std::byte{ 'a' }, std::byte{ 0x05 }, std::byte{ 0x00 }, std::byte{ 0x00 } };
+	std::vector<std::byte> output(5);
+	ASSERT_FALSE(decompress(Compression::lz4, bad_offset, output));
+}
+
+TEST(Compression, none_copies)
+{
+	const auto data = make_repetitive_data(100);
+	ASSERT_EQ(round_trip(Compression::none, data), data);
+}
+
+TEST(Compression, max_decompressed_size)
+{
+	const auto data = make_repetitive_data(300000);
+	std::vector<std::byte> compressed{};
+	ASSERT_TRUE(compress(Compression::lz4, data, compressed));
+	ASSERT_GE(get_max_decompressed_size(Compression::lz4, compressed), data.size());
+	ASSERT_LT(get_max_decompressed_size(Compression::lz4, std::span{ compressed }.first(10)), data.size());
+	ASSERT_EQ(get_max_decompressed_size(Compression::none, data), data.size());
+}
+
+TEST(Compression, zstd_matches_support)
+{
+	const auto data = make_repetitive_data(10000);
+	std::vector<std::byte> compressed{};
+	ASSERT_EQ(compress(Compression::zstd, data, compressed), is_compression_supported(Compression::zstd));
+	if (is_compression_supported(Compression::zstd))
+	{
+		ASSERT_EQ(round_trip(Compression::zstd, data), data);
+	}
+}
\ No newline at end of file
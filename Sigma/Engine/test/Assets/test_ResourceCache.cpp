@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include <Sigma/Engine/Assets/ResourceCache.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	// Every resource is its id as text and weighs 100 bytes, ids above 1000 fail to load
+	ResourceCache<std::string>::loader_type make_loader(std::atomic<UInt32>& load_count)
+	{
+		return [&load_count](const AssetId id, std::string& resource, std::size_t& byte_size)
+		{
+			++load_count;
+			resource = std::to_string(id);
+			byte_size = 100;
+			return id <= 1000;
+		};
+	}
+}
+
+TEST(ResourceCache, acquire_shares_resources)
+{
+	std::atomic<UInt32> load_count{};
+	ResourceCache<std::string> cache{ make_loader(load_count), 1000 };
+
+	const auto first = cache.acquire(7);
+	const auto second = cache.acquire(7);
+	ASSERT_TRUE(first.is_valid());
+	ASSERT_EQ(first, second);
+	ASSERT_EQ(*cache.get(first), "7");
+	ASSERT_EQ(load_count, 1);
+
+	const auto statistics = cache.get_statistics();
+	ASSERT_EQ(statistics.hits, 1);
+	ASSERT_EQ(statistics.misses, 1);
+	ASSERT_EQ(statistics.resident_bytes, 100);
+	ASSERT_EQ(statistics.resident_count, 1);
+
+	ASSERT_EQ(cache.acquire("textures/stone.png"), cache.acquire(make_asset_id("textures/stone.png")));
+}
+
+TEST(ResourceCache, failed_load)
+{
+	std::atomic<UInt32> load_count{};
+	ResourceCache<std::string> cache{ make_loader(load_count), 1000 };
+
+	const auto handle = cache.acquire(2000);
+	ASSERT_FALSE(handle.is_valid());
+	ASSERT_EQ(cache.get(handle), nullptr);
+	ASSERT_FALSE(cache.is_resident(2000));
+	ASSERT_EQ(cache.get_statistics().resident_count, 0);
+}
+
+TEST(ResourceCache, released_resources_stay_cached)
+{
+	std::atomic<UInt32> load_count{};
+	ResourceCache<std::string> cache{ make_loader(load_count), 1000 };
+
+	const auto handle = cache.acquire(1);
+	cache.release(handle);
+	ASSERT_TRUE(cache.is_resident(1));
+	ASSERT_EQ(cache.acquire(1), handle);
+	ASSERT_EQ(load_count, 1);
+}
+
+TEST(ResourceCache, evicts_least_recently_released)
+{
+	std::atomic<UInt32> load_count{};
+	ResourceCache<std::string> cache{ make_loader(load_count), 300 };
+
+	const auto first = cache.acquire(1);
+	const auto second = cache.acquire(2);
+	const auto third = cache.acquire(3);
+	cache.release(second);
+	cache.release(first);
+	cache.release(third);
+
+	// Over budget only once the fourth resource is resident; the first one released goes
+	const auto fourth = cache.acquire(4);
+	ASSERT_FALSE(cache.is_resident(2));
+	ASSERT_TRUE(cache.is_resident(1));
+	ASSERT_FALSE(cache.is_valid(second));
+	ASSERT_EQ(cache.get(second), nullptr);
+	ASSERT_EQ(cache.get_statistics().evictions, 1);
+
+	// Referenced resources are never evicted, even over budget
+	cache.set_byte_budget(0);
+	ASSERT_TRUE(cache.is_valid(fourth));
+	ASSERT_EQ(cache.get_statistics().resident_count, 1);
+	ASSERT_EQ(cache.get_statistics().resident_bytes, 100);
+}
+
+TEST(ResourceCache, stale_handles_after_slot_reuse)
+{
+	std::atomic<UInt32> load_count{};
+	ResourceCache<std::string> cache{ make_loader(load_count), 1000 };
+
+	const auto stale = cache.acquire(1);
+	cache.release(stale);
+	cache.clear_unused();
+
+	const auto fresh = cache.acquire(2);
+	ASSERT_EQ(fresh.index, stale.index);
+	ASSERT_NE(fresh.generation, stale.generation);
+	ASSERT_FALSE(cache.is_valid(stale));
+	ASSERT_FALSE(cache.retain(stale));
+
+	// Releasing a stale handle must not touch the resource now in the slot
+	cache.release(stale);
+	ASSERT_EQ(*cache.get(fresh), "2");
+}
+
+TEST(ResourceCache, retain)
+{
+	std::atomic<UInt32> load_count{};
+	ResourceCache<std::string> cache{ make_loader(load_count), 0 };
+
+	const auto handle = cache.acquire(1);
+	ASSERT_TRUE(cache.retain(handle));
+	cache.release(handle);
+	ASSERT_TRUE(cache.is_valid(handle));
+	cache.release(handle);
+	ASSERT_FALSE(cache.is_valid(handle));
+}
+
+TEST(ResourceCache, concurrent_acquires_load_once)
+{
+	std::atomic<UInt32> load_count{};
+	std::atomic<bool> release_loader{ false };
+	ResourceCache<std::string> cache{ [&](const AssetId id, std::string& resource, std::size_t& byte_size)
+	{
+		++load_count;
+		while (!release_loader)
+		{
+			std::this_thread::yield();
+		}
+		resource = std::to_string(id);
+		byte_size = 1;
+		return true;
+	}, 1000 };
+
+	constexpr std::size_t k_thread_count = 4;
+	std::vector<ResourceHandle> handles(k_thread_count);
+	std::vector<std::jthread> threads{};
+	for (std::size_t index = 0; index < k_thread_count; ++index)
+	{
+		threads.emplace_back([&, index]() { handles[index] = cache.acquire(5); });
+	}
+	while (load_count == 0)
+	{
+		std::this_thread::yield();
+	}
+	release_loader = true;
+	threads.clear();
+
+	ASSERT_EQ(load_count, 1);
+	for (const auto handle : handles)
+	{
+		ASSERT_EQ(handle, handles.front());
+	}
+	ASSERT_EQ(cache.get_statistics().misses, 1);
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include <Sigma/Engine/Culling/CullingBounds.hpp>
+
+using namespace sigma;
+
+TEST(CullingBounds, set_box)
+{
+	CullingBounds bounds{ 16 };
+	bounds.set(3, Aabb{ { 0.0f, 0.0f, 0.0f }, { 2.0f, 4.0f, 6.0f } });
+
+	const auto streams = bounds.get_streams();
+	ASSERT_EQ(streams.size, 1);
+	ASSERT_FLOAT_EQ(streams.center_x[0], 1.0f);
+	ASSERT_FLOAT_EQ(streams.center_y[0], 2.0f);
+	ASSERT_FLOAT_EQ(streams.center_z[0], 3.0f);
+	ASSERT_FLOAT_EQ(streams.extent_x[0], 1.0f);
+	ASSERT_FLOAT_EQ(streams.extent_y[0], 2.0f);
+	ASSERT_FLOAT_EQ(streams.extent_z[0], 3.0f);
+	ASSERT_FLOAT_EQ(streams.radius[0], std::sqrt(14.0f));
+	ASSERT_EQ(bounds.get_entity(0), 3);
+}
+
+TEST(CullingBounds, set_sphere)
+{
+	CullingBounds bounds{ 16 };
+	bounds.set(1, Sphere{ { 1.0f, 2.0f, 3.0f }, 2.0f });
+
+	const auto streams = bounds.get_streams();
+	ASSERT_FLOAT_EQ(streams.radius[0], 2.0f);
+	ASSERT_FLOAT_EQ(streams.extent_x[0], 2.0f);
+	ASSERT_FLOAT_EQ(streams.extent_z[0], 2.0f);
+	ASSERT_FLOAT_EQ(streams.center_y[0], 2.0f);
+}
+
+TEST(CullingBounds, set_existing_updates_in_place)
+{
+	CullingBounds bounds{ 16 };
+	bounds.set(1, Sphere{ { 0.0f, 0.0f, 0.0f }, 1.0f });
+	bounds.set(2, Sphere{ { 0.0f, 0.0f, 0.0f }, 1.0f });
+	bounds.set(1, Sphere{ { 5.0f, 0.0f, 0.0f }, 1.0f });
+
+	ASSERT_EQ(bounds.size(), 2);
+	ASSERT_EQ(bounds.get_entity(0), 1);
+	ASSERT_FLOAT_EQ(bounds.get_streams().center_x[0], 5.0f);
+}
+
+TEST(CullingBounds, erase)
+{
+	CullingBounds bounds{ 16 };
+	bounds.set(1, Sphere{ { 1.0f, 0.0f, 0.0f }, 1.0f });
+	bounds.set(2, Sphere{ { 2.0f, 0.0f, 0.0f }, 1.0f });
+	bounds.set(3, Sphere{ { 3.0f, 0.0f, 0.0f }, 1.0f });
+
+	bounds.erase(1);
+	ASSERT_EQ(bounds.size(), 2);
+	ASSERT_FALSE(bounds.contains(1));
+	ASSERT_EQ(bounds.get_entity(0), 3);
+	ASSERT_FLOAT_EQ(bounds.get_streams().center_x[0], 3.0f);
+
+	bounds.erase(3);
+	bounds.set(3, Sphere{ { 4.0f, 0.0f, 0.0f }, 1.0f });
+	ASSERT_EQ(bounds.get_entities(), (std::vector<Entity>{ 2, 3 }));
+	ASSERT_FLOAT_EQ(bounds.get_streams().center_x[1], 4.0f);
+}
\ No newline at end of file
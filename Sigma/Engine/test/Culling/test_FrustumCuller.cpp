@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include <Sigma/Engine/Culling/FrustumCuller.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	Matrix4x4 make_view_projection()
+	{
+		const auto view = DirectX::XMMatrixLookAtLH(DirectX::XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f), DirectX::XMVectorSet(0.0f, 0.0f, 1.0f, 1.0f), DirectX::XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f));
+		const auto projection = DirectX::XMMatrixPerspectiveFovLH(DirectX::XM_PIDIV2, 1.0f, 1.0f, 100.0f);
+
+		Matrix4x4 result{};
+		DirectX::XMStoreFloat4x4(&result, DirectX::XMMatrixMultiply(view, projection));
+		return result;
+	}
+
+	std::vector<UInt32> cull_reference(const CullingBounds& bounds, const Frustum& frustum, const CullingVolume volume)
+	{
+		const auto streams = bounds.get_streams();
+		std::vector<UInt32> visible{};
+		for (std::size_t index = 0; index < streams.size; ++index)
+		{
+			auto inside = true;
+			for (const auto& plane : frustum.planes)
+			{
+				const auto distance = streams.center_x[index] * plane.x + streams.center_y[index] * plane.y + streams.center_z[index] * plane.z + plane.w;
+				const auto reach = volume == CullingVolume::sphere ? streams.radius[index]
+					: streams.extent_x[index] * std::abs(plane.x) + streams.extent_y[index] * std::abs(plane.y) + streams.extent_z[index] * std::abs(plane.z);
+				inside = inside && distance + reach >= 0.0f;
+			}
+			if (inside)
+			{
+				visible.push_back(static_cast<UInt32>(index));
+			}
+		}
+		return visible;
+	}
+
+	CullingBounds make_random_bounds(const std::size_t count)
+	{
+		std::mt19937 generator{ 7 };
+		std::uniform_real_distribution<float> position{ -150.0f, 150.0f };
+		std::uniform_real_distribution<float> size{ 0.1f, 5.0f };
+
+		CullingBounds bounds{ count };
+		for (std::size_t index = 0; index < count; ++index)
+		{
+			const Vector3 center{ position(generator), position(generator), position(generator) };
+			const Vector3 extents{ size(generator), size(generator), size(generator) };
+			bounds.set(index, Aabb{ { center.x - extents.x, center.y - extents.y, center.z - extents.z }, { center.x + extents.x, center.y + extents.y, center.z + extents.z } });
+		}
+		return bounds;
+	}
+}
+
+TEST(Frustum, make_frustum)
+{
+	const auto frustum = make_frustum(make_view_projection());
+	const auto get_distance = [](const Vector4& plane, const Vector3& point)
+	{
+		return plane.x * point.x + plane.y * point.y + plane.z * point.z + plane.w;
+	};
+
+	for (const auto& plane : frustum.planes)
+	{
+		ASSERT_GT(get_distance(plane, { 0.0f, 0.0f, 50.0f }), 0.0f);
+	}
+	ASSERT_NEAR(get_distance(frustum.planes[4], { 0.0f, 0.0f, 1.0f }), 0.0f, 1e-4f);
+	ASSERT_NEAR(get_distance(frustum.planes[5], { 0.0f, 0.0f, 100.0f }), 0.0f, 1e-3f);
+	ASSERT_LT(get_distance(frustum.planes[0], { -20.0f, 0.0f, 10.0f }), 0.0f);
+	ASSERT_LT(get_distance(frustum.planes[3], { 0.0f, 20.0f, 10.0f }), 0.0f);
+}
+
+TEST(FrustumCuller, cull_spheres)
+{
+	CullingBounds bounds{ 16 };
+	bounds.set(0, Sphere{ { 0.0f, 0.0f, 10.0f }, 1.0f });
+	bounds.set(1, Sphere{ { 0.0f, 0.0f, -10.0f }, 1.0f });
+	bounds.set(2, Sphere{ { 11.0f, 0.0f, 10.0f }, 2.0f });
+	bounds.set(3, Sphere{ { 0.0f, 0.0f, 200.0f }, 1.0f });
+	bounds.set(4, Sphere{ { 0.0f, 0.0f, 0.0f }, 1.5f });
+
+	JobSystem job_system{ 2 };
+	FrustumCuller culler{};
+	std::vector<UInt32> visible{};
+	culler.cull(bounds, make_frustum(make_view_projection()), CullingVolume::sphere, visible, job_system);
+
+	ASSERT_EQ(visible, (std::vector<UInt32>{ 0, 2, 4 }));
+}
+
+TEST(FrustumCuller, cull_boxes)
+{
+	CullingBounds bounds{ 16 };
+	bounds.set(0, Aabb{ { -1.0f, -1.0f, 9.0f }, { 1.0f, 1.0f, 11.0f } });
+	bounds.set(1, Aabb{ { 30.0f, -1.0f, 9.0f }, { 32.0f, 1.0f, 11.0f } });
+	bounds.set(2, Aabb{ { -1.0f, -1.0f, 99.0f }, { 1.0f, 1.0f, 101.0f } });
+
+	JobSystem job_system{ 2 };
+	FrustumCuller culler{};
+	std::vector<UInt32> visible{};
+	culler.cull(bounds, make_frustum(make_view_projection()), CullingVolume::box, visible, job_system);
+
+	ASSERT_EQ(visible, (std::vector<UInt32>{ 0, 2 }));
+}
+
+TEST(FrustumCuller, cull_matches_scalar_reference)
+{
+	const auto bounds = make_random_bounds(3 * FrustumCuller::k_chunk_size + 7);
+	const auto frustum = make_frustum(make_view_projection());
+
+	JobSystem job_system{ 3 };
+	FrustumCuller culler{};
+	std::vector<UInt32> visible{};
+	for (const auto volume : { CullingVolume::sphere, CullingVolume::box })
+	{
+		culler.cull(bounds, frustum, volume, visible, job_system);
+		ASSERT_EQ(visible, cull_reference(bounds, frustum, volume));
+		ASSERT_FALSE(visible.empty());
+	}
+}
+
+TEST(FrustumCuller, cull_empty)
+{
+	CullingBounds bounds{ 4 };
+	JobSystem job_system{ 1 };
+	FrustumCuller culler{};
+	std::vector<UInt32> visible{ 1, 2 };
+	culler.cull(bounds, make_frustum(make_view_projection()), CullingVolume::sphere, visible, job_system);
+
+	ASSERT_TRUE(visible.empty());
+}
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <Sigma/Engine/Culling/OcclusionBuffer.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	Matrix4x4 make_view_projection()
+	{
+		const auto view = DirectX::XMMatrixLookAtLH(DirectX::XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f), DirectX::XMVectorSet(0.0f, 0.0f, 1.0f, 1.0f), DirectX::XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f));
+		const auto projection = DirectX::XMMatrixPerspectiveFovLH(DirectX::XM_PIDIV2, 1.0f, 1.0f, 100.0f);
+
+		Matrix4x4 result{};
+		DirectX::XMStoreFloat4x4(&result, DirectX::XMMatrixMultiply(view, projection));
+		return result;
+	}
+
+	Aabb make_box(const float x, const float y, const float z, const float half_extent)
+	{
+		return { { x - half_extent, y - half_extent, z - half_extent }, { x + half_extent, y + half_extent, z + half_extent } };
+	}
+}
+
+TEST(OcclusionBuffer, empty_buffer_hides_nothing)
+{
+	OcclusionBuffer buffer{ 64, 64 };
+	buffer.clear(make_view_projection());
+	buffer.finalize();
+
+	ASSERT_TRUE(buffer.is_visible(make_box(0.0f, 0.0f, 50.0f, 1.0f)));
+	ASSERT_FLOAT_EQ(buffer.get_depth(10, 10), 1.0f);
+}
+
+TEST(OcclusionBuffer, add_occluder)
+{
+	OcclusionBuffer buffer{ 64, 64 };
+	buffer.clear(make_view_projection());
+	buffer.add_occluder(make_box(0.0f, 0.0f, 10.0f, 2.0f));
+	buffer.finalize();
+
+	ASSERT_LT(buffer.get_depth(32, 32), 1.0f);
+	ASSERT_FLOAT_EQ(buffer.get_depth(1, 1), 1.0f);
+}
+
+TEST(OcclusionBuffer, is_visible)
+{
+	OcclusionBuffer buffer{ 64, 64 };
+	buffer.clear(make_view_projection());
+	buffer.add_occluder(make_box(0.0f, 0.0f, 10.0f, 4.0f));
+	buffer.finalize();
+
+	ASSERT_FALSE(buffer.is_visible(make_box(0.0f, 0.0f, 40.0f, 1.0f)));
+	ASSERT_TRUE(buffer.is_visible(make_box(0.0f, 0.0f, 3.0f, 1.0f)));
+	ASSERT_TRUE(buffer.is_visible(make_box(30.0f, 0.0f, 40.0f, 1.0f)));
+	ASSERT_TRUE(buffer.is_visible(make_box(0.0f, 0.0f, 40.0f, 20.0f)));
+	ASSERT_TRUE(buffer.is_visible(make_box(0.0f, 0.0f, 0.0f, 1.0f)));
+}
+
+TEST(OcclusionBuffer, add_occluder_triangles)
+{
+	const std::vector<Vector3> vertices{ { -20.0f, -20.0f, 20.0f }, { 20.0f, -20.0f, 20.0f }, { 20.0f, 20.0f, 20.0f }, { -20.0f, 20.0f, 20.0f } };
+	const std::vector<UInt32> indices{ 0, 1, 2, 0, 2, 3 };
+
+	OcclusionBuffer buffer{ 32, 32 };
+	buffer.clear(make_view_projection());
+	buffer.add_occluder(vertices, indices);
+	buffer.finalize();
+
+	ASSERT_FALSE(buffer.is_visible(make_box(5.0f, -5.0f, 60.0f, 2.0f)));
+	ASSERT_TRUE(buffer.is_visible(make_box(5.0f, -5.0f, 10.0f, 2.0f)));
+}
+
+TEST(OcclusionBuffer, cull)
+{
+	CullingBounds bounds{ 4096 };
+	for (Entity entity = 0; entity < 3000; ++entity)
+	{
+		const auto z = entity % 2 == 0 ? 50.0f : 5.0f;
+		bounds.set(entity, make_box(0.0f, 0.0f, z, 0.5f));
+	}
+
+	OcclusionBuffer buffer{ 64, 64 };
+	buffer.clear(make_view_projection());
+	buffer.add_occluder(make_box(0.0f, 0.0f, 20.0f, 5.0f));
+	buffer.finalize();
+
+	std::vector<UInt32> visible(bounds.size());
+	std::iota(visible.begin(), visible.end(), 0u);
+
+	JobSystem job_system{ 2 };
+	buffer.cull(bounds, visible, job_system);
+
+	ASSERT_EQ(visible.size(), 1500);
+	for (std::size_t entry = 0; entry < visible.size(); ++entry)
+	{
+		ASSERT_EQ(visible[entry], 2 * entry + 1);
+	}
+}
\ No newline at end of file
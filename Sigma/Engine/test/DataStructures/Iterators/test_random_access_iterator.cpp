@@ -11,6 +11,22 @@ auto get_mocked_container()
 	return std::array<int, 4>{10, 11, 12, 13};
 }
 
+TEST(RandomAccessIterator, iterator_concept)
+{
+	using Iterator = RandomAccessIterator<std::array<int, 4>, int, std::size_t>;
+	static_assert(std::random_access_iterator<Iterator>);
+	static_assert(std::is_signed_v<Iterator::difference_type>);
+}
+
+TEST(RandomAccessIterator, operator_subscript)
+{
+	auto container = get_mocked_container();
+	const auto iterator = RandomAccessIterator<std::array<int, 4>, int, std::size_t>(container, 1);
+	ASSERT_EQ(iterator[2], 13);
+	ASSERT_EQ(iterator[-1], 10);
+	ASSERT_EQ(*(2 + iterator), 13);
+}
+
 TEST(RandomAccessIterator, construction_default)
 {
 	RandomAccessIterator<std::array<int, 4>, int, std::size_t> iterator{};
@@ -99,9 +115,9 @@ TEST(RandomAccessIterator, operator_postIncrement)
 	auto iterator = RandomAccessIterator<std::array<int, 4>, int, std::size_t>(container);
 	ASSERT_EQ(*iterator, 10);
 
-	const auto new_iterator = iterator++;
-	ASSERT_EQ(*iterator, 10);
-	ASSERT_EQ(*new_iterator, 11);
+	const auto old_iterator = iterator++;
+	ASSERT_EQ(*iterator, 11);
+	ASSERT_EQ(*old_iterator, 10);
 }
 
 TEST(RandomAccessIterator, operator_postDecrement)
@@ -110,9 +126,9 @@ TEST(RandomAccessIterator, operator_postDecrement)
 	auto iterator = RandomAccessIterator<std::array<int, 4>, int, std::size_t>(container, 3);
 	ASSERT_EQ(*iterator, 13);
 
-	const auto new_iterator = iterator--;
-	ASSERT_EQ(*iterator, 13);
-	ASSERT_EQ(*new_iterator, 12);
+	const auto old_iterator = iterator--;
+	ASSERT_EQ(*iterator, 12);
+	ASSERT_EQ(*old_iterator, 13);
 }
 
 TEST(RandomAccessIterator, operator_plus_iterator)
@@ -241,6 +257,13 @@ TEST(RandomAccessIterator, operator_dereference)
 
 
 /* ConstRandomAccessIterator */
+TEST(ConstRandomAccessIterator, iterator_concept)
+{
+	using Iterator = ConstRandomAccessIterator<std::array<int, 4>, int, std::size_t>;
+	static_assert(std::random_access_iterator<Iterator>);
+	static_assert(std::is_same_v<std::iter_value_t<Iterator>, int>);
+}
+
 TEST(ConstRandomAccessIterator, construction_default)
 {
 	ConstRandomAccessIterator<std::array<int, 4>, int, std::size_t> iterator{};
@@ -329,9 +352,9 @@ TEST(ConstRandomAccessIterator, operator_postIncrement)
 	auto iterator = ConstRandomAccessIterator<std::array<int, 4>, int, std::size_t>(container);
 	ASSERT_EQ(*iterator, 10);
 
-	const auto new_iterator = iterator++;
-	ASSERT_EQ(*iterator, 10);
-	ASSERT_EQ(*new_iterator, 11);
+	const auto old_iterator = iterator++;
+	ASSERT_EQ(*iterator, 11);
+	ASSERT_EQ(*old_iterator, 10);
 }
 
 TEST(ConstRandomAccessIterator, operator_postDecrement)
@@ -340,9 +363,9 @@ TEST(ConstRandomAccessIterator, operator_postDecrement)
 	auto iterator = ConstRandomAccessIterator<std::array<int, 4>, int, std::size_t>(container, 3);
 	ASSERT_EQ(*iterator, 13);
 
-	const auto new_iterator = iterator--;
-	ASSERT_EQ(*iterator, 13);
-	ASSERT_EQ(*new_iterator, 12);
+	const auto old_iterator = iterator--;
+	ASSERT_EQ(*iterator, 12);
+	ASSERT_EQ(*old_iterator, 13);
 }
 
 TEST(ConstRandomAccessIterator, operator_plus_iterator)
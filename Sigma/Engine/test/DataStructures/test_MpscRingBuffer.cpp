@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include <Sigma/Engine/DataStructures/MpscRingBuffer.hpp>
+
+using namespace sigma;
+
+TEST(MpscRingBuffer, capacity_rounds_up)
+{
+	ASSERT_EQ(MpscRingBuffer<int>{ 5 }.capacity(), 8);
+	ASSERT_EQ(MpscRingBuffer<int>{ 16 }.capacity(), 16);
+}
+
+TEST(MpscRingBuffer, fifo_until_full)
+{
+	MpscRingBuffer<int> ring{ 4 };
+	for (auto value = 0; value < 4; ++value)
+	{
+		ASSERT_TRUE(ring.try_push(value));
+	}
+	ASSERT_FALSE(ring.try_push(4));
+
+	int value{};
+	ASSERT_TRUE(ring.try_pop(value));
+	ASSERT_EQ(value, 0);
+	ASSERT_TRUE(ring.try_push(4));
+
+	for (auto expected = 1; expected <= 4; ++expected)
+	{
+		ASSERT_TRUE(ring.try_pop(value));
+		ASSERT_EQ(value, expected);
+	}
+	ASSERT_FALSE(ring.try_pop(value));
+}
+
+TEST(MpscRingBuffer, concurrent_producers)
+{
+	constexpr std::size_t k_producer_count = 4;
+	constexpr std::size_t k_values_per_producer = 20000;
+
+	MpscRingBuffer<std::size_t> ring{ 256 };
+	std::vector<std::jthread> producers{};
+	for (std::size_t producer = 0; producer < k_producer_count; ++producer)
+	{
+		producers.emplace_back([&ring, producer]()
+		{
+			for (std::size_t value = 0; value < k_values_per_producer; ++value)
+			{
+				while (!ring.try_push(producer * k_values_per_producer + value))
+				{
+					std::this_thread::yield();
+				}
+			}
+		});
+	}
+
+	// Values of one producer have to come out in the order it pushed them
+	std::vector<std::size_t> next(k_producer_count, 0);
+	for (std::size_t popped = 0; popped < k_producer_count * k_values_per_producer;)
+	{
+		std::size_t value{};
+		if (!ring.try_pop(value))
+		{
+			std::this_thread::yield();
+			continue;
+		}
+		const auto producer = value / k_values_per_producer;
+		ASSERT_EQ(value % k_values_per_producer, next[producer]);
+		++next[producer];
+		++popped;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <Sigma/Engine/DataStructures/ShardedSparseSet.hpp>
+
+using namespace sigma;
+
+TEST(ShardedSparseSet, merge_moves_staged_elements)
+{
+	JobSystem jobs{ 0 };
+	ShardedSparseSet<int> sharded{ 3, 16 };
+	sharded.get_set().emplace(0, 1);
+	sharded.get_shard(0).emplace(4, 40);
+	sharded.get_shard(2).emplace(7, 70);
+	sharded.get_shard(2).emplace(2, 20);
+	ASSERT_EQ(sharded.get_staged_count(), 3);
+	ASSERT_FALSE(sharded.get_set().has_element(4));
+
+	sharded.merge(jobs);
+	const auto& set = sharded.get_set();
+	ASSERT_EQ(sharded.get_staged_count(), 0);
+	ASSERT_EQ(set.size(), 4);
+	ASSERT_EQ(set[0], 1);
+	ASSERT_EQ(set[4], 40);
+	ASSERT_EQ(set[7], 70);
+	ASSERT_EQ(set[2], 20);
+	ASSERT_EQ(set.get_indices(), (std::vector<std::size_t>{ 0, 4, 7, 2 }));
+
+	sharded.merge(jobs);
+	ASSERT_EQ(set.size(), 4);
+}
+
+TEST(ShardedSparseSet, parallel_inserts)
+{
+	constexpr std::size_t k_per_shard = 5000;
+
+	JobSystem jobs{ 3 };
+	ShardedSparseSet<std::size_t> sharded{ 4, 4 * k_per_shard * 2 };
+	for (auto frame = 0; frame < 2; ++frame)
+	{
+		const auto first = static_cast<std::size_t>(frame) * 4 * k_per_shard;
+		jobs.parallel_for(0, sharded.get_shard_count(), 1, [&](const std::size_t begin, const std::size_t end)
+		{
+			for (auto shard = begin; shard < end; ++shard)
+			{
+				for (std::size_t offset = 0; offset < k_per_shard; ++offset)
+				{
+					// Interleaved indices so every shard covers the whole range
+					const auto index = first + offset * 4 + shard;
+					sharded.get_shard(shard).emplace(index, index * 10);
+				}
+			}
+		});
+		sharded.merge(jobs, 1000);
+	}
+
+	const auto& set = sharded.get_set();
+	ASSERT_EQ(set.size(), 8 * k_per_shard);
+	for (std::size_t index = 0; index < 8 * k_per_shard; ++index)
+	{
+		ASSERT_TRUE(set.has_element(index));
+		ASSERT_EQ(set[index], index * 10);
+		ASSERT_EQ(set.get_index(set.get_dense_index(index)), index);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <Sigma/Engine/DataStructures/SnapshotBuffer.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	constexpr std::size_t k_page_size = SnapshotBuffer<int>::k_page_size;
+}
+
+TEST(SnapshotBuffer, empty_until_published)
+{
+	SnapshotBuffer<int> buffer{};
+	buffer.resize(10);
+	ASSERT_FALSE(buffer.acquire().is_valid());
+
+	ASSERT_TRUE(buffer.publish(1));
+	const auto view = buffer.acquire();
+	ASSERT_TRUE(view.is_valid());
+	ASSERT_EQ(view.size(), 10);
+	ASSERT_EQ(view.get_frame(), 1);
+}
+
+TEST(SnapshotBuffer, views_are_immutable)
+{
+	SnapshotBuffer<int> buffer{};
+	buffer.resize(4);
+	buffer.write(2) = 20;
+	ASSERT_TRUE(buffer.publish(1));
+
+	const auto first = buffer.acquire();
+	buffer.write(2) = 21;
+	ASSERT_EQ(buffer[2], 21);
+	ASSERT_EQ(first[2], 20);
+
+	ASSERT_TRUE(buffer.publish(2));
+	const auto second = buffer.acquire();
+	ASSERT_EQ(first[2], 20);
+	ASSERT_EQ(second[2], 21);
+	ASSERT_EQ(second.get_frame(), 2);
+}
+
+TEST(SnapshotBuffer, copies_only_modified_pages)
+{
+	SnapshotBuffer<int> buffer{};
+	buffer.resize(k_page_size * 8);
+	ASSERT_TRUE(buffer.publish(1));
+	ASSERT_EQ(buffer.get_copied_page_count(), 0);
+
+	buffer.write(0) = 1;
+	buffer.write(1) = 2;
+	buffer.write(k_page_size * 5) = 3;
+	ASSERT_EQ(buffer.get_copied_page_count(), 2);
+
+	ASSERT_TRUE(buffer.publish(2));
+	buffer.write(2) = 4;
+	ASSERT_EQ(buffer.get_copied_page_count(), 3);
+}
+
+TEST(SnapshotBuffer, released_pages_are_written_in_place)
+{
+	SnapshotBuffer<int> buffer{ 2 };
+	buffer.resize(k_page_size);
+	ASSERT_TRUE(buffer.publish(1));
+	buffer.write(0) = 1;
+	ASSERT_TRUE(buffer.publish(2));
+	buffer.write(0) = 2;
+	ASSERT_TRUE(buffer.publish(3));
+	ASSERT_EQ(buffer.get_copied_page_count(), 2);
+
+	// Both slots now hold the same page, once the older one is reused the page is no longer shared with it
+	ASSERT_TRUE(buffer.publish(4));
+	buffer.write(0) = 3;
+	ASSERT_EQ(buffer.get_copied_page_count(), 3);
+	ASSERT_EQ(buffer.acquire()[0], 2);
+}
+
+TEST(SnapshotBuffer, publish_fails_while_readers_hold_every_slot)
+{
+	SnapshotBuffer<int> buffer{ 2 };
+	buffer.resize(1);
+	ASSERT_TRUE(buffer.publish(1));
+	auto first = buffer.acquire();
+	ASSERT_TRUE(buffer.publish(2));
+	const auto second = buffer.acquire();
+
+	ASSERT_FALSE(buffer.publish(3));
+	ASSERT_EQ(buffer.acquire().get_frame(), 2);
+
+	first = {};
+	ASSERT_TRUE(buffer.publish(3));
+	ASSERT_EQ(buffer.acquire().get_frame(), 3);
+	ASSERT_EQ(second.get_frame(), 2);
+}
+
+TEST(SnapshotBuffer, assign_copies_changed_pages)
+{
+	std::vector<int> source(k_page_size * 4, 7);
+	SnapshotBuffer<int> buffer{};
+	buffer.assign(source);
+	ASSERT_TRUE(buffer.publish(1));
+	const auto copied = buffer.get_copied_page_count();
+
+	source[k_page_size * 3 + 1] = 8;
+	buffer.assign(source);
+	ASSERT_EQ(buffer.get_copied_page_count(), copied + 1);
+
+	source.resize(k_page_size + 1);
+	buffer.assign(source);
+	ASSERT_EQ(buffer.size(), k_page_size + 1);
+	ASSERT_EQ(buffer[k_page_size], 7);
+}
+
+TEST(SnapshotBuffer, readers_see_consistent_frames)
+{
+	constexpr std::size_t k_size = k_page_size * 4;
+	constexpr UInt64 k_frames = 2000;
+
+	SnapshotBuffer<UInt64> buffer{};
+	buffer.resize(k_size);
+	ASSERT_TRUE(buffer.publish(0));
+
+	std::atomic<bool> done{};
+	std::atomic<bool> consistent{ true };
+	std::vector<std::thread> readers{};
+	for (auto reader = 0; reader < 3; ++reader)
+	{
+		readers.emplace_back([&]()
+		{
+			while (!done.load())
+			{
+				const auto view = buffer.acquire();
+				const auto frame = view.get_frame();
+				for (std::size_t index = 0; index < view.size(); index += 97)
+				{
+					if (view[index] != frame)
+					{
+						consistent = false;
+					}
+				}
+			}
+		});
+	}
+
+	for (UInt64 frame = 1; frame <= k_frames; ++frame)
+	{
+		for (std::size_t index = 0; index < k_size; ++index)
+		{
+			buffer.write(index) = frame;
+		}
+		while (!buffer.publish(frame))
+		{
+			std::this_thread::yield();
+		}
+	}
+	done = true;
+	for (auto& reader : readers)
+	{
+		reader.join();
+	}
+
+	ASSERT_TRUE(consistent.load());
+}
\ No newline at end of file
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <span>
+
 #include <Sigma/Engine/DataStructures/SparseSet.hpp>
 
 using namespace sigma;
@@ -308,6 +311,29 @@ TEST(SparseSet, erase)
 	ASSERT_EQ(set.get_element_pointer(4), nullptr);
 }
 
+TEST(SparseSet, erase_batch)
+{
+	auto set = SparseSet<int>(8);
+	for (int index = 0; index < 6; ++index)
+	{
+		set.emplace(static_cast<std::size_t>(index), index * 11);
+	}
+	set.add_reference(7, 2);
+
+	// Index 2 survives through its reference, absent indices and repeats are ignored
+	const std::vector<std::size_t> erased{ 4, 1, 2, 6, 4 };
+	set.erase(erased);
+	ASSERT_EQ(set.size(), 4);
+	ASSERT_EQ(std::vector<int>(set.begin(), set.end()), (std::vector<int>{ 0, 22, 33, 55 }));
+	ASSERT_EQ(set.get_indices(), (std::vector<std::size_t>{ 0, 7, 3, 5 }));
+	ASSERT_FALSE(set.has_element(1));
+	ASSERT_FALSE(set.has_element(2));
+	ASSERT_FALSE(set.has_element(4));
+	ASSERT_EQ(set[7], 22);
+	ASSERT_EQ(set[5], 55);
+	ASSERT_EQ(set.get_dense_index(5), 3);
+}
+
 TEST(SparseSet, add_reference)
 {
 	auto set = SparseSet<int>(7);
@@ -355,4 +381,238 @@ TEST(SparseSet, add_reference)
 	
 	set.erase(0);
 	ASSERT_EQ(set.size(), 0);
+}
+
+TEST(SparseSet, data)
+{
+	auto set = SparseSet<int>(2);
+	set.emplace(4, 10);
+	set.emplace(2, 20);
+
+	const auto data = set.data();
+	ASSERT_EQ(data[0], 10);
+	ASSERT_EQ(data[1], 20);
+}
+
+TEST(SparseSet, get_dense_index)
+{
+	auto set = SparseSet<int>(3);
+	set.emplace(4, 10);
+	set.emplace(2, 20);
+	set.emplace(7, 30);
+	ASSERT_EQ(set.get_dense_index(4), 0);
+	ASSERT_EQ(set.get_dense_index(2), 1);
+	ASSERT_EQ(set.get_dense_index(7), 2);
+
+	set.erase(4);
+	ASSERT_EQ(set.get_dense_index(7), 0);
+	ASSERT_EQ(set.get_dense_index(2), 1);
+}
+
+TEST(SparseSet, reorder)
+{
+	auto set = SparseSet<int>(3);
+	set.emplace(0, 10);
+	set.emplace(1, 11);
+	set.emplace(2, 12);
+	set.add_reference(3, 0);
+
+	set.reorder({ 2, 0, 1 });
+	ASSERT_EQ(set.capacity(), 3);
+	ASSERT_EQ(set.data()[0], 12);
+	ASSERT_EQ(set.data()[1], 10);
+	ASSERT_EQ(set.data()[2], 11);
+	ASSERT_EQ(set[0], 10);
+	ASSERT_EQ(set[1], 11);
+	ASSERT_EQ(set[2], 12);
+	ASSERT_EQ(set[3], 10);
+	ASSERT_EQ(set.get_dense_index(2), 0);
+}
+
+TEST(SparseSet, sort)
+{
+	auto set = SparseSet<int>(4);
+	set.emplace(0, 40);
+	set.emplace(1, 10);
+	set.emplace(2, 30);
+	set.emplace(3, 20);
+
+	set.sort(std::less<int>{});
+	ASSERT_TRUE(std::is_sorted(set.cbegin(), set.cend()));
+	ASSERT_EQ(set[0], 40);
+	ASSERT_EQ(set[1], 10);
+	ASSERT_EQ(set[2], 30);
+	ASSERT_EQ(set[3], 20);
+
+	set.erase(1);
+	ASSERT_EQ(set.size(), 3);
+	ASSERT_EQ(set[0], 40);
+	ASSERT_EQ(set[2], 30);
+	ASSERT_EQ(set[3], 20);
+}
+
+TEST(SparseSet, get_indices)
+{
+	auto set = SparseSet<int>(4);
+	set.emplace(5, 50);
+	set.emplace(2, 20);
+	set.emplace(7, 70);
+	ASSERT_EQ(set.get_indices(), (std::vector<std::size_t>{ 5u, 2u, 7u }));
+
+	set.erase(5);
+	ASSERT_EQ(set.get_indices(), (std::vector<std::size_t>{ 7u, 2u }));
+	ASSERT_EQ(set.get_index(set.get_dense_index(2)), 2);
+
+	set.sort(std::less<int>{});
+	ASSERT_EQ(set.get_indices(), (std::vector<std::size_t>{ 2u, 7u }));
+
+	// Erasing the owner of a shared element hands it to a remaining reference
+	set.add_reference(9, 7);
+	set.erase(7);
+	ASSERT_EQ(set.get_index(set.get_dense_index(9)), 9);
+}
+
+TEST(SparseSet, contiguous_iterators)
+{
+	static_assert(std::contiguous_iterator<SparseSet<float>::iterator_type>);
+	static_assert(std::contiguous_iterator<SparseSet<float>::const_iterator_type>);
+	static_assert(std::ranges::contiguous_range<SparseSet<float>>);
+	static_assert(std::ranges::sized_range<const SparseSet<float>>);
+
+	auto set = SparseSet<int>(4);
+	set.emplace(3, 30);
+	set.emplace(1, 10);
+	set.emplace(2, 20);
+
+	ASSERT_EQ(std::to_address(set.begin()), set.data());
+	ASSERT_EQ(set.end() - set.begin(), 3);
+
+	auto iterator = set.begin();
+	ASSERT_EQ(*iterator++, 30);
+	ASSERT_EQ(*iterator, 10);
+
+	std::ranges::transform(set, set.begin(), [](const int value) { return value + 1; });
+	ASSERT_EQ(set[1], 11);
+	ASSERT_EQ(set[2], 21);
+	ASSERT_EQ(set[3], 31);
+
+	const auto& const_set = set;
+	const std::span<const int> elements = const_set.get_elements();
+	ASSERT_EQ(elements.size(), 3);
+	ASSERT_EQ(std::ranges::max(const_set), 31);
+}
+
+namespace
+{
+	struct Selected {};
+}
+
+TEST(SparseSet, tag_emplace_and_erase)
+{
+	auto set = SparseSet<Selected>(4);
+	static_assert(!std::is_same_v<SparseSet<Selected>::iterator_type, SparseSet<int>::iterator_type>);
+
+	set.emplace(7);
+	set.emplace(2);
+	set.emplace(7);
+	set.emplace(40);
+	ASSERT_EQ(set.size(), 3);
+	ASSERT_TRUE(set.has_element(7));
+	ASSERT_FALSE(set.has_element(3));
+	ASSERT_FALSE(set.has_element(100));
+	ASSERT_EQ(set.get_element_pointer(3), nullptr);
+	ASSERT_EQ(set.get_element_pointer(2), &set[40]);
+
+	// Emplacing a member again re-adds it at the back, as for element sets
+	ASSERT_EQ(set.get_dense_index(7), 1);
+
+	set.erase(7);
+	set.erase(3);
+	ASSERT_EQ(set.size(), 2);
+	ASSERT_FALSE(set.has_element(7));
+	ASSERT_EQ(set.get_dense_index(40), 1);
+	ASSERT_EQ(set.get_index(0), 2);
+}
+
+TEST(SparseSet, tag_references_and_bulk_insertion)
+{
+	auto set = SparseSet<Selected>(8);
+	set.emplace(1);
+	set.emplace(4);
+	set.add_reference(6, 4);
+	ASSERT_EQ(set.size(), 2);
+	ASSERT_EQ(set.get_dense_index(6), set.get_dense_index(4));
+	ASSERT_EQ(&set.get_element(6), &set[1]);
+
+	set.erase(4);
+	ASSERT_TRUE(set.has_element(6));
+	ASSERT_EQ(set.get_index(set.get_dense_index(6)), 6);
+
+	set.erase(1);
+	ASSERT_EQ(set.get_dense_index(6), 0);
+
+	const std::vector<std::size_t> indices{ 12, 9 };
+	const auto begin = set.extend(indices.size(), 12);
+	set.link(begin, indices);
+	set.sort([](const Selected&, const Selected&) { return false; });
+	ASSERT_EQ(std::vector<std::size_t>(set.begin(), set.end()), (std::vector<std::size_t>{ 6u, 12u, 9u }));
+	ASSERT_EQ(set.get_dense_index(9), 2);
+}
+
+TEST(SparseSet, tag_erase_batch)
+{
+	auto set = SparseSet<Selected>(8);
+	for (std::size_t index = 0; index < 6; ++index)
+	{
+		set.emplace(index);
+	}
+
+	const std::vector<std::size_t> erased{ 4, 1, 2, 6, 4 };
+	set.erase(erased);
+	ASSERT_EQ(std::vector<std::size_t>(set.begin(), set.end()), (std::vector<std::size_t>{ 0, 3, 5 }));
+	ASSERT_EQ(set.get_dense_index(5), 2);
+	ASSERT_FALSE(set.has_element(4));
+	ASSERT_TRUE(set.has_element(3));
+}
+
+TEST(SparseSet, tag_iteration)
+{
+	auto set = SparseSet<Selected>(4);
+	set.emplace(5);
+	set.emplace(1);
+	set.emplace(3);
+
+	ASSERT_EQ(std::vector<std::size_t>(set.begin(), set.end()), (std::vector<std::size_t>{ 5u, 1u, 3u }));
+
+	set.reorder({ 1, 2, 0 });
+	ASSERT_EQ(std::vector<std::size_t>(set.cbegin(), set.cend()), (std::vector<std::size_t>{ 1u, 3u, 5u }));
+	ASSERT_EQ(set.get_dense_index(5), 2);
+
+	set.clear();
+	ASSERT_TRUE(set.is_empty());
+	ASSERT_FALSE(set.has_element(1));
+}
+
+TEST(SparseSet, extend_and_link)
+{
+	SparseSet<int> set{ 8 };
+	set.emplace(3, 30);
+
+	const auto begin = set.extend(2, 9);
+	ASSERT_EQ(begin, 1);
+	ASSERT_EQ(set.size(), 3);
+	set.data()[begin] = 90;
+	set.data()[begin + 1] = 50;
+	const std::size_t indices[] = { 9, 5 };
+	set.link(begin, indices);
+
+	ASSERT_EQ(set[9], 90);
+	ASSERT_EQ(set[5], 50);
+	ASSERT_EQ(set.get_index(2), 5);
+	ASSERT_EQ(set.get_dense_index(9), 1);
+
+	set.erase(3);
+	ASSERT_EQ(set.size(), 2);
+	ASSERT_EQ(set[9], 90);
+	ASSERT_EQ(set[5], 50);
 }
\ No newline at end of file
@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include <Sigma/Engine/DataStructures/StableSparseSet.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	std::vector<std::size_t> get_indices(const StableSparseSet<int>& set)
+	{
+		std::vector<std::size_t> indices{};
+		set.for_each([&](const std::size_t index, const int&) { indices.push_back(index); });
+		return indices;
+	}
+}
+
+TEST(StableSparseSet, emplace_and_get)
+{
+	StableSparseSet<int> set{};
+	set.emplace(4, 40);
+	set.emplace(1, 10);
+	ASSERT_EQ(set.size(), 2);
+	ASSERT_TRUE(set.has_element(4));
+	ASSERT_FALSE(set.has_element(2));
+	ASSERT_EQ(set[1], 10);
+	ASSERT_EQ(set.get_element_pointer(2), nullptr);
+
+	set.emplace(4, 44);
+	ASSERT_EQ(set.size(), 2);
+	ASSERT_EQ(set[4], 44);
+}
+
+TEST(StableSparseSet, pointers_stay_valid)
+{
+	StableSparseSet<int> set{};
+	for (std::size_t index = 0; index < 1000; ++index)
+	{
+		set.emplace(index, static_cast<int>(index));
+	}
+
+	auto* const kept = set.get_element_pointer(999);
+	for (std::size_t index = 0; index < 999; index += 2)
+	{
+		set.erase(index);
+	}
+	for (std::size_t index = 1000; index < 3000; ++index)
+	{
+		set.emplace(index, static_cast<int>(index));
+	}
+	ASSERT_EQ(kept, set.get_element_pointer(999));
+	ASSERT_EQ(*kept, 999);
+}
+
+TEST(StableSparseSet, erase_reuses_tombstones)
+{
+	StableSparseSet<int> set{};
+	set.emplace(0, 0);
+	set.emplace(1, 1);
+	set.emplace(2, 2);
+
+	set.erase(1);
+	ASSERT_EQ(set.size(), 2);
+	ASSERT_EQ(set.get_slot_count(), 3);
+	ASSERT_FLOAT_EQ(set.get_fragmentation(), 1.0f / 3.0f);
+	ASSERT_EQ(get_indices(set), (std::vector<std::size_t>{ 0u, 2u }));
+
+	set.emplace(7, 7);
+	ASSERT_EQ(set.get_slot_count(), 3);
+	ASSERT_EQ(get_indices(set), (std::vector<std::size_t>{ 0u, 7u, 2u }));
+}
+
+TEST(StableSparseSet, erase_while_iterating)
+{
+	StableSparseSet<int> set{};
+	for (std::size_t index = 0; index < 300; ++index)
+	{
+		set.emplace(index, static_cast<int>(index));
+	}
+
+	// Every visited element erases itself and its successor, so only even indices are visited
+	std::vector<std::size_t> visited{};
+	set.for_each([&](const std::size_t index, int&)
+	{
+		visited.push_back(index);
+		set.erase(index);
+		set.erase(index + 1);
+	});
+	ASSERT_EQ(visited.size(), 150);
+	ASSERT_EQ(visited[1], 2);
+	ASSERT_TRUE(set.is_empty());
+}
+
+TEST(StableSparseSet, compact)
+{
+	StableSparseSet<int> set{};
+	for (std::size_t index = 0; index < 600; ++index)
+	{
+		set.emplace(index, static_cast<int>(index) * 2);
+	}
+	for (std::size_t index = 0; index < 600; ++index)
+	{
+		if (index % 3 != 0)
+		{
+			set.erase(index);
+		}
+	}
+	ASSERT_TRUE(set.needs_compaction());
+
+	set.compact();
+	ASSERT_EQ(set.size(), 200);
+	ASSERT_EQ(set.get_slot_count(), 200);
+	ASSERT_FLOAT_EQ(set.get_fragmentation(), 0.0f);
+	ASSERT_FALSE(set.needs_compaction());
+	for (std::size_t index = 0; index < 600; index += 3)
+	{
+		ASSERT_EQ(set[index], static_cast<int>(index) * 2);
+	}
+
+	set.emplace(1, 1);
+	ASSERT_EQ(set.get_slot_count(), 201);
+}
+
+TEST(StableSparseSet, destroys_elements)
+{
+	auto counter = std::make_shared<int>(0);
+	{
+		StableSparseSet<std::shared_ptr<int>> set{};
+		set.emplace(0, counter);
+		set.emplace(1, counter);
+		set.emplace(2, counter);
+		ASSERT_EQ(counter.use_count(), 4);
+
+		set.erase(1);
+		ASSERT_EQ(counter.use_count(), 3);
+		set.compact();
+		ASSERT_EQ(counter.use_count(), 3);
+	}
+	ASSERT_EQ(counter.use_count(), 1);
+}
+TEST(StableSparseSet, move)
+{
+	StableSparseSet<int> set{};
+	for (std::size_t index = 0; index < 300; ++index)
+	{
+		set.emplace(index, static_cast<int>(index));
+	}
+	set.erase(7);
+	const auto* const element = set.get_element_pointer(8);
+
+	auto moved = std::move(set);
+	ASSERT_EQ(moved.size(), 299);
+	ASSERT_EQ(moved.get_element_pointer(8), element);
+	ASSERT_FALSE(moved.has_element(7));
+
+	// The source is left empty, its stale tombstone is not reused
+	ASSERT_EQ(set.size(), 0);
+	ASSERT_EQ(set.get_slot_count(), 0);
+	ASSERT_FALSE(set.has_element(8));
+	set.emplace(3, 30);
+	ASSERT_EQ(set.size(), 1);
+	ASSERT_EQ(set[3], 30);
+	ASSERT_EQ(get_indices(set), std::vector<std::size_t>{ 3 });
+}
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include <Sigma/Engine/Ecs/ComponentTypes.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	struct Position { Float x{}; };
+	struct Velocity { Float x{}; };
+	struct Health { Int32 value{}; };
+
+	using Types = ComponentTypes<Position, Velocity, Health>;
+}
+
+TEST(ComponentTypes, dense_ids)
+{
+	static_assert(Types::k_count == 3);
+	static_assert(Types::id<Position> == 0);
+	static_assert(Types::id<Health> == 2);
+	static_assert(Types::id_tag<Velocity>::value == 1);
+	static_assert(Types::contains<Velocity>);
+	static_assert(!Types::contains<int>);
+}
+
+TEST(ComponentTypes, find_by_hash)
+{
+	static_assert(Types::find(type_hash<Velocity>()) == Types::id<Velocity>);
+	static_assert(Types::find(type_hash<int>()) == k_invalid_component_id);
+}
+
+TEST(ComponentTypes, visit)
+{
+	std::string name{};
+	Types::visit(Types::id<Health>, [&]<typename Component>(std::type_identity<Component>) { name = type_name<Component>(); });
+	ASSERT_NE(name.find("Health"), std::string::npos);
+
+	const auto size = Types::visit(1, []<typename Component>(std::type_identity<Component>) { return sizeof(Component); });
+	ASSERT_EQ(size, sizeof(Velocity));
+}
+
+TEST(ComponentTypes, masks)
+{
+	constexpr auto mask = Types::make_mask<Position, Health>();
+	static_assert(mask.test(0) && !mask.test(1) && mask.test(2));
+	static_assert(mask.contains(Types::make_mask<Health>()));
+	static_assert(!mask.contains(Types::make_mask<Velocity>()));
+	static_assert(mask.intersects(Types::make_mask<Position, Velocity>()));
+	static_assert(!Types::make_mask<>().intersects(mask));
+
+	ComponentMask<200> wide{};
+	wide.set(199);
+	wide.set(3);
+	ASSERT_TRUE(wide.test(199));
+	wide.reset(199);
+	ASSERT_FALSE(wide.test(199));
+	ASSERT_FALSE(wide.is_empty());
+}
+
+TEST(ComponentTypes, access_conflicts)
+{
+	constexpr auto physics = make_component_access<Types, TypeList<Velocity>, TypeList<Position>>();
+	constexpr auto render = make_component_access<Types, TypeList<Position>, TypeList<>>();
+	constexpr auto damage = make_component_access<Types, TypeList<Position>, TypeList<Health>>();
+
+	static_assert(physics.conflicts_with(render));
+	static_assert(render.conflicts_with(physics));
+	static_assert(!render.conflicts_with(damage));
+	static_assert(!physics.conflicts_with(make_component_access<Types, TypeList<Velocity>, TypeList<Health>>()));
+}
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include <Sigma/Engine/Ecs/World.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	struct Position { Float x{}; };
+	struct Name { std::string value{}; };
+	struct Follow
+	{
+		static constexpr auto get_entity_references() noexcept
+		{
+			return std::array{ &Follow::target };
+		}
+
+		Entity target{ k_null_entity };
+	};
+	struct Selected {};
+
+	using TestWorld = World<Position, Name, Follow, Selected>;
+	using TestPrefab = Prefab<Position, Name, Follow, Selected>;
+
+	// A leader and a follower pointing at it
+	TestPrefab make_squad()
+	{
+		TestPrefab prefab{};
+		const auto leader = prefab.create();
+		const auto follower = prefab.create();
+		prefab.emplace<Position>(leader, 1.0f);
+		prefab.emplace<Name>(leader, "leader");
+		prefab.emplace<Selected>(leader);
+		prefab.emplace<Position>(follower, 2.0f);
+		prefab.emplace<Follow>(follower, leader);
+		return prefab;
+	}
+}
+
+TEST(Prefab, remap_entity_references)
+{
+	const std::vector<Entity> entities{ 10, 11 };
+	Follow inside{ make_prefab_entity(1) };
+	Follow outside{ 1 };
+	Follow none{};
+	remap_entity_references(inside, entities);
+	remap_entity_references(outside, entities);
+	remap_entity_references(none, entities);
+	ASSERT_EQ(inside.target, 11);
+	ASSERT_EQ(outside.target, 1);
+	ASSERT_EQ(none.target, k_null_entity);
+	ASSERT_FALSE(is_prefab_entity(k_null_entity));
+}
+
+TEST(Prefab, instantiate_copies)
+{
+	constexpr std::size_t k_count = 3000;
+
+	for (const auto use_signatures : { false, true })
+	{
+		JobSystem jobs{ 2 };
+		TestWorld world{ 2 * k_count + 1, use_signatures };
+		const auto existing = world.create();
+		world.emplace<Position>(existing, 9.0f);
+
+		std::vector<Entity> entities{};
+		world.instantiate(make_squad(), k_count, entities, jobs);
+		ASSERT_EQ(entities.size(), 2 * k_count);
+		ASSERT_EQ(world.size(), 2 * k_count + 1);
+		ASSERT_EQ(world.get_pool<Position>().size(), 2 * k_count + 1);
+		ASSERT_EQ(world.get_pool<Name>().size(), k_count);
+		ASSERT_EQ(world.get_pool<Selected>().size(), k_count);
+
+		for (std::size_t copy = 0; copy < k_count; ++copy)
+		{
+			const auto leader = entities[copy * 2];
+			const auto follower = entities[copy * 2 + 1];
+			ASSERT_FLOAT_EQ(world.get<Position>(leader).x, 1.0f);
+			ASSERT_FLOAT_EQ(world.get<Position>(follower).x, 2.0f);
+			ASSERT_EQ(world.get<Name>(leader).value, "leader");
+			ASSERT_TRUE(world.has<Selected>(leader));
+			ASSERT_FALSE(world.has<Follow>(leader));
+			ASSERT_EQ(world.get<Follow>(follower).target, leader);
+			if (use_signatures)
+			{
+				ASSERT_EQ(world.get_signature(follower)[0], (UInt64{ 1 } << TestWorld::component_types::id<Position>) | (UInt64{ 1 } << TestWorld::component_types::id<Follow>));
+			}
+		}
+		ASSERT_FLOAT_EQ(world.get<Position>(existing).x, 9.0f);
+
+		// Instantiated entities are ordinary entities
+		world.destroy(entities[1]);
+		ASSERT_FALSE(world.has<Follow>(entities[1]));
+		ASSERT_EQ(world.get_pool<Follow>().size(), k_count - 1);
+	}
+}
+TEST(Prefab, instantiate_keeps_world_references)
+{
+	JobSystem jobs{ 2 };
+	TestWorld world{ 8 };
+	const auto target = world.create();
+	ASSERT_EQ(target, 0);
+
+	// Follows world entity 0, which has the same number as the prefab's first entity
+	TestPrefab prefab{};
+	const auto follower = prefab.create();
+	const auto leader = prefab.create();
+	prefab.emplace<Follow>(follower, target);
+	prefab.emplace<Follow>(leader, follower);
+
+	std::vector<Entity> entities{};
+	world.instantiate(prefab, 2, entities, jobs);
+	for (std::size_t copy = 0; copy < 2; ++copy)
+	{
+		ASSERT_EQ(world.get<Follow>(entities[copy * 2]).target, target);
+		ASSERT_EQ(world.get<Follow>(entities[copy * 2 + 1]).target, entities[copy * 2]);
+	}
+}
@@ -0,0 +1,196 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <Sigma/Engine/Ecs/Query.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	struct Position { Float x{}; };
+	struct Velocity { Float x{}; };
+	struct Frozen {};
+	struct Health { Int32 value{}; };
+
+	using TestWorld = World<Position, Velocity, Frozen, Health>;
+
+	struct Entities
+	{
+		Entity moving{};
+		Entity frozen{};
+		Entity still{};
+		Entity hurt{};
+	};
+
+	template <typename WorldType>
+	concept CanChangePools = requires(WorldType& world)
+	{
+		world.template get_pool<Velocity>().erase(0);
+		world.template get_pool<Frozen>().emplace(0);
+	};
+
+	Entities populate(TestWorld& world)
+	{
+		Entities entities{ world.create(), world.create(), world.create(), world.create() };
+		for (const auto entity : { entities.moving, entities.frozen, entities.still, entities.hurt })
+		{
+			world.emplace<Position>(entity, 0.0f);
+		}
+		world.emplace<Velocity>(entities.moving, 1.0f);
+		world.emplace<Velocity>(entities.frozen, 2.0f);
+		world.emplace<Velocity>(entities.hurt, 3.0f);
+		world.emplace<Frozen>(entities.frozen);
+		world.emplace<Health>(entities.hurt, 5);
+		return entities;
+	}
+}
+
+TEST(Query, include_exclude_optional)
+{
+	TestWorld world{ 8 };
+	const auto entities = populate(world);
+
+	Query<Include<Position, const Velocity>, Exclude<Frozen>, Optional<Health>> query{ world };
+	std::vector<Entity> visited{};
+	query.each([&](const Entity entity, Position& position, const Velocity& velocity, Health* health)
+	{
+		visited.push_back(entity);
+		position.x += velocity.x;
+		ASSERT_EQ(health != nullptr, entity == entities.hurt);
+	});
+
+	std::sort(visited.begin(), visited.end());
+	ASSERT_EQ(visited, (std::vector<Entity>{ entities.moving, entities.hurt }));
+	ASSERT_FLOAT_EQ(world.get<Position>(entities.moving).x, 1.0f);
+	ASSERT_FLOAT_EQ(world.get<Position>(entities.frozen).x, 0.0f);
+	ASSERT_FLOAT_EQ(world.get<Position>(entities.hurt).x, 3.0f);
+}
+
+TEST(Query, driven_by_smallest_pool)
+{
+	TestWorld world{ 8 };
+	const auto entities = populate(world);
+
+	// Health is the smallest pool, regardless of the order of the filter
+	Query<Include<Position>, Include<Health>> query{ world };
+	ASSERT_EQ(query.size_hint(), 1);
+
+	std::vector<Entity> visited{};
+	query.each([&](const Entity entity, Position&, Health&) { visited.push_back(entity); });
+	ASSERT_EQ(visited, (std::vector<Entity>{ entities.hurt }));
+}
+
+TEST(Query, contains)
+{
+	TestWorld world{ 8 };
+	const auto entities = populate(world);
+
+	Query<Include<Velocity>, Exclude<Frozen, Health>> query{ world };
+	ASSERT_TRUE(query.contains(entities.moving));
+	ASSERT_FALSE(query.contains(entities.frozen));
+	ASSERT_FALSE(query.contains(entities.still));
+	ASSERT_FALSE(query.contains(entities.hurt));
+}
+
+TEST(Query, get_access)
+{
+	using Types = TestWorld::component_types;
+	constexpr auto access = Query<Include<Position, const Velocity>, Exclude<Frozen>, Optional<const Health>>::get_access<Types>();
+	static_assert(access.writes == Types::make_mask<Position>());
+	static_assert(access.reads == Types::make_mask<Velocity, Frozen, Health>());
+}
+
+TEST(Query, signature_scan)
+{
+	TestWorld world{ 64, true };
+	std::vector<Entity> expected{};
+	for (std::size_t index = 0; index < 64; ++index)
+	{
+		const auto entity = world.create();
+		world.emplace<Position>(entity, static_cast<Float>(index));
+		world.emplace<Velocity>(entity, 1.0f);
+		if (index % 3 == 0)
+		{
+			world.emplace<Frozen>(entity);
+		}
+		else if (index % 2 == 0)
+		{
+			world.emplace<Health>(entity, 1);
+		}
+		if (index % 3 != 0)
+		{
+			expected.push_back(entity);
+		}
+	}
+
+	// Every entity has both included components, so probing costs more than the scan
+	std::vector<Entity> visited{};
+	Query<Include<const Position, Velocity>, Exclude<Frozen>, Optional<Health>> query{ world };
+	query.each([&](const Entity entity, const Position& position, Velocity&, Health* health)
+	{
+		visited.push_back(entity);
+		ASSERT_FLOAT_EQ(position.x, static_cast<Float>(entity));
+		ASSERT_EQ(health != nullptr, entity % 2 == 0);
+	});
+	ASSERT_EQ(visited, expected);
+}
+
+TEST(Query, signature_scan_matches_pool_probes)
+{
+	// Pools are read-only outside the world, so no membership change can bypass the signatures
+	static_assert(!CanChangePools<TestWorld>);
+
+	std::vector<std::vector<Entity>> results{};
+	for (const auto use_signatures : { false, true })
+	{
+		TestWorld world{ 128, use_signatures };
+		JobSystem jobs{ 1 };
+		for (std::size_t index = 0; index < 64; ++index)
+		{
+			const auto entity = world.create();
+			world.emplace<Position>(entity, 0.0f);
+			world.emplace<Velocity>(entity, 1.0f);
+		}
+		world.erase<Velocity>(3);
+		world.emplace<Frozen>(5);
+		world.destroy(7);
+
+		// Prefab copies get their components in bulk rather than one emplace at a time
+		Prefab<Position, Velocity, Frozen, Health> prefab{};
+		const auto moving = prefab.create();
+		const auto frozen = prefab.create();
+		prefab.emplace<Position>(moving);
+		prefab.emplace<Velocity>(moving);
+		prefab.emplace<Position>(frozen);
+		prefab.emplace<Velocity>(frozen);
+		prefab.emplace<Frozen>(frozen);
+		std::vector<Entity> copies{};
+		world.instantiate(prefab, 4, copies, jobs);
+
+		Query<Include<Position, Velocity>, Exclude<Frozen>> query{ world };
+		std::vector<Entity> visited{};
+		query.each([&](const Entity entity, Position&, Velocity&)
+		{
+			visited.push_back(entity);
+			ASSERT_TRUE(query.contains(entity));
+		});
+		std::sort(visited.begin(), visited.end());
+		ASSERT_EQ(visited.size(), 64 - 3 + 4);
+		results.push_back(visited);
+	}
+	ASSERT_EQ(results[0], results[1]);
+}
+
+TEST(Query, tag_components)
+{
+	TestWorld world{ 8 };
+	const auto entities = populate(world);
+
+	// The tag pool is the smallest and drives the iteration
+	std::vector<Entity> visited{};
+	Query<Include<Position, Frozen>> query{ world };
+	query.each([&](const Entity entity, Position&, Frozen&) { visited.push_back(entity); });
+	ASSERT_EQ(visited, (std::vector<Entity>{ entities.frozen }));
+	ASSERT_EQ(&world.get<Frozen>(entities.frozen), world.get_pool<Frozen>().get_element_pointer(entities.frozen));
+}
\ No newline at end of file
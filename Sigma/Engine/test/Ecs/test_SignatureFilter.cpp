@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include <Sigma/Engine/Ecs/SignatureFilter.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	std::vector<Entity> filter_reference(const std::vector<UInt64>& signatures, const std::size_t word_count, const UInt64* include, const UInt64* exclude, const Entity begin, const Entity end)
+	{
+		std::vector<Entity> matches{};
+		for (auto entity = begin; entity < end; ++entity)
+		{
+			auto matched = true;
+			for (std::size_t word = 0; word < word_count; ++word)
+			{
+				const auto signature = signatures[entity * word_count + word];
+				matched = matched && (signature & include[word]) == include[word] && (signature & exclude[word]) == 0;
+			}
+			if (matched)
+			{
+				matches.push_back(entity);
+			}
+		}
+		return matches;
+	}
+}
+
+TEST(SignatureFilter, get_signature_word_count)
+{
+	static_assert(get_signature_word_count(1) == 1);
+	static_assert(get_signature_word_count(64) == 1);
+	static_assert(get_signature_word_count(65) == 2);
+	static_assert(get_signature_word_count(129) == 4);
+	static_assert(get_signature_word_count(256) == 4);
+}
+
+TEST(SignatureFilter, filter_signatures)
+{
+	std::mt19937_64 generator{ 5 };
+	for (const auto word_count : { 1u, 2u, 4u })
+	{
+		constexpr Entity k_entity_count = 1001;
+		std::vector<UInt64> signatures(k_entity_count * word_count);
+		for (auto& signature : signatures)
+		{
+			// Dense enough that a few bits of include match a fair share of the entities
+			signature = generator() | generator();
+		}
+
+		const UInt64 include[4] = { 0x0101, 0x8000'0000'0000'0000u, 0x3, 0x10 };
+		const UInt64 exclude[4] = { 0x4000, 0, 0x100, 0 };
+
+		// Odd ranges exercise the tail after the vector loop
+		for (const auto begin : { Entity{ 0 }, Entity{ 3 } })
+		{
+			std::vector<Entity> output(k_entity_count);
+			const auto count = filter_signatures(signatures.data(), word_count, include, exclude, begin, k_entity_count, output.data());
+			output.resize(count);
+			ASSERT_EQ(output, filter_reference(signatures, word_count, include, exclude, begin, k_entity_count));
+			ASSERT_GT(count, 0);
+		}
+	}
+}
+TEST(SignatureFilter, filter_signatures_block_lanes)
+{
+	// Built with ENABLE_AVX2 these ranges run through the vector blocks, one match in every lane of every register,
+	// with ranges that start and end inside a block
+	constexpr Entity k_entity_count = 64;
+	const UInt64 include[4] = { 0x1, 0x1, 0x1, 0x1 };
+	const UInt64 exclude[4] = { 0x2, 0x2, 0x2, 0x2 };
+	for (const auto word_count : { 1u, 2u, 4u })
+	{
+		for (Entity matching = 0; matching < k_entity_count; ++matching)
+		{
+			// Every other entity only misses a bit of the last word, or has an excluded bit in it
+			std::vector<UInt64> signatures(k_entity_count * word_count, 0x1);
+			for (Entity entity = 0; entity < k_entity_count; ++entity)
+			{
+				signatures[entity * word_count + word_count - 1] = entity == matching ? 0x1 : (entity % 2 == 0 ? 0x0 : 0x3);
+			}
+
+			for (const auto begin : { Entity{ 0 }, Entity{ 5 } })
+			{
+				for (const auto end : { k_entity_count, k_entity_count - 7 })
+				{
+					std::vector<Entity> output(k_entity_count);
+					const auto count = filter_signatures(signatures.data(), word_count, include, exclude, begin, end, output.data());
+					output.resize(count);
+					ASSERT_EQ(output, filter_reference(signatures, word_count, include, exclude, begin, end));
+				}
+			}
+		}
+
+		std::vector<UInt64> signatures(k_entity_count * word_count, 0x1);
+		std::vector<Entity> output(k_entity_count);
+		ASSERT_EQ(filter_signatures(signatures.data(), word_count, include, exclude, 0, k_entity_count, output.data()), k_entity_count);
+	}
+}
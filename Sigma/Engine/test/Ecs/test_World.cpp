@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <Sigma/Engine/Ecs/World.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	struct Position { Float x{}; };
+	struct Velocity { Float x{}; };
+	struct Health { Int32 value{}; };
+
+	using TestWorld = World<Position, Velocity, Health>;
+}
+
+TEST(World, create_and_destroy)
+{
+	TestWorld world{ 8 };
+	const auto first = world.create();
+	const auto second = world.create();
+	ASSERT_NE(first, second);
+	ASSERT_EQ(world.size(), 2);
+	ASSERT_TRUE(world.is_alive(first));
+
+	world.emplace<Position>(first, 1.0f);
+	world.emplace<Health>(first, 10);
+	world.destroy(first);
+	ASSERT_FALSE(world.is_alive(first));
+	ASSERT_FALSE(world.has<Position>(first));
+	ASSERT_FALSE(world.has<Health>(first));
+	ASSERT_EQ(world.size(), 1);
+
+	// Destroyed ids are reused
+	ASSERT_EQ(world.create(), first);
+}
+
+TEST(World, components)
+{
+	TestWorld world{ 8 };
+	const auto entity = world.create();
+	world.emplace<Velocity>(entity, 2.0f).x += 1.0f;
+	ASSERT_TRUE(world.has<Velocity>(entity));
+	ASSERT_FALSE(world.has<Position>(entity));
+	ASSERT_FLOAT_EQ(world.get<Velocity>(entity).x, 3.0f);
+	ASSERT_EQ(world.get_pool<Velocity>().size(), 1);
+	ASSERT_EQ(world.try_get<Velocity>(entity), &world.get<Velocity>(entity));
+	ASSERT_EQ(world.try_get<Position>(entity), nullptr);
+
+	world.erase<Velocity>(entity);
+	ASSERT_FALSE(world.has<Velocity>(entity));
+}
+
+TEST(World, for_each_component)
+{
+	TestWorld world{ 8 };
+	const auto entity = world.create();
+	world.emplace<Health>(entity, 5);
+	world.emplace<Position>(entity, 1.0f);
+
+	std::vector<ComponentId> ids{};
+	world.for_each_component(entity, [&](const ComponentId id, auto&) { ids.push_back(id); });
+	ASSERT_EQ(ids, (std::vector<ComponentId>{ TestWorld::component_types::id<Position>, TestWorld::component_types::id<Health> }));
+}
+
+TEST(World, visit_pool)
+{
+	TestWorld world{ 8 };
+	const auto entity = world.create();
+	world.emplace<Health>(entity, 5);
+
+	const auto id = TestWorld::component_types::find(type_hash<Health>());
+	const auto size = world.visit_pool(id, [](auto& pool) { return pool.size(); });
+	ASSERT_EQ(size, 1);
+}
+
+TEST(World, signatures)
+{
+	TestWorld world{ 8, true };
+	ASSERT_TRUE(world.has_signatures());
+	static_assert(TestWorld::k_signature_words == 1);
+
+	const auto entity = world.create();
+	world.emplace<Position>(entity);
+	world.emplace<Health>(entity, 1);
+	constexpr auto both = TestWorld::component_types::make_mask<Position, Health>();
+	ASSERT_EQ(world.get_signature(entity)[0], both.get_words()[0]);
+
+	world.erase<Position>(entity);
+	ASSERT_EQ(world.get_signature(entity)[0], TestWorld::component_types::make_mask<Health>().get_words()[0]);
+
+	world.destroy(entity);
+	const auto reused = world.create();
+	ASSERT_EQ(reused, entity);
+	ASSERT_EQ(world.get_signature(reused)[0], 0);
+	ASSERT_EQ(world.get_signatures().size(), 1);
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include <Sigma/Engine/Events/EventBus.hpp>
+
+#include <vector>
+
+using namespace sigma;
+
+namespace
+{
+	struct Collision
+	{
+		Entity first{};
+		Entity second{};
+	};
+
+	struct Spawn
+	{
+		Entity entity{};
+	};
+
+	using Bus = EventBus<Collision, Spawn>;
+
+	struct Listener
+	{
+		void on_collisions(const std::span<const Collision> events)
+		{
+			for (const auto& event : events)
+			{
+				collisions.push_back(event.first + event.second);
+			}
+		}
+
+		std::vector<Entity> collisions{};
+	};
+
+	// Spawns a follow-up for every spawn it sees, which waits for the next dispatch
+	struct Spawner
+	{
+		Bus* bus{};
+		std::vector<Entity> spawned{};
+	};
+
+	// Hands its subscription over to the next listener on the first page it sees
+	struct Relay
+	{
+		void on_collisions(const std::span<const Collision> events)
+		{
+			pages.push_back(events.size());
+			bus->unsubscribe<Collision, &Relay::on_collisions>(*this);
+			bus->subscribe<Collision, &Listener::on_collisions>(*next);
+		}
+
+		Bus* bus{};
+		Listener* next{};
+		std::vector<std::size_t> pages{};
+	};
+
+	void on_spawns(Spawner& spawner, const std::span<const Spawn> events)
+	{
+		for (const auto& event : events)
+		{
+			spawner.spawned.push_back(event.entity);
+			if (event.entity < 10)
+			{
+				std::ignore = spawner.bus->publish(Spawn{ event.entity + 10 });
+			}
+		}
+	}
+}
+
+TEST(EventBus, ids_follow_the_type_list)
+{
+	static_assert(Bus::id<Collision> == 0);
+	static_assert(Bus::id<Spawn> == 1);
+	static_assert(!Bus::contains<int>);
+}
+
+TEST(EventBus, dispatches_selected_types)
+{
+	Bus bus{ 1024 };
+	Listener first{};
+	Listener second{};
+	Spawner spawner{ &bus };
+	bus.subscribe<Collision, &Listener::on_collisions>(first);
+	bus.subscribe<Collision, &Listener::on_collisions>(second);
+	bus.subscribe<Spawn, &on_spawns>(spawner);
+
+	ASSERT_TRUE(bus.publish(Collision{ 1, 2 }));
+	ASSERT_TRUE(bus.publish(Collision{ 3, 4 }));
+	ASSERT_TRUE(bus.publish(Spawn{ 5 }));
+
+	ASSERT_EQ(bus.dispatch<Collision>(), 2);
+	ASSERT_EQ(first.collisions, (std::vector<Entity>{ 3, 7 }));
+	ASSERT_EQ(second.collisions, first.collisions);
+	ASSERT_TRUE(spawner.spawned.empty());
+
+	ASSERT_EQ(bus.dispatch(), 1);
+	ASSERT_EQ(spawner.spawned, std::vector<Entity>{ 5 });
+	ASSERT_EQ(bus.dispatch<Spawn>(), 1);
+	ASSERT_EQ(spawner.spawned, (std::vector<Entity>{ 5, 15 }));
+
+	bus.unsubscribe<Collision, &Listener::on_collisions>(first);
+	ASSERT_TRUE(bus.publish(Collision{ 5, 6 }));
+	ASSERT_EQ((bus.dispatch<Collision, Spawn>()), 1);
+	ASSERT_EQ(first.collisions.size(), 2);
+	ASSERT_EQ(second.collisions.back(), 11);
+}
+
+TEST(EventBus, counts_dropped_events)
+{
+	Bus bus{ 2 };
+	for (Entity entity = 0; entity < 3; ++entity)
+	{
+		std::ignore = bus.publish(Spawn{ entity });
+	}
+	ASSERT_EQ(bus.get_dropped_count<Spawn>(), 1);
+	ASSERT_EQ(bus.get_dropped_count<Collision>(), 0);
+}
+TEST(EventBus, handlers_change_subscriptions)
+{
+	constexpr auto k_page_size = EventQueue<Collision>::k_page_size;
+	Bus bus{ 4 * k_page_size };
+	Listener listener{};
+	Relay relay{ &bus, &listener };
+	bus.subscribe<Collision, &Relay::on_collisions>(relay);
+	for (std::size_t index = 0; index < 2 * k_page_size; ++index)
+	{
+		ASSERT_TRUE(bus.publish(Collision{ 1, 1 }));
+	}
+
+	// The relay leaves after its first page and the listener only joins for the next dispatch
+	ASSERT_EQ(bus.dispatch<Collision>(), 2 * k_page_size);
+	ASSERT_EQ(relay.pages, std::vector<std::size_t>{ k_page_size });
+	ASSERT_TRUE(listener.collisions.empty());
+
+	ASSERT_TRUE(bus.publish(Collision{ 2, 3 }));
+	ASSERT_EQ(bus.dispatch<Collision>(), 1);
+	ASSERT_EQ(relay.pages.size(), 1);
+	ASSERT_EQ(listener.collisions, std::vector<Entity>{ 5 });
+}
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <Sigma/Engine/Events/EventQueue.hpp>
+
+#include <numeric>
+#include <vector>
+
+using namespace sigma;
+
+TEST(EventQueue, drains_in_claim_order_across_pages)
+{
+	EventQueue<UInt64> queue{ 100000 };
+	const auto count = EventQueue<UInt64>::k_page_size * 2 + 10;
+	for (UInt64 value = 0; value < count; ++value)
+	{
+		ASSERT_TRUE(queue.push(value));
+	}
+
+	std::vector<UInt64> drained{};
+	std::size_t batch_count = 0;
+	ASSERT_EQ(queue.drain([&](const std::span<const UInt64> events)
+	{
+		drained.insert(drained.end(), events.begin(), events.end());
+		++batch_count;
+	}), count);
+	ASSERT_EQ(batch_count, 3);
+
+	std::vector<UInt64> expected(count);
+	std::iota(expected.begin(), expected.end(), UInt64{ 0 });
+	ASSERT_EQ(drained, expected);
+	ASSERT_EQ(queue.drain([](std::span<const UInt64>) { FAIL(); }), 0);
+}
+
+TEST(EventQueue, drops_past_capacity)
+{
+	EventQueue<int> queue{ 3 };
+	for (auto value = 0; value < 5; ++value)
+	{
+		std::ignore = queue.push(value);
+	}
+	ASSERT_EQ(queue.get_dropped_count(), 2);
+	ASSERT_EQ(queue.drain([](std::span<const int>) {}), 3);
+
+	// Every batch starts empty again
+	ASSERT_TRUE(queue.push(7));
+	std::vector<int> drained{};
+	queue.drain([&](const std::span<const int> events) { drained.assign(events.begin(), events.end()); });
+	ASSERT_EQ(drained, std::vector<int>{ 7 });
+}
+
+TEST(EventQueue, concurrent_producers)
+{
+	constexpr auto k_thread_count = 4u;
+	constexpr auto k_per_thread = 50000u;
+
+	EventQueue<UInt32> queue{ k_thread_count * k_per_thread };
+	std::vector<UInt32> seen(k_thread_count * k_per_thread, 0);
+	std::atomic<UInt32> finished{};
+	std::size_t drained = 0;
+	{
+		std::vector<std::jthread> threads{};
+		for (auto thread = 0u; thread < k_thread_count; ++thread)
+		{
+			threads.emplace_back([&, thread]()
+			{
+				for (auto index = 0u; index < k_per_thread; ++index)
+				{
+					EXPECT_TRUE(queue.push(thread * k_per_thread + index));
+				}
+				finished.fetch_add(1);
+			});
+		}
+
+		// Draining while the producers are still pushing
+		while (finished.load() < k_thread_count)
+		{
+			drained += queue.drain([&](const std::span<const UInt32> events)
+			{
+				for (const auto event : events)
+				{
+					++seen[event];
+				}
+			});
+		}
+	}
+	drained += queue.drain([&](const std::span<const UInt32> events)
+	{
+		for (const auto event : events)
+		{
+			++seen[event];
+		}
+	});
+
+	ASSERT_EQ(drained, k_thread_count * k_per_thread);
+	ASSERT_EQ(std::count(seen.begin(), seen.end(), 1u), static_cast<std::ptrdiff_t>(seen.size()));
+}
\ No newline at end of file
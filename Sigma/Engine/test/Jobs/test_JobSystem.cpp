@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include <Sigma/Engine/Jobs/JobSystem.hpp>
+
+using namespace sigma;
+
+TEST(JobSystem, construction_worker_count)
+{
+	const JobSystem job_system{ 3 };
+	ASSERT_EQ(job_system.worker_count(), 3);
+}
+
+TEST(JobSystem, submit)
+{
+	std::atomic<int> counter{};
+	{
+		JobSystem job_system{ 2 };
+		for (auto job = 0; job < 100; ++job)
+		{
+			job_system.submit([&]() { counter.fetch_add(1); });
+		}
+
+		while (counter.load() != 100)
+		{
+			std::this_thread::yield();
+		}
+	}
+	ASSERT_EQ(counter.load(), 100);
+}
+
+TEST(JobSystem, submit_without_workers)
+{
+	JobSystem job_system{ 0 };
+	auto executed = false;
+	job_system.submit([&]() { executed = true; });
+	ASSERT_TRUE(executed);
+}
+
+TEST(JobSystem, parallel_for_covers_range_once)
+{
+	JobSystem job_system{ 4 };
+	std::vector<int> visits(10'000, 0);
+
+	job_system.parallel_for(0, visits.size(), 64, [&](const std::size_t begin, const std::size_t end)
+	{
+		for (auto index = begin; index < end; ++index)
+		{
+			++visits[index];
+		}
+	});
+
+	ASSERT_EQ(std::accumulate(visits.cbegin(), visits.cend(), 0), 10'000);
+	ASSERT_TRUE(std::all_of(visits.cbegin(), visits.cend(), [](const int value) { return value == 1; }));
+}
+
+TEST(JobSystem, parallel_for_empty_range)
+{
+	JobSystem job_system{ 2 };
+	auto called = false;
+	job_system.parallel_for(5, 5, 1, [&](std::size_t, std::size_t) { called = true; });
+	ASSERT_FALSE(called);
+}
+
+TEST(JobSystem, parallel_for_nested)
+{
+	JobSystem job_system{ 2 };
+	std::atomic<std::size_t> sum{};
+
+	job_system.parallel_for(0, 8, 1, [&](const std::size_t outer_begin, const std::size_t outer_end)
+	{
+		for (auto outer = outer_begin; outer < outer_end; ++outer)
+		{
+			job_system.parallel_for(0, 100, 10, [&](const std::size_t begin, const std::size_t end)
+			{
+				sum.fetch_add(end - begin);
+			});
+		}
+	});
+
+	ASSERT_EQ(sum.load(), 800);
+}
+
+TEST(JobSystem, worker_statistics)
+{
+	JobSystem job_system{ 2 };
+	std::atomic<int> remaining{ 10 };
+	for (auto job = 0; job < 10; ++job)
+	{
+		job_system.submit([&]()
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			--remaining;
+		});
+	}
+	while (remaining != 0)
+	{
+		std::this_thread::yield();
+	}
+
+	// The counters are bumped just after the job returns
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	ASSERT_EQ(job_system.get_worker_job_count(0) + job_system.get_worker_job_count(1), 10);
+	ASSERT_GE(job_system.get_worker_busy_nanoseconds(0) + job_system.get_worker_busy_nanoseconds(1), 10'000'000);
+}
\ No newline at end of file
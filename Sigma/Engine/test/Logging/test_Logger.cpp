@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <Sigma/Engine/Logging/Logger.hpp>
+
+#include <sstream>
+
+using namespace sigma;
+
+namespace
+{
+	std::filesystem::path get_log_path(const std::string_view name)
+	{
+		return std::filesystem::temp_directory_path() / name;
+	}
+
+	std::vector<std::string> read_messages(const std::filesystem::path& path)
+	{
+		std::ifstream file{ path };
+		std::vector<std::string> messages{};
+		for (std::string line; std::getline(file, line);)
+		{
+			// Drops the timestamp, level and thread prefixes
+			messages.push_back(line.substr(line.find("] ", line.find("] ", line.find("] ") + 2) + 2) + 2));
+		}
+		return messages;
+	}
+}
+
+TEST(Logger, formats_arguments)
+{
+	const auto path = get_log_path("sigma_test_logger_format.log");
+	{
+		Logger logger{};
+		ASSERT_TRUE(logger.open(path));
+		logger.log<"plain">(LogLevel::info);
+		logger.log<"int {} float {} bool {}">(LogLevel::warning, -42, 1.5f, true);
+		const std::string name = "crowd";
+		logger.log<"{} has {} entities, {}">(LogLevel::error, name, UInt64{ 10000 }, "done");
+		logger.log<"hidden">(LogLevel::debug);
+		logger.flush();
+		ASSERT_EQ(logger.get_written_count(), 3);
+	}
+
+	const auto messages = read_messages(path);
+	ASSERT_EQ(messages, (std::vector<std::string>{ "plain", "int -42 float 1.5 bool true", "crowd has 10000 entities, done" }));
+
+	std::ifstream file{ path };
+	std::string line;
+	std::getline(file, line);
+	ASSERT_NE(line.find("[info]"), std::string::npos);
+}
+
+TEST(Logger, records_before_open_are_kept)
+{
+	const auto path = get_log_path("sigma_test_logger_early.log");
+	{
+		Logger logger{};
+		logger.log<"early {}">(LogLevel::info, 1);
+		ASSERT_TRUE(logger.open(path));
+		logger.log<"late {}">(LogLevel::info, 2);
+	}
+
+	ASSERT_EQ(read_messages(path), (std::vector<std::string>{ "early 1", "late 2" }));
+}
+
+TEST(Logger, counts_dropped_records)
+{
+	const auto path = get_log_path("sigma_test_logger_dropped.log");
+	Logger logger{ 256 };
+	for (auto index = 0; index < 100; ++index)
+	{
+		logger.log<"record {}">(LogLevel::info, index);
+	}
+	ASSERT_GT(logger.get_dropped_count(), 0);
+
+	ASSERT_TRUE(logger.open(path));
+	logger.flush();
+	ASSERT_EQ(logger.get_written_count() + logger.get_dropped_count(), 100);
+
+	// The ring wraps around many times once it is drained
+	for (auto index = 0; index < 200; ++index)
+	{
+		logger.log<"wrapped {} {}">(LogLevel::info, index, std::string_view{ "text" });
+		if (index % 4 == 0)
+		{
+			logger.flush();
+		}
+	}
+	logger.close();
+
+	const auto messages = read_messages(path);
+	ASSERT_EQ(messages.back(), "wrapped 199 text");
+}
+
+TEST(Logger, multiple_threads)
+{
+	constexpr auto k_thread_count = 4;
+	constexpr auto k_record_count = 2000;
+
+	const auto path = get_log_path("sigma_test_logger_threads.log");
+	Logger logger{ 1 << 20 };
+	ASSERT_TRUE(logger.open(path));
+	{
+		std::vector<std::jthread> threads{};
+		for (auto thread = 0; thread < k_thread_count; ++thread)
+		{
+			threads.emplace_back([&, thread]()
+			{
+				for (auto index = 0; index < k_record_count; ++index)
+				{
+					logger.log<"{} {}">(LogLevel::info, thread, index);
+				}
+			});
+		}
+	}
+	logger.close();
+
+	ASSERT_EQ(logger.get_dropped_count(), 0);
+	ASSERT_EQ(logger.get_written_count(), k_thread_count * k_record_count);
+
+	// Every thread's records arrive in the order they were logged
+	std::vector<int> next(k_thread_count, 0);
+	for (const auto& message : read_messages(path))
+	{
+		std::istringstream stream{ message };
+		int thread = 0;
+		int index = 0;
+		stream >> thread >> index;
+		ASSERT_EQ(index, next[static_cast<std::size_t>(thread)]++);
+	}
+	ASSERT_EQ(next, std::vector<int>(k_thread_count, k_record_count));
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include <Sigma/Engine/Particles/ParticleSystem.hpp>
+
+using namespace sigma;
+
+TEST(ParticleSystem, emit_within_spread_and_capacity)
+{
+	JobSystem job_system{ 0 };
+	ParticleSystem particles{ 100 };
+	const ParticleEmitter emitter{ { 1.0f, 2.0f, 3.0f }, 0.5f, { 0.0f, 4.0f, 0.0f }, 1.0f, 2.0f, 0.25f, 0xFF00FF00 };
+	ASSERT_EQ(particles.emit(emitter, 60, 1, job_system), 60);
+	ASSERT_EQ(particles.emit(emitter, 60, 2, job_system), 40);
+	ASSERT_EQ(particles.size(), 100);
+
+	const auto streams = particles.get_streams();
+	for (std::size_t index = 0; index < streams.size; ++index)
+	{
+		ASSERT_NEAR(streams.position_x[index], 1.0f, 0.5f);
+		ASSERT_NEAR(streams.position_z[index], 3.0f, 0.5f);
+		ASSERT_NEAR(streams.velocity_y[index], 4.0f, 1.0f);
+		ASSERT_NEAR(streams.lifetime[index], 2.0f, 0.25f);
+		ASSERT_FLOAT_EQ(streams.age[index], 0.0f);
+		ASSERT_EQ(streams.color[index], 0xFF00FF00);
+	}
+	ASSERT_NE(streams.position_x[0], streams.position_x[1]);
+}
+
+TEST(ParticleSystem, update_integrates)
+{
+	JobSystem job_system{ 0 };
+	ParticleSystem particles{ 16 };
+	particles.emit({ { 0.0f, 10.0f, 0.0f }, 0.0f, { 1.0f, 0.0f, 0.0f }, 0.0f, 5.0f }, 7, 0, job_system);
+
+	particles.update(0.5f, { 0.0f, -10.0f, 0.0f }, job_system);
+	const auto streams = particles.get_streams();
+	ASSERT_EQ(streams.size, 7);
+	for (std::size_t index = 0; index < streams.size; ++index)
+	{
+		ASSERT_FLOAT_EQ(streams.velocity_y[index], -5.0f);
+		ASSERT_FLOAT_EQ(streams.position_y[index], 7.5f);
+		ASSERT_FLOAT_EQ(streams.position_x[index], 0.5f);
+		ASSERT_FLOAT_EQ(streams.age[index], 0.5f);
+	}
+}
+
+TEST(ParticleSystem, dead_particles_are_compacted_in_order)
+{
+	JobSystem job_system{ 3 };
+	constexpr std::size_t k_batch = ParticleSystem::k_chunk_size + 123;
+	ParticleSystem particles{ k_batch * 3 };
+
+	// Interleaved batches with short and long lifetimes, told apart by color
+	particles.emit({ {}, 0.0f, {}, 0.0f, 1.0f, 0.0f, 1 }, k_batch, 0, job_system);
+	particles.emit({ {}, 0.0f, {}, 0.0f, 3.0f, 0.0f, 2 }, k_batch, 0, job_system);
+	particles.emit({ {}, 0.0f, {}, 0.0f, 1.0f, 0.0f, 3 }, k_batch, 0, job_system);
+
+	particles.update(0.75f, {}, job_system);
+	ASSERT_EQ(particles.size(), k_batch * 3);
+
+	particles.update(0.75f, {}, job_system);
+	auto streams = particles.get_streams();
+	ASSERT_EQ(streams.size, k_batch);
+	for (std::size_t index = 0; index < streams.size; ++index)
+	{
+		ASSERT_EQ(streams.color[index], 2u);
+		ASSERT_FLOAT_EQ(streams.age[index], 1.5f);
+	}
+
+	// Room freed by the compaction is used by the next batch
+	ASSERT_EQ(particles.emit({ {}, 0.0f, {}, 0.0f, 1.0f, 0.0f, 4 }, k_batch * 2, 0, job_system), k_batch * 2);
+	particles.update(2.0f, {}, job_system);
+	ASSERT_EQ(particles.size(), 0);
+}
\ No newline at end of file
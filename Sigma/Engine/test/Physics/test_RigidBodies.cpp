@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include <Sigma/Engine/Physics/RigidBodies.hpp>
+
+using namespace sigma;
+
+TEST(RigidBodies, add_and_erase)
+{
+	RigidBodies bodies{ 16 };
+	bodies.add(4, { { 1.0f, 2.0f, 3.0f }, { 0.0f, 1.0f, 0.0f }, 2.0f, { 1.0f, 1.0f, 1.0f } });
+	bodies.add(7, { { 5.0f, 0.0f, 0.0f } });
+	const auto version = bodies.get_version();
+	ASSERT_EQ(bodies.size(), 2);
+	ASSERT_TRUE(bodies.contains(4));
+
+	const auto bounds = bodies.get_bounds(4);
+	ASSERT_FLOAT_EQ(bounds.min.x, 0.0f);
+	ASSERT_FLOAT_EQ(bounds.max.z, 4.0f);
+	ASSERT_FLOAT_EQ(bodies.get_velocity(4).y, 1.0f);
+
+	bodies.erase(4);
+	ASSERT_EQ(bodies.size(), 1);
+	ASSERT_FALSE(bodies.contains(4));
+	ASSERT_EQ(bodies.get_entity(0), 7);
+	ASSERT_FLOAT_EQ(bodies.get_position(7).x, 5.0f);
+	ASSERT_NE(bodies.get_version(), version);
+}
+
+TEST(RigidBodies, semi_implicit_integration)
+{
+	JobSystem job_system{ 0 };
+	RigidBodies bodies{ 16 };
+	bodies.add(0, { { 0.0f, 10.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }, 1.0f });
+	bodies.add(1, { { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, 0.0f });
+
+	bodies.integrate(0.5f, { 0.0f, -10.0f, 0.0f }, job_system);
+	// The velocity is updated first and the position moves with the new velocity
+	ASSERT_FLOAT_EQ(bodies.get_velocity(0).y, -5.0f);
+	ASSERT_FLOAT_EQ(bodies.get_position(0).y, 7.5f);
+	ASSERT_FLOAT_EQ(bodies.get_position(0).x, 0.5f);
+	ASSERT_FLOAT_EQ(bodies.get_position(1).y, 0.0f);
+
+	bodies.apply_force(1, { 10.0f, 0.0f, 0.0f });
+	bodies.apply_force(0, { 0.0f, 0.0f, 4.0f });
+	bodies.integrate(0.5f, { 0.0f, 0.0f, 0.0f }, job_system);
+	ASSERT_FLOAT_EQ(bodies.get_velocity(1).x, 0.0f);
+	ASSERT_FLOAT_EQ(bodies.get_velocity(0).z, 2.0f);
+
+	// Forces are consumed by the step
+	bodies.integrate(0.5f, { 0.0f, 0.0f, 0.0f }, job_system);
+	ASSERT_FLOAT_EQ(bodies.get_velocity(0).z, 2.0f);
+}
+
+TEST(RigidBodies, vector_and_scalar_paths_agree)
+{
+	JobSystem job_system{ 2 };
+	RigidBodies bodies{ 64 };
+	for (Entity entity = 0; entity < 37; ++entity)
+	{
+		const auto value = static_cast<Float>(entity);
+		bodies.add(entity, { { value, 0.0f, 0.0f }, { 0.0f, value, 0.0f }, entity % 3 == 0 ? 0.0f : value });
+		bodies.apply_force(entity, { 0.0f, 0.0f, value });
+	}
+
+	bodies.integrate(0.25f, { 0.0f, -8.0f, 0.0f }, job_system);
+	for (Entity entity = 0; entity < 37; ++entity)
+	{
+		const auto value = static_cast<Float>(entity);
+		const auto inverse_mass = entity % 3 == 0 ? 0.0f : 1.0f / value;
+		const auto velocity_y = value + (inverse_mass > 0.0f ? -8.0f : 0.0f) * 0.25f;
+		const auto velocity_z = value * inverse_mass * 0.25f;
+		ASSERT_FLOAT_EQ(bodies.get_velocity(entity).y, velocity_y);
+		ASSERT_FLOAT_EQ(bodies.get_position(entity).y, velocity_y * 0.25f);
+		ASSERT_FLOAT_EQ(bodies.get_position(entity).z, velocity_z * 0.25f);
+	}
+}
\ No newline at end of file
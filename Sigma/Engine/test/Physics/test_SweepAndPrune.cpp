@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <utility>
+
+#include <Sigma/Engine/Physics/SweepAndPrune.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	std::vector<std::pair<Entity, Entity>> normalize(const std::vector<ContactPair>& pairs)
+	{
+		std::vector<std::pair<Entity, Entity>> result{};
+		for (const auto& pair : pairs)
+		{
+			result.emplace_back(std::min(pair.first, pair.second), std::max(pair.first, pair.second));
+		}
+		std::sort(result.begin(), result.end());
+		return result;
+	}
+
+	std::vector<std::pair<Entity, Entity>> brute_force(const RigidBodies& bodies)
+	{
+		std::vector<ContactPair> pairs{};
+		for (std::size_t first = 0; first < bodies.size(); ++first)
+		{
+			for (auto second = first + 1; second < bodies.size(); ++second)
+			{
+				if (intersects(bodies.get_bounds(bodies.get_entity(first)), bodies.get_bounds(bodies.get_entity(second))))
+				{
+					pairs.push_back({ bodies.get_entity(first), bodies.get_entity(second) });
+				}
+			}
+		}
+		return normalize(pairs);
+	}
+}
+
+TEST(SweepAndPrune, finds_overlapping_pairs)
+{
+	JobSystem job_system{ 0 };
+	RigidBodies bodies{ 16 };
+	bodies.add(1, { { 0.0f, 0.0f, 0.0f } });
+	bodies.add(2, { { 0.5f, 0.5f, 0.0f } });
+	bodies.add(3, { { 0.5f, 5.0f, 0.0f } });
+	bodies.add(4, { { 9.0f, 0.0f, 0.0f } });
+
+	SweepAndPrune broadphase{};
+	std::vector<ContactPair> pairs{};
+	broadphase.update(bodies, pairs, job_system);
+	ASSERT_EQ(normalize(pairs), (std::vector<std::pair<Entity, Entity>>{ { 1, 2 } }));
+}
+
+TEST(SweepAndPrune, matches_brute_force_over_frames)
+{
+	JobSystem job_system{ 3 };
+	std::mt19937 generator{ 7 };
+	std::uniform_real_distribution<float> position{ -60.0f, 60.0f };
+	std::uniform_real_distribution<float> velocity{ -4.0f, 4.0f };
+
+	constexpr Entity k_count = 3000;
+	RigidBodies bodies{ k_count };
+	for (Entity entity = 0; entity < k_count; ++entity)
+	{
+		bodies.add(entity, { { position(generator), position(generator), position(generator) }, { velocity(generator), velocity(generator), velocity(generator) } });
+	}
+
+	SweepAndPrune broadphase{};
+	std::vector<ContactPair> pairs{};
+	broadphase.update(bodies, pairs, job_system);
+	ASSERT_TRUE(broadphase.was_fully_sorted());
+	ASSERT_EQ(normalize(pairs), brute_force(bodies));
+
+	for (auto frame = 0; frame < 5; ++frame)
+	{
+		bodies.integrate(1.0f / 60.0f, { 0.0f, 0.0f, 0.0f }, job_system);
+		broadphase.update(bodies, pairs, job_system);
+		ASSERT_FALSE(broadphase.was_fully_sorted());
+		ASSERT_EQ(normalize(pairs), brute_force(bodies));
+	}
+
+	bodies.erase(10);
+	broadphase.update(bodies, pairs, job_system);
+	ASSERT_TRUE(broadphase.was_fully_sorted());
+	ASSERT_EQ(normalize(pairs), brute_force(bodies));
+}
+
+TEST(SweepAndPrune, falls_back_to_full_sort)
+{
+	JobSystem job_system{ 0 };
+	RigidBodies bodies{ 256 };
+	for (Entity entity = 0; entity < 200; ++entity)
+	{
+		bodies.add(entity, { { static_cast<Float>(entity) * 2.0f, 0.0f, 0.0f } });
+	}
+
+	SweepAndPrune broadphase{};
+	std::vector<ContactPair> pairs{};
+	broadphase.update(bodies, pairs, job_system);
+
+	// Mirroring every body reverses the order, far beyond the insertion sort budget
+	for (Entity entity = 0; entity < 200; ++entity)
+	{
+		bodies.set_velocity(entity, { -static_cast<Float>(entity) * 4.0f, 0.0f, 0.0f });
+	}
+	bodies.integrate(1.0f, { 0.0f, 0.0f, 0.0f }, job_system);
+	broadphase.update(bodies, pairs, job_system);
+	ASSERT_TRUE(broadphase.was_fully_sorted());
+	ASSERT_EQ(normalize(pairs), brute_force(bodies));
+}
\ No newline at end of file
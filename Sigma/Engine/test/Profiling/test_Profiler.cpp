@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include <Sigma/Engine/Profiling/Profiler.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	std::vector<ProfileSample> drain(Profiler& profiler)
+	{
+		std::vector<ProfileSample> samples{};
+		ProfileSample sample{};
+		while (profiler.try_pop(sample))
+		{
+			samples.push_back(sample);
+		}
+		return samples;
+	}
+}
+
+TEST(Profiler, frame_scopes_and_memory)
+{
+	Profiler profiler{};
+	JobSystem job_system{ 2 };
+
+	{
+		const ProfileScope scope{ profiler, "Update" };
+		std::this_thread::sleep_for(std::chrono::milliseconds(2));
+	}
+	profiler.record_memory("Pool", 1024);
+	profiler.end_frame(job_system);
+
+	const auto samples = drain(profiler);
+	ASSERT_EQ(samples.size(), 5);
+
+	ASSERT_EQ(samples[0].type, ProfileSampleType::scope);
+	ASSERT_STREQ(samples[0].name, "Update");
+	ASSERT_GE(samples[0].value, 2'000'000);
+	ASSERT_EQ(samples[0].frame, 0);
+
+	ASSERT_EQ(samples[1].type, ProfileSampleType::memory);
+	ASSERT_EQ(samples[1].value, 1024);
+
+	ASSERT_EQ(samples[2].type, ProfileSampleType::frame);
+	ASSERT_GE(samples[2].value, samples[0].value);
+
+	ASSERT_EQ(samples[3].type, ProfileSampleType::worker);
+	ASSERT_EQ(samples[3].thread, 0);
+	ASSERT_EQ(samples[4].thread, 1);
+	ASSERT_EQ(profiler.get_frame_index(), 1);
+}
+
+TEST(Profiler, drops_when_full)
+{
+	Profiler profiler{ 4 };
+	for (auto sample = 0; sample < 6; ++sample)
+	{
+		profiler.record_memory("Pool", 0);
+	}
+	ASSERT_EQ(profiler.get_dropped_count(), 2);
+	ASSERT_EQ(drain(profiler).size(), 4);
+}
+
+TEST(Profiler, thread_indices_are_distinct)
+{
+	const auto main_index = Profiler::get_thread_index();
+	ASSERT_EQ(Profiler::get_thread_index(), main_index);
+
+	UInt32 other_index{};
+	std::jthread{ [&]() { other_index = Profiler::get_thread_index(); } }.join();
+	ASSERT_NE(other_index, main_index);
+}
\ No newline at end of file
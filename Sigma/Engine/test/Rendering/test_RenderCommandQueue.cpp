@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+#include <Sigma/Engine/Rendering/RenderCommandQueue.hpp>
+
+using namespace sigma;
+
+TEST(RenderCommandQueue, hand_off)
+{
+	RenderCommandQueue queue{};
+
+	auto* first = queue.begin_frame();
+	ASSERT_NE(first, nullptr);
+	first->push(1, DrawMeshCommand{});
+	queue.submit_frame();
+
+	auto* second = queue.begin_frame();
+	ASSERT_NE(second, first);
+	ASSERT_EQ(second->get_frame_index(), first->get_frame_index() + 1);
+	queue.submit_frame();
+
+	ASSERT_EQ(queue.acquire_frame(), first);
+	ASSERT_EQ(first->size(), 1);
+	queue.release_frame();
+	ASSERT_EQ(queue.acquire_frame(), second);
+	queue.release_frame();
+
+	ASSERT_EQ(queue.begin_frame(), first);
+	ASSERT_EQ(first->size(), 0);
+}
+
+TEST(RenderCommandQueue, close)
+{
+	RenderCommandQueue queue{};
+	static_cast<void>(queue.begin_frame());
+	queue.submit_frame();
+	queue.close();
+
+	ASSERT_TRUE(queue.is_closed());
+	ASSERT_EQ(queue.begin_frame(), nullptr);
+	ASSERT_NE(queue.acquire_frame(), nullptr);
+	queue.release_frame();
+	ASSERT_EQ(queue.acquire_frame(), nullptr);
+}
+
+TEST(RenderThread, consumes_frames_in_order)
+{
+	constexpr UInt64 k_frame_count = 200;
+
+	RenderCommandQueue queue{};
+	std::vector<UInt64> rendered{};
+	std::atomic<bool> sorted{ true };
+	{
+		RenderThread render_thread{ queue, [&](RenderFrame& frame)
+		{
+			rendered.push_back(frame.get_frame_index());
+			const auto& commands = frame.get_commands();
+			sorted = sorted && std::is_sorted(commands.begin(), commands.end(), [](const auto& left, const auto& right) { return left.key < right.key; });
+		} };
+
+		for (UInt64 frame_index = 0; frame_index < k_frame_count; ++frame_index)
+		{
+			auto* frame = queue.begin_frame();
+			ASSERT_NE(frame, nullptr);
+			for (UInt64 key = 16; key > 0; --key)
+			{
+				frame->push(key * 31 % 17, DrawMeshCommand{});
+			}
+			queue.submit_frame();
+		}
+	}
+
+	ASSERT_TRUE(sorted);
+	ASSERT_EQ(rendered.size(), k_frame_count);
+	for (UInt64 frame_index = 0; frame_index < k_frame_count; ++frame_index)
+	{
+		ASSERT_EQ(rendered[frame_index], frame_index);
+	}
+}
\ No newline at end of file
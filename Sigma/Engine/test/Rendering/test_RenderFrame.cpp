@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+#include <Sigma/Engine/Rendering/RenderFrame.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	DrawMeshCommand make_command(const UInt32 vertex_count)
+	{
+		DrawMeshCommand command{};
+		command.vertex_count = vertex_count;
+		return command;
+	}
+}
+
+TEST(RenderFrame, make_render_key)
+{
+	ASSERT_LT(make_render_key(0, 0, 0.9f, 5), make_render_key(0, 1, 0.1f, 0));
+	ASSERT_LT(make_render_key(0, 7, 0.9f, 5), make_render_key(1, 0, 0.1f, 0));
+	ASSERT_LT(make_render_key(0, 0, 0.1f, 9), make_render_key(0, 0, 0.2f, 1));
+	ASSERT_LT(make_render_key(0, 0, 0.5f, 1), make_render_key(0, 0, 0.5f, 2));
+	ASSERT_EQ(make_render_key(0, 0, -1.0f, 0), make_render_key(0, 0, 0.0f, 0));
+	ASSERT_EQ(make_render_key(0, 0, 2.0f, 0), make_render_key(0, 0, 1.0f, 0));
+}
+
+TEST(RenderFrame, push)
+{
+	RenderFrame frame{};
+	frame.push(3, make_command(30));
+	frame.push(1, make_command(10));
+
+	ASSERT_EQ(frame.size(), 2);
+	ASSERT_EQ(frame.get_commands()[1].key, 1);
+	ASSERT_EQ(frame.get_commands()[1].type, RenderCommandType::draw_mesh);
+	ASSERT_EQ(frame.get_payload<DrawMeshCommand>(frame.get_commands()[0]).vertex_count, 30);
+	ASSERT_EQ(frame.get_payload<DrawMeshCommand>(frame.get_commands()[1]).vertex_count, 10);
+
+	frame.clear();
+	ASSERT_EQ(frame.size(), 0);
+}
+
+TEST(RenderFrame, sort)
+{
+	std::mt19937_64 generator{ 13 };
+	std::uniform_int_distribution<UInt64> key{ 0, 50 };
+
+	RenderFrame frame{};
+	std::vector<std::pair<UInt64, UInt32>> expected{};
+	for (UInt32 index = 0; index < 5000; ++index)
+	{
+		const auto value = key(generator) << 40 | key(generator);
+		frame.push(value, make_command(index));
+		expected.emplace_back(value, index);
+	}
+
+	frame.sort();
+	std::stable_sort(expected.begin(), expected.end(), [](const auto& left, const auto& right) { return left.first < right.first; });
+
+	for (std::size_t index = 0; index < expected.size(); ++index)
+	{
+		const auto& command = frame.get_commands()[index];
+		ASSERT_EQ(command.key, expected[index].first);
+		ASSERT_EQ(frame.get_payload<DrawMeshCommand>(command).vertex_count, expected[index].second);
+	}
+}
+
+TEST(RenderFrame, draw)
+{
+	const std::vector<RasterVertex> vertices{
+		{ { -1.0f, 1.0f, 0.5f }, { 1.0f, 0.0f, 0.0f } }, { { 1.0f, 1.0f, 0.5f }, { 1.0f, 0.0f, 0.0f } },
+		{ { 1.0f, -1.0f, 0.5f }, { 1.0f, 0.0f, 0.0f } }, { { -1.0f, -1.0f, 0.5f }, { 1.0f, 0.0f, 0.0f } }
+	};
+	const std::vector<UInt32> indices{ 0, 1, 2, 0, 2, 3 };
+
+	DrawMeshCommand command{};
+	DirectX::XMStoreFloat4x4(&command.world_view_projection, DirectX::XMMatrixIdentity());
+	command.vertices = vertices.data();
+	command.vertex_count = static_cast<UInt32>(vertices.size());
+	command.indices = indices.data();
+	command.index_count = static_cast<UInt32>(indices.size());
+
+	RenderFrame frame{};
+	frame.push(0, command);
+
+	RenderTarget target{ 16, 16 };
+	JobSystem job_system{ 1 };
+	SoftwareRasterizer rasterizer{};
+	rasterizer.begin_frame();
+	draw(frame, rasterizer);
+	rasterizer.render(target, job_system);
+
+	ASSERT_EQ(target.get_color(8, 8), 0xFFFF0000);
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include <Sigma/Engine/Rendering/RenderTarget.hpp>
+
+using namespace sigma;
+
+TEST(RenderTarget, resize)
+{
+	RenderTarget target{ 100, 70 };
+
+	ASSERT_EQ(target.get_width(), 100);
+	ASSERT_EQ(target.get_height(), 70);
+	ASSERT_EQ(target.get_stride(), 128);
+	ASSERT_EQ(target.get_padded_height(), 128);
+	ASSERT_FLOAT_EQ(target.get_depth(99, 69), 1.0f);
+
+	target.resize(64, 1);
+	ASSERT_EQ(target.get_stride(), 64);
+	ASSERT_EQ(target.get_padded_height(), 64);
+}
+
+TEST(RenderTarget, save_ppm)
+{
+	RenderTarget target{ 3, 2 };
+	target.get_color_data()[1] = 0xFF102030;
+
+	const auto path = std::filesystem::temp_directory_path() / "sigma_test_render_target.ppm";
+	ASSERT_TRUE(target.save_ppm(path));
+
+	std::ifstream file{ path, std::ios::binary };
+	std::string magic{};
+	std::size_t width{};
+	std::size_t height{};
+	std::size_t max_value{};
+	file >> magic >> width >> height >> max_value;
+	file.get();
+
+	std::vector<char> pixels(width * height * 3);
+	file.read(pixels.data(), static_cast<std::streamsize>(pixels.size()));
+	ASSERT_TRUE(file);
+	ASSERT_EQ(magic, "P6");
+	ASSERT_EQ(width, 3);
+	ASSERT_EQ(height, 2);
+	ASSERT_EQ(max_value, 255);
+	ASSERT_EQ(pixels[3], 0x10);
+	ASSERT_EQ(pixels[4], 0x20);
+	ASSERT_EQ(pixels[5], 0x30);
+	ASSERT_EQ(pixels[0], 0);
+
+	file.close();
+	std::filesystem::remove(path);
+}
\ No newline at end of file
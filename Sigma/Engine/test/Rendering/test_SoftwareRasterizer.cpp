@@ -0,0 +1,217 @@
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include <Sigma/Engine/Rendering/SoftwareRasterizer.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	constexpr UInt32 k_red = 0xFFFF0000;
+	constexpr UInt32 k_green = 0xFF00FF00;
+	constexpr UInt32 k_blue = 0xFF0000FF;
+
+	Matrix4x4 make_identity()
+	{
+		Matrix4x4 result{};
+		DirectX::XMStoreFloat4x4(&result, DirectX::XMMatrixIdentity());
+		return result;
+	}
+
+	std::vector<RasterVertex> make_quad(const float depth, const Vector3& color, const float extent = 1.0f)
+	{
+		return {
+			{ { -extent, extent, depth }, color }, { { extent, extent, depth }, color },
+			{ { extent, -extent, depth }, color }, { { -extent, -extent, depth }, color }
+		};
+	}
+
+	const std::vector<UInt32> k_quad_indices{ 0, 1, 2, 0, 2, 3 };
+
+	std::size_t count_pixels(const RenderTarget& target, const UInt32 color)
+	{
+		std::size_t count = 0;
+		for (std::size_t y = 0; y < target.get_height(); ++y)
+		{
+			for (std::size_t x = 0; x < target.get_width(); ++x)
+			{
+				count += target.get_color(x, y) == color ? 1u : 0u;
+			}
+		}
+		return count;
+	}
+}
+
+TEST(SoftwareRasterizer, clears_target)
+{
+	RenderTarget target{ 70, 50 };
+	JobSystem job_system{ 2 };
+	SoftwareRasterizer rasterizer{};
+	rasterizer.set_clear_color(k_blue);
+	rasterizer.begin_frame();
+	rasterizer.render(target, job_system);
+
+	ASSERT_EQ(count_pixels(target, k_blue), 70 * 50);
+	ASSERT_EQ(rasterizer.get_triangle_count(), 0);
+}
+
+TEST(SoftwareRasterizer, full_screen_quad)
+{
+	RenderTarget target{ 100, 70 };
+	JobSystem job_system{ 2 };
+	SoftwareRasterizer rasterizer{};
+	rasterizer.begin_frame();
+	rasterizer.draw(make_quad(0.5f, { 1.0f, 0.0f, 0.0f }), k_quad_indices, make_identity());
+	rasterizer.render(target, job_system);
+
+	ASSERT_EQ(rasterizer.get_triangle_count(), 2);
+	ASSERT_EQ(count_pixels(target, k_red), 100 * 70);
+	ASSERT_FLOAT_EQ(target.get_depth(50, 35), 0.5f);
+}
+
+TEST(SoftwareRasterizer, cull_mode)
+{
+	RenderTarget target{ 32, 32 };
+	JobSystem job_system{ 1 };
+	SoftwareRasterizer rasterizer{};
+	const std::vector<UInt32> reversed{ 0, 2, 1, 0, 3, 2 };
+
+	rasterizer.begin_frame();
+	rasterizer.draw(make_quad(0.5f, { 1.0f, 0.0f, 0.0f }), reversed, make_identity());
+	rasterizer.render(target, job_system);
+	ASSERT_EQ(count_pixels(target, k_red), 0);
+
+	rasterizer.set_cull_mode(CullMode::none);
+	rasterizer.render(target, job_system);
+	ASSERT_EQ(count_pixels(target, k_red), 32 * 32);
+}
+
+TEST(SoftwareRasterizer, depth_test)
+{
+	RenderTarget target{ 64, 64 };
+	JobSystem job_system{ 2 };
+	SoftwareRasterizer rasterizer{};
+	rasterizer.begin_frame();
+	rasterizer.draw(make_quad(0.25f, { 0.0f, 1.0f, 0.0f }, 0.5f), k_quad_indices, make_identity());
+	rasterizer.draw(make_quad(0.75f, { 1.0f, 0.0f, 0.0f }), k_quad_indices, make_identity());
+	rasterizer.render(target, job_system);
+
+	ASSERT_EQ(count_pixels(target, k_green), 32 * 32);
+	ASSERT_EQ(count_pixels(target, k_red), 64 * 64 - 32 * 32);
+	ASSERT_EQ(target.get_color(32, 32), k_green);
+	ASSERT_EQ(target.get_color(2, 2), k_red);
+}
+
+TEST(SoftwareRasterizer, interpolates_colors)
+{
+	RenderTarget target{ 64, 64 };
+	JobSystem job_system{ 1 };
+	SoftwareRasterizer rasterizer{};
+	const std::vector<RasterVertex> vertices{
+		{ { -1.0f, 1.0f, 0.5f }, { 1.0f, 0.0f, 0.0f } }, { { 1.0f, 1.0f, 0.5f }, { 0.0f, 0.0f, 1.0f } },
+		{ { 1.0f, -1.0f, 0.5f }, { 0.0f, 0.0f, 1.0f } }, { { -1.0f, -1.0f, 0.5f }, { 1.0f, 0.0f, 0.0f } }
+	};
+	rasterizer.begin_frame();
+	rasterizer.draw(vertices, k_quad_indices, make_identity());
+	rasterizer.render(target, job_system);
+
+	const auto middle = target.get_color(32, 20);
+	ASSERT_NEAR(static_cast<int>((middle >> 16) & 0xFF), 125, 2);
+	ASSERT_NEAR(static_cast<int>(middle & 0xFF), 129, 2);
+	ASSERT_EQ(target.get_color(0, 10) >> 16 & 0xFF, 0xFD);
+}
+
+TEST(SoftwareRasterizer, shared_edges_leave_no_gaps)
+{
+	constexpr UInt32 k_cells = 23;
+	std::mt19937 generator{ 5 };
+	std::uniform_real_distribution<float> jitter{ -0.3f, 0.3f };
+
+	std::vector<RasterVertex> vertices{};
+	for (UInt32 row = 0; row <= k_cells; ++row)
+	{
+		for (UInt32 column = 0; column <= k_cells; ++column)
+		{
+			const auto is_border = row == 0 || column == 0 || row == k_cells || column == k_cells;
+			const auto step = 2.0f / static_cast<float>(k_cells);
+			const auto x = -1.0f + step * (static_cast<float>(column) + (is_border ? 0.0f : jitter(generator)));
+			const auto y = 1.0f - step * (static_cast<float>(row) + (is_border ? 0.0f : jitter(generator)));
+			vertices.push_back({ { x, y, 0.5f }, { 0.0f, 1.0f, 0.0f } });
+		}
+	}
+
+	std::vector<UInt32> indices{};
+	for (UInt32 row = 0; row < k_cells; ++row)
+	{
+		for (UInt32 column = 0; column < k_cells; ++column)
+		{
+			const auto top_left = row * (k_cells + 1) + column;
+			const auto bottom_left = top_left + k_cells + 1;
+			indices.insert(indices.end(), { top_left, top_left + 1, bottom_left + 1, top_left, bottom_left + 1, bottom_left });
+		}
+	}
+
+	RenderTarget target{ 191, 133 };
+	JobSystem job_system{ 3 };
+	SoftwareRasterizer rasterizer{};
+	rasterizer.begin_frame();
+	rasterizer.draw(vertices, indices, make_identity());
+	rasterizer.render(target, job_system);
+
+	ASSERT_EQ(count_pixels(target, k_green), 191 * 133);
+}
+
+TEST(SoftwareRasterizer, clips_near_plane)
+{
+	const auto view = DirectX::XMMatrixLookAtLH(DirectX::XMVectorSet(0.0f, 1.0f, 0.0f, 1.0f), DirectX::XMVectorSet(0.0f, 1.0f, 1.0f, 1.0f), DirectX::XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f));
+	const auto projection = DirectX::XMMatrixPerspectiveFovLH(DirectX::XM_PIDIV2, 1.0f, 0.1f, 100.0f);
+	Matrix4x4 view_projection{};
+	DirectX::XMStoreFloat4x4(&view_projection, DirectX::XMMatrixMultiply(view, projection));
+
+	const std::vector<RasterVertex> ground{
+		{ { -50.0f, 0.0f, 50.0f }, { 0.0f, 1.0f, 0.0f } }, { { 50.0f, 0.0f, 50.0f }, { 0.0f, 1.0f, 0.0f } },
+		{ { 50.0f, 0.0f, -50.0f }, { 0.0f, 1.0f, 0.0f } }, { { -50.0f, 0.0f, -50.0f }, { 0.0f, 1.0f, 0.0f } }
+	};
+
+	RenderTarget target{ 64, 64 };
+	JobSystem job_system{ 2 };
+	SoftwareRasterizer rasterizer{};
+	rasterizer.begin_frame();
+	rasterizer.draw(ground, k_quad_indices, view_projection);
+	rasterizer.render(target, job_system);
+
+	ASSERT_EQ(target.get_color(32, 63), k_green);
+	ASSERT_EQ(target.get_color(0, 63), k_green);
+	ASSERT_EQ(target.get_color(32, 0), SoftwareRasterizer::k_default_clear_color);
+	ASSERT_GT(rasterizer.get_triangle_count(), 2);
+}
+
+TEST(SoftwareRasterizer, output_independent_of_worker_count)
+{
+	std::mt19937 generator{ 11 };
+	std::uniform_real_distribution<float> position{ -1.2f, 1.2f };
+	std::uniform_real_distribution<float> unit{ 0.0f, 1.0f };
+
+	std::vector<RasterVertex> vertices{};
+	std::vector<UInt32> indices{};
+	for (UInt32 index = 0; index < 3000; ++index)
+	{
+		vertices.push_back({ { position(generator), position(generator), unit(generator) }, { unit(generator), unit(generator), unit(generator) } });
+		indices.push_back(index);
+	}
+
+	const auto render = [&](const std::size_t worker_count)
+	{
+		RenderTarget target{ 200, 150 };
+		JobSystem job_system{ worker_count };
+		SoftwareRasterizer rasterizer{};
+		rasterizer.set_cull_mode(CullMode::none);
+		rasterizer.begin_frame();
+		rasterizer.draw(vertices, indices, make_identity());
+		rasterizer.render(target, job_system);
+		return std::vector<UInt32>(target.get_color_data(), target.get_color_data() + target.get_stride() * target.get_height());
+	};
+
+	ASSERT_EQ(render(0), render(4));
+}
\ No newline at end of file
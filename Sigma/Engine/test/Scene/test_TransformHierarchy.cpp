@@ -0,0 +1,259 @@
+#include <gtest/gtest.h>
+
+#include <Sigma/Engine/Scene/TransformHierarchy.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	Matrix4x4 make_translation(const float x, const float y, const float z)
+	{
+		Matrix4x4 matrix{};
+		DirectX::XMStoreFloat4x4(&matrix, DirectX::XMMatrixTranslation(x, y, z));
+		return matrix;
+	}
+
+	Vector3 get_translation(const Matrix4x4& matrix)
+	{
+		return { matrix._41, matrix._42, matrix._43 };
+	}
+}
+
+TEST(TransformHierarchy, construction_with_reservation)
+{
+	const auto hierarchy = TransformHierarchy(10);
+	ASSERT_EQ(hierarchy.size(), 0);
+	ASSERT_EQ(hierarchy.level_count(), 0);
+}
+
+TEST(TransformHierarchy, emplace)
+{
+	auto hierarchy = TransformHierarchy(3);
+	hierarchy.emplace(5, make_translation(1.0f, 0.0f, 0.0f));
+	hierarchy.emplace(2, make_translation(0.0f, 1.0f, 0.0f), 5);
+	ASSERT_EQ(hierarchy.size(), 2);
+	ASSERT_TRUE(hierarchy.has_node(5));
+	ASSERT_TRUE(hierarchy.has_node(2));
+	ASSERT_FALSE(hierarchy.has_node(0));
+	ASSERT_EQ(hierarchy.get_parent(2), 5);
+	ASSERT_EQ(hierarchy.get_parent(5), k_null_entity);
+}
+
+TEST(TransformHierarchy, update_propagates_world)
+{
+	auto hierarchy = TransformHierarchy(3);
+	hierarchy.emplace(0, make_translation(1.0f, 0.0f, 0.0f));
+	hierarchy.emplace(1, make_translation(0.0f, 2.0f, 0.0f), 0);
+	hierarchy.emplace(2, make_translation(0.0f, 0.0f, 3.0f), 1);
+	hierarchy.update();
+
+	ASSERT_EQ(hierarchy.level_count(), 3);
+	const auto world = get_translation(hierarchy.get_world(2));
+	ASSERT_FLOAT_EQ(world.x, 1.0f);
+	ASSERT_FLOAT_EQ(world.y, 2.0f);
+	ASSERT_FLOAT_EQ(world.z, 3.0f);
+}
+
+TEST(TransformHierarchy, update_sorts_breadth_first)
+{
+	auto hierarchy = TransformHierarchy(5);
+	hierarchy.emplace(0, make_translation(0.0f, 0.0f, 0.0f));
+	hierarchy.emplace(1, make_translation(0.0f, 0.0f, 0.0f), 0);
+	hierarchy.emplace(2, make_translation(0.0f, 0.0f, 0.0f), 1);
+	hierarchy.emplace(3, make_translation(0.0f, 0.0f, 0.0f));
+	hierarchy.emplace(4, make_translation(0.0f, 0.0f, 0.0f), 3);
+	hierarchy.update();
+
+	const auto& nodes = hierarchy.get_nodes();
+	for (auto slot = std::size_t{ 1 }; slot < nodes.size(); ++slot)
+	{
+		ASSERT_LE(nodes.data()[slot - 1].depth, nodes.data()[slot].depth);
+		if (nodes.data()[slot].parent_slot != TransformHierarchy::k_no_slot)
+		{
+			ASSERT_LT(nodes.data()[slot].parent_slot, slot);
+		}
+	}
+}
+
+TEST(TransformHierarchy, structure_tick)
+{
+	auto hierarchy = TransformHierarchy(4);
+	hierarchy.emplace(0, make_translation(0.0f, 0.0f, 0.0f));
+	hierarchy.emplace(1, make_translation(0.0f, 0.0f, 0.0f), 0);
+	hierarchy.update();
+	const auto structure_tick = hierarchy.get_structure_tick();
+	ASSERT_NE(structure_tick, 0);
+
+	// Moving a node keeps the dense order, adding one does not
+	hierarchy.set_local(1, make_translation(1.0f, 0.0f, 0.0f));
+	hierarchy.update();
+	ASSERT_EQ(hierarchy.get_structure_tick(), structure_tick);
+
+	hierarchy.emplace(2, make_translation(0.0f, 0.0f, 0.0f), 1);
+	hierarchy.update();
+	ASSERT_GT(hierarchy.get_structure_tick(), structure_tick);
+}
+
+TEST(TransformHierarchy, set_local_skips_unchanged_subtrees)
+{
+	auto hierarchy = TransformHierarchy(4);
+	hierarchy.emplace(0, make_translation(1.0f, 0.0f, 0.0f));
+	hierarchy.emplace(1, make_translation(1.0f, 0.0f, 0.0f), 0);
+	hierarchy.emplace(2, make_translation(5.0f, 0.0f, 0.0f));
+	hierarchy.emplace(3, make_translation(1.0f, 0.0f, 0.0f), 2);
+	hierarchy.update();
+
+	const auto tick = hierarchy.get_tick();
+	hierarchy.set_local(0, make_translation(2.0f, 0.0f, 0.0f));
+	hierarchy.update();
+
+	ASSERT_EQ(hierarchy.get_world_change_tick(0), tick);
+	ASSERT_EQ(hierarchy.get_world_change_tick(1), tick);
+	ASSERT_LT(hierarchy.get_world_change_tick(2), tick);
+	ASSERT_LT(hierarchy.get_world_change_tick(3), tick);
+	ASSERT_FLOAT_EQ(get_translation(hierarchy.get_world(1)).x, 3.0f);
+	ASSERT_FLOAT_EQ(get_translation(hierarchy.get_world(3)).x, 6.0f);
+}
+
+TEST(TransformHierarchy, set_parent)
+{
+	auto hierarchy = TransformHierarchy(3);
+	hierarchy.emplace(0, make_translation(1.0f, 0.0f, 0.0f));
+	hierarchy.emplace(1, make_translation(10.0f, 0.0f, 0.0f));
+	hierarchy.emplace(2, make_translation(1.0f, 0.0f, 0.0f), 0);
+	hierarchy.update();
+	ASSERT_FLOAT_EQ(get_translation(hierarchy.get_world(2)).x, 2.0f);
+
+	hierarchy.set_parent(2, 1);
+	hierarchy.update();
+	ASSERT_EQ(hierarchy.get_parent(2), 1);
+	ASSERT_FLOAT_EQ(get_translation(hierarchy.get_world(2)).x, 11.0f);
+}
+
+TEST(TransformHierarchy, erase_removes_subtree)
+{
+	auto hierarchy = TransformHierarchy(4);
+	hierarchy.emplace(0, make_translation(0.0f, 0.0f, 0.0f));
+	hierarchy.emplace(1, make_translation(0.0f, 0.0f, 0.0f), 0);
+	hierarchy.emplace(2, make_translation(0.0f, 0.0f, 0.0f), 1);
+	hierarchy.emplace(3, make_translation(0.0f, 0.0f, 0.0f));
+	hierarchy.update();
+
+	hierarchy.erase(1);
+	ASSERT_EQ(hierarchy.size(), 2);
+	ASSERT_TRUE(hierarchy.has_node(0));
+	ASSERT_FALSE(hierarchy.has_node(1));
+	ASSERT_FALSE(hierarchy.has_node(2));
+	ASSERT_TRUE(hierarchy.has_node(3));
+
+	hierarchy.update();
+	ASSERT_EQ(hierarchy.level_count(), 1);
+}
+
+TEST(TransformHierarchy, erase_after_reparenting)
+{
+	// A ternary tree, node n is the parent of 3n + 1 to 3n + 3
+	constexpr auto node_count = std::size_t{ 1'000 };
+	auto hierarchy = TransformHierarchy(node_count);
+	for (auto entity = std::size_t{ 0 }; entity < node_count; ++entity)
+	{
+		hierarchy.emplace(entity, make_translation(1.0f, 0.0f, 0.0f), entity == 0 ? k_null_entity : (entity - 1) / 3);
+	}
+
+	// Node 2 moves under node 4, a middle child of node 1, so erasing node 1 takes node 2's subtree along
+	hierarchy.set_parent(2, 4);
+	hierarchy.erase(1);
+	hierarchy.update();
+	auto remaining = std::size_t{ 0 };
+	for (auto entity = std::size_t{ 0 }; entity < node_count; ++entity)
+	{
+		auto ancestor = entity;
+		while (ancestor > 3)
+		{
+			ancestor = (ancestor - 1) / 3;
+		}
+		remaining += ancestor == 0 || ancestor == 3 ? 1 : 0;
+	}
+	ASSERT_EQ(hierarchy.size(), remaining);
+	ASSERT_TRUE(hierarchy.has_node(3));
+	ASSERT_FALSE(hierarchy.has_node(2));
+	ASSERT_FALSE(hierarchy.has_node(7));
+	ASSERT_TRUE(hierarchy.has_node(10));
+
+	// Erased entities can be emplaced again without inheriting old children
+	hierarchy.emplace(1, make_translation(1.0f, 0.0f, 0.0f), 3);
+	hierarchy.erase(1);
+	ASSERT_TRUE(hierarchy.has_node(3));
+	ASSERT_TRUE(hierarchy.has_node(10));
+	ASSERT_EQ(hierarchy.size(), remaining);
+}
+
+TEST(TransformHierarchy, erase_large_subtree)
+{
+	// Two interleaved binary trees, the even entities under node 0 and the odd ones under node 1
+	constexpr auto node_count = std::size_t{ 20'000 };
+	const auto get_parent = [](const std::size_t entity)
+	{
+		return entity < 2 ? k_null_entity : 2 * ((entity / 2 - 1) / 2) + entity % 2;
+	};
+
+	auto hierarchy = TransformHierarchy(node_count);
+	for (auto entity = std::size_t{ 0 }; entity < node_count; ++entity)
+	{
+		hierarchy.emplace(entity, make_translation(1.0f, static_cast<float>(entity), 0.0f), get_parent(entity));
+	}
+	hierarchy.update();
+
+	hierarchy.erase(1);
+	ASSERT_EQ(hierarchy.size(), node_count / 2);
+	ASSERT_EQ(hierarchy.get_world_pool().size(), node_count / 2);
+	ASSERT_EQ(hierarchy.get_ticks().size(), node_count / 2);
+
+	hierarchy.update();
+	for (auto entity = std::size_t{ 0 }; entity < node_count; ++entity)
+	{
+		ASSERT_EQ(hierarchy.has_node(entity), entity % 2 == 0);
+		if (entity % 2 != 0)
+		{
+			continue;
+		}
+
+		auto depth = 1.0f;
+		auto y = 0.0f;
+		for (auto ancestor = entity; ancestor != k_null_entity; ancestor = get_parent(ancestor))
+		{
+			depth += ancestor == entity ? 0.0f : 1.0f;
+			y += static_cast<float>(ancestor);
+		}
+		ASSERT_EQ(hierarchy.get_parent(entity), get_parent(entity));
+		ASSERT_FLOAT_EQ(get_translation(hierarchy.get_local(entity)).y, static_cast<float>(entity));
+		ASSERT_FLOAT_EQ(get_translation(hierarchy.get_world(entity)).x, depth);
+		ASSERT_FLOAT_EQ(get_translation(hierarchy.get_world(entity)).y, y);
+	}
+}
+
+TEST(TransformHierarchy, update_parallel_matches_serial)
+{
+	constexpr auto node_count = std::size_t{ 20'000 };
+	auto serial = TransformHierarchy(node_count);
+	auto parallel = TransformHierarchy(node_count);
+	for (auto entity = std::size_t{ 0 }; entity < node_count; ++entity)
+	{
+		const auto parent = entity == 0 ? k_null_entity : (entity - 1) / 3;
+		const auto local = make_translation(1.0f, static_cast<float>(entity % 7), 0.0f);
+		serial.emplace(entity, local, parent);
+		parallel.emplace(entity, local, parent);
+	}
+
+	JobSystem job_system{ 3 };
+	serial.update();
+	parallel.update(job_system);
+
+	for (auto entity = std::size_t{ 0 }; entity < node_count; ++entity)
+	{
+		const auto expected = get_translation(serial.get_world(entity));
+		const auto actual = get_translation(parallel.get_world(entity));
+		ASSERT_FLOAT_EQ(expected.x, actual.x);
+		ASSERT_FLOAT_EQ(expected.y, actual.y);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <Sigma/Engine/Spatial/Bounds.hpp>
+
+namespace sigma::test
+{
+	inline Aabb make_box(const float x, const float y, const float z, const float half_extent = 0.5f)
+	{
+		return { { x - half_extent, y - half_extent, z - half_extent }, { x + half_extent, y + half_extent, z + half_extent } };
+	}
+
+	inline std::vector<Aabb> make_random_boxes(const std::size_t count)
+	{
+		std::mt19937 generator{ 42 };
+		std::uniform_real_distribution<float> position{ -100.0f, 100.0f };
+		std::uniform_real_distribution<float> size{ 0.1f, 6.0f };
+
+		std::vector<Aabb> boxes{};
+		for (std::size_t index = 0; index < count; ++index)
+		{
+			boxes.push_back(make_box(position(generator), position(generator), position(generator), size(generator)));
+		}
+		return boxes;
+	}
+
+	inline std::vector<Entity> sorted(std::vector<Entity> entities)
+	{
+		std::sort(entities.begin(), entities.end());
+		return entities;
+	}
+
+	// Box, ray and nearest queries of a structure holding boxes[entity] for every entity against a linear scan
+	template <typename Structure>
+	void check_matches_brute_force(const Structure& structure, const std::vector<Aabb>& boxes)
+	{
+		const auto queries = make_random_boxes(50);
+		for (const auto& query : queries)
+		{
+			std::vector<Entity> expected{};
+			for (std::size_t entity = 0; entity < boxes.size(); ++entity)
+			{
+				if (intersects(boxes[entity], query))
+				{
+					expected.push_back(entity);
+				}
+			}
+
+			std::vector<Entity> result{};
+			structure.query(query, result);
+			ASSERT_EQ(sorted(result), expected);
+
+			const Ray ray{ get_center(query), { 0.6f, -0.48f, 0.64f } };
+			auto closest = std::numeric_limits<float>::max();
+			for (const auto& box : boxes)
+			{
+				const auto distance = intersect(box, ray);
+				if (distance >= 0.0f)
+				{
+					closest = std::min(closest, distance);
+				}
+			}
+			ASSERT_FLOAT_EQ(structure.raycast(ray).distance, closest);
+
+			auto distances = std::vector<float>{};
+			for (const auto& box : boxes)
+			{
+				distances.push_back(get_distance_squared(box, query.min));
+			}
+			std::sort(distances.begin(), distances.end());
+
+			std::vector<Entity> nearest{};
+			structure.query_nearest(query.min, 5, nearest);
+			ASSERT_EQ(nearest.size(), 5);
+			for (std::size_t rank = 0; rank < nearest.size(); ++rank)
+			{
+				ASSERT_FLOAT_EQ(get_distance_squared(boxes[nearest[rank]], query.min), distances[rank]);
+			}
+		}
+	}
+}
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+
+#include <Sigma/Engine/Spatial/Bounds.hpp>
+
+using namespace sigma;
+
+TEST(Bounds, merge)
+{
+	const auto merged = merge(Aabb{ { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f } }, Aabb{ { -1.0f, 2.0f, 0.5f }, { 0.5f, 3.0f, 4.0f } });
+	ASSERT_FLOAT_EQ(merged.min.x, -1.0f);
+	ASSERT_FLOAT_EQ(merged.min.y, 0.0f);
+	ASSERT_FLOAT_EQ(merged.max.y, 3.0f);
+	ASSERT_FLOAT_EQ(merged.max.z, 4.0f);
+}
+
+TEST(Bounds, get_surface_area)
+{
+	ASSERT_FLOAT_EQ(get_surface_area(Aabb{ { 0.0f, 0.0f, 0.0f }, { 1.0f, 2.0f, 3.0f } }), 22.0f);
+}
+
+TEST(Bounds, contains)
+{
+	const Aabb outer{ { 0.0f, 0.0f, 0.0f }, { 4.0f, 4.0f, 4.0f } };
+	ASSERT_TRUE(contains(outer, Aabb{ { 1.0f, 1.0f, 1.0f }, { 2.0f, 2.0f, 2.0f } }));
+	ASSERT_FALSE(contains(outer, Aabb{ { 1.0f, 1.0f, 1.0f }, { 5.0f, 2.0f, 2.0f } }));
+}
+
+TEST(Bounds, intersects_aabb)
+{
+	const Aabb bounds{ { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f } };
+	ASSERT_TRUE(intersects(bounds, Aabb{ { 1.0f, 0.5f, 0.5f }, { 2.0f, 2.0f, 2.0f } }));
+	ASSERT_FALSE(intersects(bounds, Aabb{ { 1.5f, 0.5f, 0.5f }, { 2.0f, 2.0f, 2.0f } }));
+}
+
+TEST(Bounds, intersects_sphere)
+{
+	const Aabb bounds{ { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f } };
+	ASSERT_TRUE(intersects(bounds, Sphere{ { 2.0f, 0.5f, 0.5f }, 1.0f }));
+	ASSERT_FALSE(intersects(bounds, Sphere{ { 2.0f, 2.0f, 2.0f }, 1.0f }));
+}
+
+TEST(Bounds, intersect_ray)
+{
+	const Aabb bounds{ { 2.0f, -1.0f, -1.0f }, { 3.0f, 1.0f, 1.0f } };
+	ASSERT_FLOAT_EQ(intersect(bounds, Ray{ { 0.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f } }), 2.0f);
+	ASSERT_LT(intersect(bounds, Ray{ { 0.0f, 0.0f, 0.0f }, { -1.0f, 0.0f, 0.0f } }), 0.0f);
+	ASSERT_LT(intersect(bounds, Ray{ { 0.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }, 1.5f }), 0.0f);
+	ASSERT_FLOAT_EQ(intersect(bounds, Ray{ { 2.5f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f } }), 0.0f);
+}
+
+TEST(Bounds, transform)
+{
+	Matrix4x4 matrix{};
+	DirectX::XMStoreFloat4x4(&matrix, DirectX::XMMatrixMultiply(DirectX::XMMatrixScaling(2.0f, 1.0f, 1.0f), DirectX::XMMatrixTranslation(10.0f, 0.0f, 0.0f)));
+
+	const auto world = transform(Aabb{ { -1.0f, -1.0f, -1.0f }, { 1.0f, 1.0f, 1.0f } }, matrix);
+	ASSERT_FLOAT_EQ(world.min.x, 8.0f);
+	ASSERT_FLOAT_EQ(world.max.x, 12.0f);
+	ASSERT_FLOAT_EQ(world.min.y, -1.0f);
+	ASSERT_FLOAT_EQ(world.max.z, 1.0f);
+}
\ No newline at end of file
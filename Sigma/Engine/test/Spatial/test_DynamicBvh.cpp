@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+
+#include <Sigma/Engine/Spatial/DynamicBvh.hpp>
+
+#include "spatial_test_helpers.hpp"
+
+using namespace sigma;
+using namespace sigma::test;
+
+namespace
+{
+	auto make_structure(const std::size_t capacity)
+	{
+		return DynamicBvh(Aabb{ { -200.0f, -200.0f, -200.0f }, { 200.0f, 200.0f, 200.0f } }, 0.5f, capacity);
+	}
+}
+
+TEST(DynamicBvh, insert)
+{
+	auto structure = make_structure(4);
+	structure.insert(3, make_box(0.0f, 0.0f, 0.0f));
+	structure.insert(1, make_box(10.0f, 0.0f, 0.0f));
+	ASSERT_EQ(structure.size(), 2);
+	ASSERT_TRUE(structure.contains(3));
+	ASSERT_TRUE(structure.contains(1));
+	ASSERT_FALSE(structure.contains(0));
+	ASSERT_FLOAT_EQ(structure.get_bounds(1).min.x, 9.5f);
+}
+
+TEST(DynamicBvh, erase)
+{
+	auto structure = make_structure(4);
+	structure.insert(0, make_box(0.0f, 0.0f, 0.0f));
+	structure.insert(1, make_box(1.0f, 0.0f, 0.0f));
+	structure.insert(2, make_box(2.0f, 0.0f, 0.0f));
+
+	structure.erase(1);
+	ASSERT_EQ(structure.size(), 2);
+	ASSERT_FALSE(structure.contains(1));
+
+	std::vector<Entity> result{};
+	structure.query(make_box(1.0f, 0.0f, 0.0f, 2.0f), result);
+	ASSERT_EQ(sorted(result), (std::vector<Entity>{ 0, 2 }));
+}
+
+TEST(DynamicBvh, update)
+{
+	auto structure = make_structure(2);
+	structure.insert(0, make_box(0.0f, 0.0f, 0.0f));
+	structure.insert(1, make_box(50.0f, 0.0f, 0.0f));
+
+	structure.update(0, make_box(50.0f, 1.0f, 0.0f));
+
+	std::vector<Entity> result{};
+	structure.query(make_box(0.0f, 0.0f, 0.0f, 2.0f), result);
+	ASSERT_TRUE(result.empty());
+
+	structure.query(make_box(50.0f, 0.0f, 0.0f, 2.0f), result);
+	ASSERT_EQ(sorted(result), (std::vector<Entity>{ 0, 1 }));
+}
+
+TEST(DynamicBvh, objects_outside_the_world)
+{
+	auto structure = make_structure(3);
+	structure.insert(0, make_box(0.0f, 0.0f, 0.0f));
+	structure.insert(1, make_box(190.0f, 0.0f, 0.0f));
+	structure.insert(2, make_box(0.0f, 300.0f, 0.0f));
+
+	// Leaving the world keeps the object findable instead of clamping its leaf to the world's edge
+	structure.update(1, make_box(260.0f, 0.0f, 0.0f));
+	std::vector<Entity> result{};
+	structure.query(make_box(260.0f, 0.0f, 0.0f, 2.0f), result);
+	ASSERT_EQ(result, (std::vector<Entity>{ 1 }));
+
+	result.clear();
+	structure.query(make_box(199.0f, 0.0f, 0.0f, 2.0f), result);
+	ASSERT_TRUE(result.empty());
+
+	const auto hit = structure.raycast(Ray{ { 0.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f } });
+	ASSERT_EQ(hit.entity, 0);
+	const auto far_hit = structure.raycast(Ray{ { 0.0f, 200.0f, 0.0f }, { 0.0f, 1.0f, 0.0f } });
+	ASSERT_EQ(far_hit.entity, 2);
+	ASSERT_FLOAT_EQ(far_hit.distance, 99.5f);
+
+	result.clear();
+	structure.query_nearest({ 250.0f, 0.0f, 0.0f }, 2, result);
+	ASSERT_EQ(result, (std::vector<Entity>{ 1, 0 }));
+
+	// Coming back inside returns the object to the tree
+	structure.update(1, make_box(10.0f, 0.0f, 0.0f));
+	structure.erase(2);
+	result.clear();
+	structure.query(Sphere{ { 10.0f, 0.0f, 0.0f }, 1.0f }, result);
+	ASSERT_EQ(result, (std::vector<Entity>{ 1 }));
+	ASSERT_EQ(structure.size(), 2);
+	ASSERT_FALSE(structure.contains(2));
+}
+
+TEST(DynamicBvh, query_sphere)
+{
+	auto structure = make_structure(2);
+	structure.insert(0, make_box(0.0f, 0.0f, 0.0f));
+	structure.insert(1, make_box(3.0f, 3.0f, 0.0f));
+
+	std::vector<Entity> result{};
+	structure.query(Sphere{ { 2.0f, 0.0f, 0.0f }, 1.6f }, result);
+	ASSERT_EQ(result, (std::vector<Entity>{ 0 }));
+}
+
+TEST(DynamicBvh, raycast)
+{
+	auto structure = make_structure(3);
+	structure.insert(0, make_box(5.0f, 0.0f, 0.0f));
+	structure.insert(1, make_box(20.0f, 0.0f, 0.0f));
+	structure.insert(2, make_box(10.0f, 5.0f, 0.0f));
+
+	const auto hit = structure.raycast(Ray{ { 0.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f } });
+	ASSERT_EQ(hit.entity, 0);
+	ASSERT_FLOAT_EQ(hit.distance, 4.5f);
+
+	const auto miss = structure.raycast(Ray{ { 0.0f, 0.0f, 0.0f }, { -1.0f, 0.0f, 0.0f } });
+	ASSERT_EQ(miss.entity, k_null_entity);
+}
+
+TEST(DynamicBvh, query_nearest)
+{
+	auto structure = make_structure(4);
+	structure.insert(0, make_box(10.0f, 0.0f, 0.0f));
+	structure.insert(1, make_box(2.0f, 0.0f, 0.0f));
+	structure.insert(2, make_box(-5.0f, 0.0f, 0.0f));
+	structure.insert(3, make_box(40.0f, 0.0f, 0.0f));
+
+	std::vector<Entity> result{};
+	structure.query_nearest({ 0.0f, 0.0f, 0.0f }, 3, result);
+	ASSERT_EQ(result, (std::vector<Entity>{ 1, 2, 0 }));
+}
+
+TEST(DynamicBvh, matches_brute_force)
+{
+	const auto boxes = make_random_boxes(2'000);
+	auto structure = make_structure(boxes.size());
+	for (std::size_t entity = 0; entity < boxes.size(); ++entity)
+	{
+		structure.insert(entity, boxes[entity]);
+	}
+
+	check_matches_brute_force(structure, boxes);
+}
+
+TEST(DynamicBvh, rotations_keep_tree_shallow)
+{
+	auto structure = make_structure(4'096);
+	for (std::size_t entity = 0; entity < 4'096; ++entity)
+	{
+		structure.insert(entity, make_box(static_cast<float>(entity % 64) * 2.0f - 64.0f, static_cast<float>(entity / 64) * 2.0f - 64.0f, 0.0f));
+	}
+	ASSERT_LT(structure.get_height(), 40);
+}
\ No newline at end of file
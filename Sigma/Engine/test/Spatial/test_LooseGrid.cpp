@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <Sigma/Engine/Spatial/LooseGrid.hpp>
+
+#include "spatial_test_helpers.hpp"
+
+using namespace sigma;
+using namespace sigma::test;
+
+namespace
+{
+	auto make_structure(const std::size_t capacity)
+	{
+		return LooseGrid(4.0f, capacity);
+	}
+}
+
+TEST(LooseGrid, insert)
+{
+	auto structure = make_structure(4);
+	structure.insert(3, make_box(0.0f, 0.0f, 0.0f));
+	structure.insert(1, make_box(10.0f, 0.0f, 0.0f));
+	ASSERT_EQ(structure.size(), 2);
+	ASSERT_TRUE(structure.contains(3));
+	ASSERT_TRUE(structure.contains(1));
+	ASSERT_FALSE(structure.contains(0));
+	ASSERT_FLOAT_EQ(structure.get_bounds(1).min.x, 9.5f);
+}
+
+TEST(LooseGrid, erase)
+{
+	auto structure = make_structure(4);
+	structure.insert(0, make_box(0.0f, 0.0f, 0.0f));
+	structure.insert(1, make_box(1.0f, 0.0f, 0.0f));
+	structure.insert(2, make_box(2.0f, 0.0f, 0.0f));
+
+	structure.erase(1);
+	ASSERT_EQ(structure.size(), 2);
+	ASSERT_FALSE(structure.contains(1));
+
+	std::vector<Entity> result{};
+	structure.query(make_box(1.0f, 0.0f, 0.0f, 2.0f), result);
+	ASSERT_EQ(sorted(result), (std::vector<Entity>{ 0, 2 }));
+}
+
+TEST(LooseGrid, update)
+{
+	auto structure = make_structure(2);
+	structure.insert(0, make_box(0.0f, 0.0f, 0.0f));
+	structure.insert(1, make_box(50.0f, 0.0f, 0.0f));
+
+	structure.update(0, make_box(50.0f, 1.0f, 0.0f));
+
+	std::vector<Entity> result{};
+	structure.query(make_box(0.0f, 0.0f, 0.0f, 2.0f), result);
+	ASSERT_TRUE(result.empty());
+
+	structure.query(make_box(50.0f, 0.0f, 0.0f, 2.0f), result);
+	ASSERT_EQ(sorted(result), (std::vector<Entity>{ 0, 1 }));
+}
+
+TEST(LooseGrid, update_drops_empty_cells)
+{
+	auto structure = make_structure(2);
+	structure.insert(0, make_box(0.0f, 0.0f, 0.0f));
+	structure.insert(1, make_box(0.5f, 0.0f, 0.0f));
+	ASSERT_EQ(structure.get_cell_count(), 1);
+
+	for (auto step = 1; step <= 100; ++step)
+	{
+		structure.update(0, make_box(static_cast<float>(step) * 4.0f, 0.0f, 0.0f));
+	}
+	ASSERT_EQ(structure.get_cell_count(), 2);
+
+	structure.erase(0);
+	structure.erase(1);
+	ASSERT_EQ(structure.get_cell_count(), 0);
+}
+
+TEST(LooseGrid, query_sphere)
+{
+	auto structure = make_structure(2);
+	structure.insert(0, make_box(0.0f, 0.0f, 0.0f));
+	structure.insert(1, make_box(3.0f, 3.0f, 0.0f));
+
+	std::vector<Entity> result{};
+	structure.query(Sphere{ { 2.0f, 0.0f, 0.0f }, 1.6f }, result);
+	ASSERT_EQ(result, (std::vector<Entity>{ 0 }));
+}
+
+TEST(LooseGrid, raycast)
+{
+	auto structure = make_structure(3);
+	structure.insert(0, make_box(5.0f, 0.0f, 0.0f));
+	structure.insert(1, make_box(20.0f, 0.0f, 0.0f));
+	structure.insert(2, make_box(10.0f, 5.0f, 0.0f));
+
+	const auto hit = structure.raycast(Ray{ { 0.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f } });
+	ASSERT_EQ(hit.entity, 0);
+	ASSERT_FLOAT_EQ(hit.distance, 4.5f);
+
+	const auto miss = structure.raycast(Ray{ { 0.0f, 0.0f, 0.0f }, { -1.0f, 0.0f, 0.0f } });
+	ASSERT_EQ(miss.entity, k_null_entity);
+}
+
+TEST(LooseGrid, query_nearest)
+{
+	auto structure = make_structure(4);
+	structure.insert(0, make_box(10.0f, 0.0f, 0.0f));
+	structure.insert(1, make_box(2.0f, 0.0f, 0.0f));
+	structure.insert(2, make_box(-5.0f, 0.0f, 0.0f));
+	structure.insert(3, make_box(40.0f, 0.0f, 0.0f));
+
+	std::vector<Entity> result{};
+	structure.query_nearest({ 0.0f, 0.0f, 0.0f }, 3, result);
+	ASSERT_EQ(result, (std::vector<Entity>{ 1, 2, 0 }));
+}
+
+TEST(LooseGrid, matches_brute_force)
+{
+	const auto boxes = make_random_boxes(2'000);
+	auto structure = make_structure(boxes.size());
+	for (std::size_t entity = 0; entity < boxes.size(); ++entity)
+	{
+		structure.insert(entity, boxes[entity]);
+	}
+
+	check_matches_brute_force(structure, boxes);
+}
\ No newline at end of file
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <Sigma/Engine/Spatial/DynamicBvh.hpp>
+#include <Sigma/Engine/Spatial/LooseGrid.hpp>
+#include <Sigma/Engine/Spatial/SpatialIndex.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	Matrix4x4 make_translation(const float x, const float y, const float z)
+	{
+		Matrix4x4 matrix{};
+		DirectX::XMStoreFloat4x4(&matrix, DirectX::XMMatrixTranslation(x, y, z));
+		return matrix;
+	}
+
+	constexpr Aabb k_unit_bounds{ { -0.5f, -0.5f, -0.5f }, { 0.5f, 0.5f, 0.5f } };
+}
+
+TEST(SpatialIndex, synchronize_inserts_pending)
+{
+	auto hierarchy = TransformHierarchy(2);
+	hierarchy.emplace(0, make_translation(5.0f, 0.0f, 0.0f));
+	hierarchy.update();
+
+	auto index = SpatialIndex<LooseGrid>(4, 2.0f);
+	index.set_local_bounds(0, k_unit_bounds);
+	index.set_local_bounds(1, k_unit_bounds);
+	index.synchronize(hierarchy);
+
+	ASSERT_TRUE(index.get_structure().contains(0));
+	ASSERT_FALSE(index.get_structure().contains(1));
+	ASSERT_FLOAT_EQ(index.get_structure().get_bounds(0).min.x, 4.5f);
+
+	hierarchy.emplace(1, make_translation(0.0f, 3.0f, 0.0f), 0);
+	hierarchy.update();
+	index.synchronize(hierarchy);
+	ASSERT_TRUE(index.get_structure().contains(1));
+	ASSERT_FLOAT_EQ(index.get_structure().get_bounds(1).min.y, 2.5f);
+}
+
+TEST(SpatialIndex, synchronize_follows_changed_transforms)
+{
+	auto hierarchy = TransformHierarchy(2);
+	hierarchy.emplace(0, make_translation(0.0f, 0.0f, 0.0f));
+	hierarchy.emplace(1, make_translation(1.0f, 0.0f, 0.0f), 0);
+	hierarchy.update();
+
+	auto index = SpatialIndex<DynamicBvh>(2, Aabb{ { -100.0f, -100.0f, -100.0f }, { 100.0f, 100.0f, 100.0f } }, 0.1f);
+	index.set_local_bounds(0, k_unit_bounds);
+	index.set_local_bounds(1, k_unit_bounds);
+	index.synchronize(hierarchy);
+
+	hierarchy.set_local(0, make_translation(0.0f, 20.0f, 0.0f));
+	hierarchy.update();
+	index.synchronize(hierarchy);
+
+	ASSERT_FLOAT_EQ(index.get_structure().get_bounds(0).min.y, 19.5f);
+	ASSERT_FLOAT_EQ(index.get_structure().get_bounds(1).min.x, 0.5f);
+	ASSERT_FLOAT_EQ(index.get_structure().get_bounds(1).min.y, 19.5f);
+}
+
+TEST(SpatialIndex, erase)
+{
+	auto hierarchy = TransformHierarchy(1);
+	hierarchy.emplace(0, make_translation(0.0f, 0.0f, 0.0f));
+	hierarchy.update();
+
+	auto index = SpatialIndex<LooseGrid>(1, 2.0f);
+	index.set_local_bounds(0, k_unit_bounds);
+	index.synchronize(hierarchy);
+	index.erase(0);
+	ASSERT_FALSE(index.get_structure().contains(0));
+}
+
+TEST(SpatialIndex, batched_queries)
+{
+	constexpr auto count = std::size_t{ 1'000 };
+	auto hierarchy = TransformHierarchy(count);
+	auto index = SpatialIndex<DynamicBvh>(count, Aabb{ { -10.0f, -10.0f, -10.0f }, { 2'000.0f, 10.0f, 10.0f } }, 0.1f);
+	for (std::size_t entity = 0; entity < count; ++entity)
+	{
+		hierarchy.emplace(entity, make_translation(static_cast<float>(entity) * 2.0f, 0.0f, 0.0f));
+		index.set_local_bounds(entity, k_unit_bounds);
+	}
+	hierarchy.update();
+	index.synchronize(hierarchy);
+
+	std::vector<Aabb> boxes{};
+	std::vector<Sphere> spheres{};
+	std::vector<Ray> rays{};
+	std::vector<Vector3> points{};
+	for (std::size_t query = 0; query < 300; ++query)
+	{
+		const auto x = static_cast<float>(query) * 2.0f;
+		boxes.push_back({ { x - 0.1f, -1.0f, -1.0f }, { x + 0.1f, 1.0f, 1.0f } });
+		spheres.push_back({ { x, 2.0f, 0.0f }, 1.6f });
+		rays.push_back({ { x, 5.0f, 0.0f }, { 0.0f, -1.0f, 0.0f } });
+		points.push_back({ x, 0.0f, 0.0f });
+	}
+
+	JobSystem job_system{ 3 };
+	std::vector<std::vector<Entity>> results{};
+	std::vector<RayHit> hits{};
+
+	index.query(boxes, results, job_system);
+	ASSERT_EQ(results.size(), boxes.size());
+	for (std::size_t query = 0; query < boxes.size(); ++query)
+	{
+		ASSERT_EQ(results[query], (std::vector<Entity>{ query }));
+	}
+
+	index.query(spheres, results, job_system);
+	for (std::size_t query = 0; query < spheres.size(); ++query)
+	{
+		ASSERT_EQ(results[query], (std::vector<Entity>{ query }));
+	}
+
+	index.raycast(rays, hits, job_system);
+	for (std::size_t query = 0; query < rays.size(); ++query)
+	{
+		ASSERT_EQ(hits[query].entity, query);
+		ASSERT_FLOAT_EQ(hits[query].distance, 4.5f);
+	}
+
+	index.query_nearest(points, 1, results, job_system);
+	for (std::size_t query = 0; query < points.size(); ++query)
+	{
+		ASSERT_EQ(results[query], (std::vector<Entity>{ query }));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Sigma/Engine/utilities/StringTable.hpp>
+
+using namespace sigma;
+using namespace sigma::literals;
+
+TEST(StringTable, intern_and_find)
+{
+	StringTable table{};
+	const std::string name = "enemy_spawner";
+	const auto id = table.intern(name);
+	ASSERT_EQ(id, "enemy_spawner"_hs);
+	ASSERT_EQ(table.find(id), "enemy_spawner");
+	ASSERT_EQ(table.intern("enemy_spawner"), id);
+	ASSERT_EQ(table.size(), 1);
+	ASSERT_TRUE(table.find("never_interned"_hs).empty());
+	ASSERT_FALSE(table.contains("never_interned"_hs));
+}
+
+TEST(StringTable, detects_collisions)
+{
+	// A known pair of colliding names for 32-bit FNV-1a
+	static_assert("costarring"_hs == "liquid"_hs);
+
+	StringTable table{};
+	table.intern("costarring");
+	table.intern("liquid");
+	ASSERT_EQ(table.find("liquid"_hs), "costarring");
+#if defined(NDEBUG)
+	ASSERT_EQ(table.get_collision_count(), 0);
+#else
+	ASSERT_EQ(table.get_collision_count(), 1);
+#endif
+}
+
+TEST(StringTable, concurrent_interning)
+{
+	constexpr auto k_name_count = 1000;
+
+	StringTable table{};
+	{
+		std::vector<std::jthread> threads{};
+		for (auto thread = 0; thread < 4; ++thread)
+		{
+			threads.emplace_back([&]()
+			{
+				for (auto index = 0; index < k_name_count; ++index)
+				{
+					const auto name = "name_" + std::to_string(index);
+					ASSERT_EQ(table.intern(name), HashedString{ name });
+				}
+			});
+		}
+	}
+
+	ASSERT_EQ(table.size(), k_name_count);
+	ASSERT_EQ(table.find(HashedString{ std::string_view{ "name_42" } }), "name_42");
+	ASSERT_EQ(table.get_collision_count(), 0);
+}
\ No newline at end of file
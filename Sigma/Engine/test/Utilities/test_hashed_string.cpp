@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <unordered_map>
+
+#include <Sigma/Engine/utilities/hashed_string.hpp>
+
+using namespace sigma;
+using namespace sigma::literals;
+
+namespace
+{
+	template<HashedString Name>
+	constexpr UInt32 get_name_value() noexcept
+	{
+		return Name.value;
+	}
+}
+
+TEST(hashed_string, compile_time_hash)
+{
+	// Reference values of 32-bit FNV-1a
+	static_assert(hash_string("") == 2166136261u);
+	static_assert(hash_string("a") == 0xe40c292cu);
+	static_assert(HashedString{ "render" } == "render"_hs);
+	static_assert(HashedString{ "render" } != HashedString{ "physics" });
+	static_assert(HashedStringTag<"render">::value == hash_string("render"));
+	static_assert(get_name_value<"physics">() == "physics"_hs.value);
+}
+
+TEST(hashed_string, runtime_matches_compile_time)
+{
+	const std::string name = "render";
+	ASSERT_EQ(HashedString{ name }, "render"_hs);
+
+	std::unordered_map<HashedString, int> systems{ { "render"_hs, 1 }, { "physics"_hs, 2 } };
+	ASSERT_EQ(systems.at(HashedString{ std::string{ "physics" } }), 2);
+}
\ No newline at end of file
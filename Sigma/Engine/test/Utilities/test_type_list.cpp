@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <Sigma/Engine/utilities/type_list.hpp>
+#include <Sigma/Engine/utilities/type_name.hpp>
+
+using namespace sigma;
+
+namespace
+{
+	struct Position {};
+	struct Velocity {};
+
+	using List = TypeList<int, float, Position>;
+}
+
+TEST(type_list, index_and_contains)
+{
+	static_assert(type_list_index_v<int, List> == 0);
+	static_assert(type_list_index_v<Position, List> == 2);
+	static_assert(type_list_index_v<Velocity, List> == List::size);
+	static_assert(type_list_contains_v<float, List>);
+	static_assert(!type_list_contains_v<double, List>);
+	static_assert(std::is_same_v<type_list_element_t<1, List>, float>);
+}
+
+TEST(type_list, unique)
+{
+	static_assert(type_list_is_unique_v<List>);
+	static_assert(type_list_is_unique_v<TypeList<>>);
+	static_assert(!type_list_is_unique_v<TypeList<int, float, int>>);
+}
+
+TEST(type_list, concat_filter_apply)
+{
+	static_assert(std::is_same_v<type_list_concat_t<TypeList<int>, TypeList<>, TypeList<float, Position>>, List>);
+	static_assert(std::is_same_v<type_list_filter_t<std::is_arithmetic, List>, TypeList<int, float>>);
+	static_assert(std::is_same_v<type_list_apply_t<List, std::tuple>, std::tuple<int, float, Position>>);
+}
+
+TEST(type_list, for_each_type)
+{
+	std::vector<std::size_t> sizes{};
+	for_each_type(TypeList<char, UInt32, UInt64>{}, [&]<typename T>(std::type_identity<T>) { sizes.push_back(sizeof(T)); });
+	ASSERT_EQ(sizes, (std::vector<std::size_t>{ 1, 4, 8 }));
+}
+
+TEST(type_name, names_and_hashes)
+{
+	static_assert(type_name<int>() == "int");
+	static_assert(type_hash<Position>() != type_hash<Velocity>());
+	static_assert(TypeHashTag<Position>::value == type_hash<Position>());
+
+	const std::string name{ type_name<Position>() };
+	ASSERT_NE(name.find("Position"), std::string::npos);
+}
\ No newline at end of file